@@ -0,0 +1,163 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+/**
+ * @file bench_find_eq.c
+ * @brief mu_vec_find with a find function against mu_vec_find_eq.
+ *
+ * Scans a vector of 32-byte records for the single record with a given id,
+ * placed last so every record is visited.  Compares the callback-based
+ * mu_vec_find with the inline mu_vec_find_eq, and also times
+ * mu_vec_count_eq and mu_vec_find_range over the same records.  Each scan
+ * is repeated and the fastest run reported.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store.h"
+#include "mu_vec.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define ITEM_COUNT (1u << 20)
+#define REPEATS 20
+
+typedef struct {
+    uint64_t timestamp;
+    uint32_t id;
+    uint32_t quantity;
+    uint8_t payload[16];
+} record_t;
+
+typedef enum {
+    SCAN_FIND_FN,
+    SCAN_FIND_EQ,
+    SCAN_COUNT_EQ,
+    SCAN_FIND_RANGE,
+    SCAN_COUNT,
+} scan_t;
+
+// *****************************************************************************
+// Private static function declarations
+
+static bool has_id(const void *item, const void *arg);
+static double now_ms(void);
+static void fill_records(record_t *records, size_t count);
+static size_t run_scan(const mu_vec_t *v, scan_t scan, uint32_t id);
+
+// *****************************************************************************
+// Main
+
+int main(void) {
+    record_t *records = malloc(sizeof(record_t) * ITEM_COUNT);
+    if (!records) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    mu_vec_t v;
+    mu_vec_init(&v, records, ITEM_COUNT, sizeof(record_t));
+    fill_records(records, ITEM_COUNT);
+    v.count = ITEM_COUNT;
+    uint32_t id = records[ITEM_COUNT - 1].id;
+    printf("%u records of %zu bytes\n", ITEM_COUNT, sizeof(record_t));
+
+    static const char *const names[] = {"mu_vec_find (find_fn)",
+                                        "mu_vec_find_eq", "mu_vec_count_eq",
+                                        "mu_vec_find_range"};
+    for (int scan = 0; scan < SCAN_COUNT; scan++) {
+        double best = 0.0;
+        for (int r = 0; r < REPEATS; r++) {
+            double start = now_ms();
+            size_t result = run_scan(&v, (scan_t)scan, id);
+            double ms = now_ms() - start;
+            if (result != (scan == SCAN_COUNT_EQ ? 1 : ITEM_COUNT - 1)) {
+                fprintf(stderr, "%s: wrong result\n", names[scan]);
+                return 1;
+            }
+            best = r == 0 || ms < best ? ms : best;
+        }
+        printf("%-24s %8.2f ms\n", names[scan], best);
+    }
+
+    free(records);
+    return 0;
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static bool has_id(const void *item, const void *arg) {
+    return ((const record_t *)item)->id == *(const uint32_t *)arg;
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+static void fill_records(record_t *records, size_t count) {
+    uint64_t x = 88172645463325252ull;
+    for (size_t i = 0; i < count; i++) {
+        // xorshift64
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        records[i].timestamp = x;
+        records[i].id = (uint32_t)i;
+        records[i].quantity = (uint32_t)(x >> 40);
+    }
+}
+
+static size_t run_scan(const mu_vec_t *v, scan_t scan, uint32_t id) {
+    size_t result = 0;
+    switch (scan) {
+    case SCAN_FIND_FN:
+        mu_vec_find(v, has_id, &id, &result);
+        break;
+    case SCAN_FIND_EQ:
+        mu_vec_find_eq(v, offsetof(record_t, id), sizeof(uint32_t), &id,
+                       &result);
+        break;
+    case SCAN_COUNT_EQ:
+        mu_vec_count_eq(v, offsetof(record_t, id), sizeof(uint32_t), &id,
+                        &result);
+        break;
+    case SCAN_FIND_RANGE:
+    default:
+        mu_vec_find_range(v, offsetof(record_t, id), sizeof(uint32_t),
+                          MU_STORE_RADIX_UNSIGNED, &id, &id, &result);
+        break;
+    }
+    return result;
+}
+
+// *****************************************************************************
+// End of file
@@ -0,0 +1,147 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file bench_parallel_sort.c
+ * @brief Scaling of mu_store_parallel_sort from 1 to N threads.
+ *
+ * Sorts the same random array of 16-byte records with 1, 2, 4, ... threads
+ * up to the number of online CPUs (or the count given as the first
+ * argument) and reports the time and speed-up over the serial mu_store_sort.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store.h"
+#include "mu_store_parallel.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define ITEM_COUNT (4u << 20)
+
+typedef struct {
+    uint64_t timestamp;
+    uint32_t id;
+    uint32_t quantity;
+} record_t;
+
+// *****************************************************************************
+// Private static function declarations
+
+static int compare_records(const void *a, const void *b);
+static double now_ms(void);
+static void fill_random(record_t *records, size_t count);
+static int is_sorted(const record_t *records, size_t count);
+
+// *****************************************************************************
+// Main
+
+int main(int argc, char **argv) {
+    long max_threads = argc > 1 ? atol(argv[1]) : sysconf(_SC_NPROCESSORS_ONLN);
+    if (max_threads < 1) {
+        max_threads = 1;
+    }
+    record_t *records = malloc(sizeof(record_t) * ITEM_COUNT);
+    record_t *scratch = malloc(sizeof(record_t) * ITEM_COUNT);
+    if (!records || !scratch) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    fill_random(records, ITEM_COUNT);
+    double start = now_ms();
+    mu_store_sort(records, ITEM_COUNT, sizeof(record_t), compare_records);
+    double serial_ms = now_ms() - start;
+    printf("%u records, serial mu_store_sort: %.1f ms\n", ITEM_COUNT,
+           serial_ms);
+    printf("%8s %10s %8s\n", "threads", "ms", "speedup");
+
+    for (long threads = 1; threads <= max_threads; threads *= 2) {
+        fill_random(records, ITEM_COUNT);
+        start = now_ms();
+        mu_store_parallel_sort(records, ITEM_COUNT, sizeof(record_t),
+                               compare_records, scratch, (size_t)threads);
+        double ms = now_ms() - start;
+        if (!is_sorted(records, ITEM_COUNT)) {
+            fprintf(stderr, "not sorted\n");
+            return 1;
+        }
+        printf("%8ld %10.1f %7.2fx\n", threads, ms, serial_ms / ms);
+        if (threads < max_threads && threads * 2 > max_threads) {
+            threads = max_threads / 2; // also measure max_threads itself
+        }
+    }
+
+    free(records);
+    free(scratch);
+    return 0;
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static int compare_records(const void *a, const void *b) {
+    uint64_t ta = ((const record_t *)a)->timestamp;
+    uint64_t tb = ((const record_t *)b)->timestamp;
+    return (ta > tb) - (ta < tb);
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+static void fill_random(record_t *records, size_t count) {
+    uint64_t x = 88172645463325252ull;
+    for (size_t i = 0; i < count; i++) {
+        // xorshift64
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        records[i].timestamp = x;
+        records[i].id = (uint32_t)i;
+        records[i].quantity = (uint32_t)(x >> 40);
+    }
+}
+
+static int is_sorted(const record_t *records, size_t count) {
+    for (size_t i = 1; i < count; i++) {
+        if (compare_records(&records[i - 1], &records[i]) > 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// *****************************************************************************
+// End of file
@@ -0,0 +1,157 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file bench_psort_by_key.c
+ * @brief mu_store_psort against the key-extracted mu_store_psort_by_key.
+ *
+ * Sorts an array of pointers to 64-byte records, scattered in random order
+ * through a pool much larger than the cache, by a 64-bit timestamp.  Compares
+ * the comparator-based mu_store_psort, which dereferences two records per
+ * comparison, with mu_store_psort_by_key using each of its two scratch
+ * sizes (pdqsort and radix sort over the extracted keys).
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define ITEM_COUNT (1u << 20)
+
+typedef struct {
+    uint64_t timestamp;
+    uint32_t id;
+    uint8_t payload[52];
+} record_t;
+
+// *****************************************************************************
+// Private static function declarations
+
+static int compare_record_slots(const void *a, const void *b);
+static uint64_t record_key(const void *item);
+static double now_ms(void);
+static void fill_scattered(record_t *pool, void **ptrs, size_t count);
+static int is_sorted(void *const *ptrs, size_t count);
+
+// *****************************************************************************
+// Main
+
+int main(void) {
+    record_t *pool = malloc(sizeof(record_t) * ITEM_COUNT);
+    void **ptrs = malloc(sizeof(void *) * ITEM_COUNT);
+    mu_store_key_pair_t *pairs =
+        malloc(sizeof(mu_store_key_pair_t) * ITEM_COUNT * 2);
+    if (!pool || !ptrs || !pairs) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    printf("%u pointers to %zu-byte records\n", ITEM_COUNT, sizeof(record_t));
+
+    for (int variant = 0; variant < 3; variant++) {
+        static const char *const names[] = {"mu_store_psort",
+                                            "psort_by_key (pdqsort)",
+                                            "psort_by_key (radix)"};
+        fill_scattered(pool, ptrs, ITEM_COUNT);
+        double start = now_ms();
+        if (variant == 0) {
+            mu_store_psort(ptrs, ITEM_COUNT, compare_record_slots);
+        } else {
+            mu_store_psort_by_key(ptrs, ITEM_COUNT, record_key, pairs,
+                                  variant == 1 ? ITEM_COUNT : ITEM_COUNT * 2);
+        }
+        double ms = now_ms() - start;
+        if (!is_sorted(ptrs, ITEM_COUNT)) {
+            fprintf(stderr, "not sorted\n");
+            return 1;
+        }
+        printf("%-24s %8.1f ms\n", names[variant], ms);
+    }
+
+    free(pool);
+    free(ptrs);
+    free(pairs);
+    return 0;
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static int compare_record_slots(const void *a, const void *b) {
+    uint64_t ta = (*(const record_t *const *)a)->timestamp;
+    uint64_t tb = (*(const record_t *const *)b)->timestamp;
+    return (ta > tb) - (ta < tb);
+}
+
+static uint64_t record_key(const void *item) {
+    return ((const record_t *)item)->timestamp;
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+static void fill_scattered(record_t *pool, void **ptrs, size_t count) {
+    uint64_t x = 88172645463325252ull;
+    for (size_t i = 0; i < count; i++) {
+        // xorshift64
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        pool[i].timestamp = x;
+        pool[i].id = (uint32_t)i;
+        ptrs[i] = &pool[i];
+    }
+    // Shuffle so that neighbouring pointers target distant records.
+    for (size_t i = count - 1; i > 0; i--) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        size_t j = (size_t)(x % (i + 1));
+        void *tmp = ptrs[i];
+        ptrs[i] = ptrs[j];
+        ptrs[j] = tmp;
+    }
+}
+
+static int is_sorted(void *const *ptrs, size_t count) {
+    for (size_t i = 1; i < count; i++) {
+        if (compare_record_slots(&ptrs[i - 1], &ptrs[i]) > 0) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// *****************************************************************************
+// End of file
@@ -0,0 +1,147 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file bench_search_many.c
+ * @brief Compare mu_store_search_many against a per-key mu_store_search loop.
+ *
+ * For several table sizes, looks up a batch of sorted and of random queries
+ * both ways and reports nanoseconds per query.  Benchmarks are host programs
+ * and, unlike the library, use malloc for their large buffers.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define QUERY_COUNT (1u << 20)
+
+// *****************************************************************************
+// Private static function declarations
+
+static int compare_u32(const void *a, const void *b);
+static double now_ns(void);
+static uint32_t next_random(uint32_t *state);
+
+// *****************************************************************************
+// Main
+
+int main(void) {
+    static const size_t table_sizes[] = {1u << 10, 1u << 16, 1u << 22};
+    uint32_t *table = malloc(sizeof(uint32_t) * (1u << 22));
+    uint32_t *queries = malloc(sizeof(uint32_t) * QUERY_COUNT);
+    size_t *results = malloc(sizeof(size_t) * QUERY_COUNT);
+    if (!table || !queries || !results) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    printf("%10s %8s %12s %12s %8s\n", "table", "queries", "loop ns/q",
+           "many ns/q", "speedup");
+    for (size_t t = 0; t < sizeof(table_sizes) / sizeof(table_sizes[0]); t++) {
+        size_t n = table_sizes[t];
+        for (size_t i = 0; i < n; i++) {
+            table[i] = (uint32_t)(i * 4);
+        }
+
+        for (int sorted = 1; sorted >= 0; sorted--) {
+            uint32_t state = 12345;
+            for (size_t i = 0; i < QUERY_COUNT; i++) {
+                queries[i] = next_random(&state) % (uint32_t)(n * 4);
+            }
+            if (sorted) {
+                // `results` is free at this point and serves as scratch.
+                mu_store_radix_sort(queries, QUERY_COUNT, sizeof(uint32_t), 0,
+                                    sizeof(uint32_t), MU_STORE_RADIX_UNSIGNED,
+                                    results);
+            }
+
+            size_t check = 0;
+            double start = now_ns();
+            for (size_t i = 0; i < QUERY_COUNT; i++) {
+                results[i] = mu_store_search(table, n, sizeof(uint32_t),
+                                             compare_u32, &queries[i]);
+                check += results[i];
+            }
+            double loop_ns = (now_ns() - start) / QUERY_COUNT;
+
+            start = now_ns();
+            mu_store_search_many(table, n, sizeof(uint32_t), compare_u32,
+                                 queries, QUERY_COUNT, results);
+            double many_ns = (now_ns() - start) / QUERY_COUNT;
+            for (size_t i = 0; i < QUERY_COUNT; i++) {
+                check -= results[i];
+            }
+            if (check != 0) {
+                fprintf(stderr, "result mismatch\n");
+                return 1;
+            }
+
+            printf("%10zu %8s %12.1f %12.1f %7.2fx\n", n,
+                   sorted ? "sorted" : "random", loop_ns, many_ns,
+                   loop_ns / many_ns);
+        }
+    }
+
+    free(table);
+    free(queries);
+    free(results);
+    return 0;
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t ua = *(const uint32_t *)a;
+    uint32_t ub = *(const uint32_t *)b;
+    return (ua > ub) - (ua < ub);
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static uint32_t next_random(uint32_t *state) {
+    // xorshift32
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+// *****************************************************************************
+// End of file
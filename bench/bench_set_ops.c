@@ -0,0 +1,151 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file bench_set_ops.c
+ * @brief Compare sorted-set intersection strategies.
+ *
+ * Intersects a sorted array of ids with a second one of equal or much
+ * smaller size three ways: a loop of mu_store_search() calls over the larger
+ * array, mu_store_set_intersection() with a comparison function, and the
+ * mu_store_set_intersection_u32() fast path.  Reports milliseconds for each.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store.h"
+#include "mu_store_set.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define LARGE_COUNT (1u << 22)
+
+// *****************************************************************************
+// Private static function declarations
+
+static int compare_u32(const void *a, const void *b);
+static double now_ms(void);
+static void fill_sorted(uint32_t *ids, size_t count, uint32_t stride,
+                        uint32_t seed);
+
+// *****************************************************************************
+// Main
+
+int main(void) {
+    static const size_t small_counts[] = {LARGE_COUNT, LARGE_COUNT / 64, 1024};
+    uint32_t *large = malloc(sizeof(uint32_t) * LARGE_COUNT);
+    uint32_t *small = malloc(sizeof(uint32_t) * LARGE_COUNT);
+    uint32_t *out = malloc(sizeof(uint32_t) * LARGE_COUNT);
+    if (!large || !small || !out) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    fill_sorted(large, LARGE_COUNT, 4, 1);
+
+    printf("%10s %10s %12s %12s %12s\n", "large", "small", "search ms",
+           "generic ms", "u32 ms");
+    for (size_t t = 0; t < sizeof(small_counts) / sizeof(small_counts[0]);
+         t++) {
+        size_t n = small_counts[t];
+        fill_sorted(small, n, (uint32_t)(4ull * LARGE_COUNT / n), 2);
+
+        double start = now_ms();
+        size_t search_count = 0;
+        for (size_t i = 0; i < n; i++) {
+            size_t at = mu_store_search(large, LARGE_COUNT, sizeof(uint32_t),
+                                        compare_u32, &small[i]);
+            if (at < LARGE_COUNT && large[at] == small[i]) {
+                out[search_count++] = small[i];
+            }
+        }
+        double search_ms = now_ms() - start;
+
+        size_t generic_count, u32_count;
+        start = now_ms();
+        mu_store_set_intersection(small, n, large, LARGE_COUNT,
+                                  sizeof(uint32_t), compare_u32, out,
+                                  LARGE_COUNT, &generic_count);
+        double generic_ms = now_ms() - start;
+
+        start = now_ms();
+        mu_store_set_intersection_u32(small, n, large, LARGE_COUNT, out,
+                                      LARGE_COUNT, &u32_count);
+        double u32_ms = now_ms() - start;
+
+        if (generic_count != search_count || u32_count != search_count) {
+            fprintf(stderr, "result mismatch\n");
+            return 1;
+        }
+        printf("%10u %10zu %12.2f %12.2f %12.2f\n", LARGE_COUNT, n, search_ms,
+               generic_ms, u32_ms);
+    }
+
+    free(large);
+    free(small);
+    free(out);
+    return 0;
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t ua = *(const uint32_t *)a;
+    uint32_t ub = *(const uint32_t *)b;
+    return (ua > ub) - (ua < ub);
+}
+
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e3 + (double)ts.tv_nsec / 1e6;
+}
+
+/**
+ * @brief Fill `ids` with an ascending sequence whose gaps are random in
+ * [1, 2 * stride), so about half of the ids of two such arrays coincide
+ * when their strides match.
+ */
+static void fill_sorted(uint32_t *ids, size_t count, uint32_t stride,
+                        uint32_t seed) {
+    uint32_t id = 0;
+    uint32_t x = seed * 2654435761u;
+    for (size_t i = 0; i < count; i++) {
+        // xorshift32
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        id += 1 + x % (2 * stride - 1);
+        ids[i] = id;
+    }
+}
+
+// *****************************************************************************
+// End of file
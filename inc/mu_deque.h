@@ -0,0 +1,358 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_deque.h
+ * @brief A fixed-size double-ended queue using user-supplied backing store.
+ *
+ * Items of arbitrary size can be added and removed at either end in O(1),
+ * and any item can be reached by position in O(1).  The ring layout, the
+ * masked mode for power-of-two capacities and the zero-copy reserve/commit
+ * calls follow mu_queue.
+ */
+
+#ifndef MU_DEQUE_H
+#define MU_DEQUE_H
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store.h" // For mu_store_err_t
+#include <stdbool.h>  // For bool
+#include <stddef.h>   // For size_t
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types
+
+/**
+ * @brief Error codes for deque operations.
+ *
+ * Aliases mu_store error codes for consistency.
+ */
+typedef mu_store_err_t mu_deque_err_t;
+
+/**
+ * @brief Structure representing a double-ended queue of arbitrary-sized
+ * items.
+ *
+ * The items occupy the slots from `head` (the front) up to but not including
+ * `tail` (one past the back), wrapping at the end of the backing store.
+ *
+ * As with mu_queue_t, a power-of-two capacity (greater than 1) selects a
+ * masked mode in which `head` and `tail` are free-running counters whose low
+ * bits (`& mask`) select the slot and `count` is not maintained.  Other
+ * capacities keep `head` and `tail` in [0..capacity) and track `count`.  Use
+ * mu_deque_count() rather than reading `count` directly.
+ */
+typedef struct {
+    void *items;      /**< Pointer to user-supplied backing store */
+    size_t capacity;  /**< Maximum number of items */
+    size_t count;     /**< Current number of items (unused in masked mode) */
+    size_t item_size; /**< Size of an item in bytes */
+    size_t head;      /**< Index of the front item (circular) */
+    size_t tail;      /**< Index one past the back item (circular) */
+    size_t mask;      /**< capacity - 1 in masked mode, else 0 */
+} mu_deque_t;
+
+// *****************************************************************************
+// Public function prototypes
+
+/**
+ * @brief Initializes a deque with a given storage array.
+ *
+ * The `backing_store` must be a preallocated contiguous block of memory
+ * with a size of at least `n_items * item_size` bytes.  A power-of-two
+ * `n_items` selects the masked mode described in mu_deque_t.
+ *
+ * @param d Pointer to the deque structure to initialize.
+ * @param backing_store Preallocated storage array for item data.
+ * @param n_items Maximum number of elements the `backing_store` can hold.
+ * @param item_size Size of one item in bytes. Must be greater than 0.
+ * @return Pointer to the initialized deque structure, or NULL on failure
+ * (e.g., d is NULL, backing_store is NULL, n_items is 0, or item_size is 0).
+ */
+mu_deque_t *mu_deque_init(mu_deque_t *d, void *backing_store, size_t n_items,
+                          size_t item_size);
+
+/**
+ * @brief Gets the maximum number of items the deque can hold.
+ * @param d Pointer to the deque structure.
+ * @return The deque's capacity, or 0 if d is NULL.
+ */
+size_t mu_deque_capacity(const mu_deque_t *d);
+
+/**
+ * @brief Gets the current number of items in the deque.
+ * @param d Pointer to the deque structure.
+ * @return The deque's current item count, or 0 if d is NULL.
+ */
+size_t mu_deque_count(const mu_deque_t *d);
+
+/**
+ * @brief Checks if the deque is empty.
+ * @param d Pointer to the deque structure.
+ * @return true if the deque contains no items or d is NULL, false otherwise.
+ */
+bool mu_deque_is_empty(const mu_deque_t *d);
+
+/**
+ * @brief Checks if the deque is full.
+ * @param d Pointer to the deque structure.
+ * @return true if the deque has reached its capacity or d is NULL, false
+ * otherwise.
+ */
+bool mu_deque_is_full(const mu_deque_t *d);
+
+/**
+ * @brief Removes all items from the deque.
+ * Does not modify the content of the backing store.
+ * @param d Pointer to the deque structure.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if d is NULL.
+ */
+mu_deque_err_t mu_deque_clear(mu_deque_t *d);
+
+/**
+ * @brief Adds an item at the back of the deque.
+ *
+ * @param d Pointer to the deque structure.
+ * @param item_in Pointer to the item data to copy in. Must be non-NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if d or item_in is
+ * NULL, MU_STORE_ERR_FULL if the deque is already at capacity.
+ */
+mu_deque_err_t mu_deque_push_back(mu_deque_t *d, const void *item_in);
+
+/**
+ * @brief Adds an item at the front of the deque.
+ *
+ * @param d Pointer to the deque structure.
+ * @param item_in Pointer to the item data to copy in. Must be non-NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if d or item_in is
+ * NULL, MU_STORE_ERR_FULL if the deque is already at capacity.
+ */
+mu_deque_err_t mu_deque_push_front(mu_deque_t *d, const void *item_in);
+
+/**
+ * @brief Removes the item at the front of the deque.
+ *
+ * @param d Pointer to the deque structure.
+ * @param[out] item_out Receives a copy of the removed item. Can be NULL if
+ * the caller doesn't need the item data.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if d is NULL,
+ * MU_STORE_ERR_EMPTY if the deque is empty.
+ */
+mu_deque_err_t mu_deque_pop_front(mu_deque_t *d, void *item_out);
+
+/**
+ * @brief Removes the item at the back of the deque.
+ *
+ * @param d Pointer to the deque structure.
+ * @param[out] item_out Receives a copy of the removed item. Can be NULL if
+ * the caller doesn't need the item data.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if d is NULL,
+ * MU_STORE_ERR_EMPTY if the deque is empty.
+ */
+mu_deque_err_t mu_deque_pop_back(mu_deque_t *d, void *item_out);
+
+/**
+ * @brief Returns the address of the item at position `index`, counting from
+ * the front.
+ *
+ * The item may be read or modified in place.  The pointer remains valid
+ * until the item is removed.
+ *
+ * @param d Pointer to the deque structure.
+ * @param index Position of the item; 0 is the front, count - 1 the back.
+ * @return Pointer to the item, or NULL if d is NULL or index >= count.
+ */
+void *mu_deque_at(const mu_deque_t *d, size_t index);
+
+/**
+ * @brief Returns the address of the front item, or NULL if d is NULL or the
+ * deque is empty.
+ */
+void *mu_deque_front(const mu_deque_t *d);
+
+/**
+ * @brief Returns the address of the back item, or NULL if d is NULL or the
+ * deque is empty.
+ */
+void *mu_deque_back(const mu_deque_t *d);
+
+// *****************************************************************************
+// Batched operations
+//
+// Each call moves as many items as fit (or as are present) with at most two
+// memcpy calls, one on each side of the end of the backing store, and
+// returns the number of items transferred (0 if a required pointer is NULL).
+// Batches keep their order: after push_front_n, items[0] is the front, and
+// pop_back_n stores the removed items front-to-back.
+
+/**
+ * @brief Adds up to `n` items at the back of the deque.
+ *
+ * @param d Pointer to the deque structure.
+ * @param items_in Pointer to `n` contiguous items.
+ * @param n Number of items to add.
+ * @return The number of items added.
+ */
+size_t mu_deque_push_back_n(mu_deque_t *d, const void *items_in, size_t n);
+
+/**
+ * @brief Adds up to `n` items at the front of the deque.  If fewer than `n`
+ * fit, the leading items of `items_in` are added.
+ *
+ * @param d Pointer to the deque structure.
+ * @param items_in Pointer to `n` contiguous items.
+ * @param n Number of items to add.
+ * @return The number of items added.
+ */
+size_t mu_deque_push_front_n(mu_deque_t *d, const void *items_in, size_t n);
+
+/**
+ * @brief Removes up to `n` items from the front of the deque.
+ *
+ * @param d Pointer to the deque structure.
+ * @param[out] items_out Buffer for `n` items, or NULL to discard them.
+ * @param n Maximum number of items to remove.
+ * @return The number of items removed.
+ */
+size_t mu_deque_pop_front_n(mu_deque_t *d, void *items_out, size_t n);
+
+/**
+ * @brief Removes up to `n` items from the back of the deque.
+ *
+ * @param d Pointer to the deque structure.
+ * @param[out] items_out Buffer for `n` items, or NULL to discard them.
+ * @param n Maximum number of items to remove.
+ * @return The number of items removed.
+ */
+size_t mu_deque_pop_back_n(mu_deque_t *d, void *items_out, size_t n);
+
+// *****************************************************************************
+// Zero-copy access
+//
+// As in mu_queue, items can be built in the backing store and published
+// afterwards, or used in place and released without a copy.  A span never
+// crosses the end of the backing store, so it may be shorter than requested
+// even when more slots are available.
+
+/**
+ * @brief Returns the free slot just past the back, without adding it.
+ * @return Pointer to the slot, or NULL if d is NULL or the deque is full.
+ */
+void *mu_deque_reserve_back(mu_deque_t *d);
+
+/**
+ * @brief Returns up to `n` contiguous free slots past the back.
+ *
+ * @param d Pointer to the deque structure.
+ * @param n Maximum number of slots wanted.
+ * @param[out] n_reserved Receives the number of slots in the span (0 if
+ * none). Must be non-NULL.
+ * @return Pointer to the first slot of the span, or NULL if none.
+ */
+void *mu_deque_reserve_back_span(mu_deque_t *d, size_t n, size_t *n_reserved);
+
+/**
+ * @brief Adds the `n` slots past the back, written through
+ * mu_deque_reserve_back() or mu_deque_reserve_back_span(), to the deque.
+ *
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if d is NULL,
+ * MU_STORE_ERR_FULL (and no change) if fewer than `n` slots are free.
+ */
+mu_deque_err_t mu_deque_commit_back(mu_deque_t *d, size_t n);
+
+/**
+ * @brief Returns the free slot just before the front, without adding it.
+ * @return Pointer to the slot, or NULL if d is NULL or the deque is full.
+ */
+void *mu_deque_reserve_front(mu_deque_t *d);
+
+/**
+ * @brief Returns up to `n` contiguous free slots before the front.
+ *
+ * The span ends just before the current front item, so its last slot
+ * becomes the one adjacent to the front.
+ *
+ * @param d Pointer to the deque structure.
+ * @param n Maximum number of slots wanted.
+ * @param[out] n_reserved Receives the number of slots in the span (0 if
+ * none). Must be non-NULL.
+ * @return Pointer to the first (lowest addressed) slot of the span, or NULL
+ * if none.
+ */
+void *mu_deque_reserve_front_span(mu_deque_t *d, size_t n,
+                                  size_t *n_reserved);
+
+/**
+ * @brief Adds the `n` slots before the front, written through
+ * mu_deque_reserve_front() or mu_deque_reserve_front_span(), to the deque.
+ *
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if d is NULL,
+ * MU_STORE_ERR_FULL (and no change) if fewer than `n` slots are free.
+ */
+mu_deque_err_t mu_deque_commit_front(mu_deque_t *d, size_t n);
+
+/**
+ * @brief Returns up to `n` contiguous items starting at the front.
+ *
+ * @param d Pointer to the deque structure.
+ * @param n Maximum number of items wanted.
+ * @param[out] n_read Receives the number of items in the span (0 if none).
+ * Must be non-NULL.
+ * @return Pointer to the front item, or NULL if none.
+ */
+void *mu_deque_read_span(mu_deque_t *d, size_t n, size_t *n_read);
+
+/**
+ * @brief Removes `n` items from the front without copying them.
+ *
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if d is NULL,
+ * MU_STORE_ERR_EMPTY (and no change) if fewer than `n` items are present.
+ */
+mu_deque_err_t mu_deque_release_front(mu_deque_t *d, size_t n);
+
+/**
+ * @brief Removes `n` items from the back without copying them.
+ *
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if d is NULL,
+ * MU_STORE_ERR_EMPTY (and no change) if fewer than `n` items are present.
+ */
+mu_deque_err_t mu_deque_release_back(mu_deque_t *d, size_t n);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MU_DEQUE_H */
@@ -0,0 +1,186 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_index.h
+ *
+ * @brief mu_index is a read-optimized search accelerator for sorted arrays.
+ *
+ * An index holds a copy of a sorted array's items rearranged in Eytzinger
+ * (breadth-first) order: the root of the implicit search tree first, then its
+ * two children, then their four children, and so on.  Searching walks down
+ * the tree with a branch-free step, and the first few levels - which every
+ * search touches - share a handful of cache lines.  Descendants a few levels
+ * ahead are prefetched while the current comparison is in flight.
+ *
+ * Searches return exactly the index that mu_store_search() (or
+ * mu_store_psearch()) would return on the original sorted array, so the
+ * result can be used directly with the mu_vec / mu_pvec the index was built
+ * from.  The index is a snapshot: rebuild it whenever the source changes.
+ */
+
+#ifndef _MU_INDEX_H_
+#define _MU_INDEX_H_
+
+// *****************************************************************************
+// Includes
+
+#include "mu_pvec.h"
+#include "mu_store.h"
+#include "mu_vec.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Eytzinger-ordered search index over a sorted array.
+ *
+ * Manages up to `capacity` item copies in user-provided storage.
+ */
+typedef struct {
+    void *item_store;        /**< Items in Eytzinger order (size = capacity) */
+    size_t item_size;        /**< Size of each item in bytes */
+    size_t capacity;         /**< Maximum number of items */
+    size_t count;            /**< Number of items in the current snapshot */
+    unsigned height;         /**< Depth of the deepest tree level */
+    size_t last_level_count; /**< Number of nodes on the deepest level */
+    unsigned prefetch_shift; /**< Levels ahead to prefetch while descending */
+} mu_index_t;
+
+/**
+ * @brief Create mu_index aliases for the generic mu_store typedefs
+ */
+typedef mu_store_err_t mu_index_err_t;
+typedef mu_store_compare_fn mu_index_compare_fn;
+
+// *****************************************************************************
+// Public declarations
+
+/**
+ * @brief Initialize an index.
+ *
+ * @param ix         Pointer to the index structure. Must not be NULL.
+ * @param item_store User-provided storage for `capacity` items of
+ *                   `item_size` bytes. Must not be NULL.
+ * @param capacity   Maximum number of items (>0).
+ * @param item_size  Size of each item in bytes (>0).
+ * @return           `ix` on success, NULL on invalid parameters.
+ */
+mu_index_t *mu_index_init(mu_index_t *ix, void *item_store, size_t capacity,
+                          size_t item_size);
+
+/**
+ * @brief Get the number of items in the current snapshot.
+ * @param ix Pointer to the index.
+ * @return   Number of items, or 0 if `ix` is NULL.
+ */
+size_t mu_index_count(const mu_index_t *ix);
+
+/**
+ * @brief Build the index from a sorted array of items.
+ *
+ * @param ix     Pointer to the index. Must not be NULL.
+ * @param sorted Array of `count` items of `ix->item_size` bytes, sorted in
+ *               the order the searches will assume. May be NULL only if
+ *               `count` is 0.
+ * @param count  Number of items in `sorted`.
+ * @return       MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM if `ix` or `sorted` is
+ *               NULL, MU_STORE_ERR_FULL if `count` exceeds the capacity.
+ */
+mu_index_err_t mu_index_build(mu_index_t *ix, const void *sorted,
+                              size_t count);
+
+/**
+ * @brief Build the index from a sorted vector.
+ *
+ * @param ix Pointer to the index. Must not be NULL.
+ * @param v  Sorted vector whose item size matches the index. Must not be NULL.
+ * @return   MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM on NULL arguments or an
+ *           item size mismatch, MU_STORE_ERR_FULL if `v` holds more items
+ *           than the index can.
+ */
+mu_index_err_t mu_index_build_vec(mu_index_t *ix, const mu_vec_t *v);
+
+/**
+ * @brief Build the index from a sorted pointer vector.
+ *
+ * The index must have been initialized with `item_size == sizeof(void *)`.
+ *
+ * @param ix Pointer to the index. Must not be NULL.
+ * @param v  Sorted pointer vector. Must not be NULL.
+ * @return   MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM on NULL arguments or an
+ *           item size mismatch, MU_STORE_ERR_FULL if `v` holds more items
+ *           than the index can.
+ */
+mu_index_err_t mu_index_build_pvec(mu_index_t *ix, const mu_pvec_t *v);
+
+/**
+ * @brief Find the insertion index for an item in the indexed array.
+ *
+ * Returns the smallest index `i` in [0..count] of the original sorted array
+ * such that `compare_fn(item, &sorted[i]) <= 0`, i.e. the same value as
+ * mu_store_search() on that array.  As with mu_store_search(),
+ * `compare_fn` receives `item` and the address of a stored item; for an
+ * index built from a mu_pvec that is the address of a pointer slot.
+ *
+ * @param ix         Pointer to the index. Must not be NULL.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @param item       The item to search for.
+ * @return           Insertion index in [0..count].
+ */
+size_t mu_index_search(const mu_index_t *ix, mu_index_compare_fn compare_fn,
+                       const void *item);
+
+/**
+ * @brief Find the insertion index for an item in an indexed pointer array.
+ *
+ * Pointer counterpart of mu_index_search(): `compare_fn` receives `item` and
+ * the stored pointer itself, and the result equals mu_store_psearch() on the
+ * original array.  The index must hold pointers.
+ *
+ * @param ix         Pointer to the index. Must not be NULL.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @param item       The item to search for.
+ * @return           Insertion index in [0..count].
+ */
+size_t mu_index_psearch(const mu_index_t *ix, mu_index_compare_fn compare_fn,
+                        const void *item);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MU_INDEX_H_ */
@@ -56,14 +56,19 @@ typedef mu_store_err_t mu_pqueue_err_t;
  *
  * The user must allocate an instance of this struct and provide a backing
  * store (an array of void* pointers).
+ *
+ * As with mu_queue_t, a power-of-two capacity (greater than 1) selects a
+ * masked mode with free-running `head` and `tail` and no `count` upkeep.
+ * Use mu_pqueue_count() rather than reading `count` directly.
  */
 typedef struct {
     void *
         *items; /**< Pointer to user-supplied backing store (array of void*) */
     size_t capacity; /**< Maximum number of items */
-    size_t count;    /**< Current number of items */
+    size_t count;    /**< Current number of items (unused in masked mode) */
     size_t head;     /**< Index of the next item to get (circular) */
     size_t tail;     /**< Index where the next item will be put (circular) */
+    size_t mask;     /**< capacity - 1 in masked mode, else 0 */
 } mu_pqueue_t;
 
 /**
@@ -85,7 +90,8 @@ typedef mu_store_err_t mu_pqueue_err_t;
  * @brief Initializes a pointer queue with a given storage array.
  *
  * The `backing_store` must be a preallocated array of `void*` pointers
- * with a size of at least `n_items * sizeof(void*)` bytes.
+ * with a size of at least `n_items * sizeof(void*)` bytes.  A power-of-two
+ * `n_items` selects the masked mode described in mu_pqueue_t.
  *
  * @param q Pointer to the pointer queue structure to initialize.
  * @param backing_store Preallocated array of void* pointers.
@@ -144,6 +150,24 @@ mu_pqueue_err_t mu_pqueue_clear(mu_pqueue_t *q);
 mu_pqueue_err_t mu_pqueue_put(mu_pqueue_t *q,
                               void *item_in); // Note: item_in is void* here
 
+/**
+ * @brief Adds a pointer to the tail of the pointer queue, evicting the
+ * oldest pointer if the queue is full.
+ *
+ * Keeps the newest `capacity` pointers at constant cost: when full, head and
+ * tail advance together instead of the put failing.
+ *
+ * @param q Pointer to the pointer queue structure.
+ * @param item_in The void* pointer to put into the queue.
+ * @param[out] evicted_out If non-NULL, receives the evicted pointer. Left
+ * unchanged if nothing was evicted.
+ * @param[out] evicted If non-NULL, set to true if a pointer was evicted,
+ * false otherwise.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if q is NULL.
+ */
+mu_pqueue_err_t mu_pqueue_put_overwrite(mu_pqueue_t *q, void *item_in,
+                                        void **evicted_out, bool *evicted);
+
 /**
  * @brief Removes and provides the pointer-sized item from the head of the
  * pointer queue.
@@ -171,6 +195,43 @@ mu_pqueue_err_t
 mu_pqueue_peek(const mu_pqueue_t *q,
                void **item_out); // Note: item_out is void** here
 
+/**
+ * @brief Adds up to `n` pointers to the tail of the pointer queue.
+ *
+ * Copies as many pointers as fit, in order, with at most two memcpy calls
+ * (one each side of the end of the backing store).
+ *
+ * @param q Pointer to the pointer queue structure.
+ * @param items_in Array of `n` pointers. May be NULL only if `n` is 0.
+ * @param n Number of pointers to put.
+ * @return The number of pointers put: `n`, or fewer if the queue filled up;
+ * 0 if q or items_in is NULL.
+ */
+size_t mu_pqueue_put_n(mu_pqueue_t *q, void *const *items_in, size_t n);
+
+/**
+ * @brief Removes up to `n` pointers from the head of the pointer queue.
+ *
+ * @param q Pointer to the pointer queue structure.
+ * @param[out] items_out Array for `n` pointers. Can be NULL if the caller
+ * doesn't need them.
+ * @param n Maximum number of pointers to get.
+ * @return The number of pointers removed: `n`, or fewer if the queue ran
+ * empty; 0 if q is NULL.
+ */
+size_t mu_pqueue_get_n(mu_pqueue_t *q, void **items_out, size_t n);
+
+/**
+ * @brief Copies up to `n` pointers from the head of the pointer queue
+ * without removing them.
+ *
+ * @param q Pointer to the pointer queue structure.
+ * @param[out] items_out Array for `n` pointers. Must be non-NULL.
+ * @param n Maximum number of pointers to copy.
+ * @return The number of pointers copied; 0 if q or items_out is NULL.
+ */
+size_t mu_pqueue_peek_n(const mu_pqueue_t *q, void **items_out, size_t n);
+
 // *****************************************************************************
 // End of file
 
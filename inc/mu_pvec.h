@@ -35,6 +35,7 @@
 // Includes
 
 #include "mu_store.h"
+#include "mu_vec.h"
 #include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -153,6 +154,43 @@ mu_pvec_err_t mu_pvec_insert(mu_pvec_t *v, size_t index, const void *item);
  */
 mu_pvec_err_t mu_pvec_delete(mu_pvec_t *v, size_t index, void **item_out);
 
+/**
+ * @brief Delete an item at `index` by moving the last pointer into its place.
+ *
+ * Constant time regardless of the vector's size, but does not preserve the
+ * order of the remaining pointers.
+ *
+ * @param v         Pointer to the vector. Must not be NULL.
+ * @param index     Position [0..count-1].
+ * @param item_out  Optional address to receive the removed pointer; may be
+ * NULL.
+ * @return          MU_STORE_ERR_NONE,
+ *                  MU_STORE_ERR_PARAM if `v` is NULL,
+ *                  MU_STORE_ERR_INDEX if `index >= count`.
+ */
+mu_pvec_err_t mu_pvec_swap_remove(mu_pvec_t *v, size_t index,
+                                  void **item_out);
+
+/**
+ * @brief Swap-remove the pointers at several indices in one pass.
+ *
+ * See mu_vec_swap_remove_indices().
+ *
+ * @param v         Pointer to the vector. Must not be NULL.
+ * @param indices   Strictly ascending positions in [0..count-1]; may be NULL
+ *                  only if `n` is 0.
+ * @param n         Number of indices.
+ * @param items_out Optional array of `n` pointers receiving the removed
+ *                  pointers in the order of `indices`; may be NULL.
+ * @return          MU_STORE_ERR_NONE,
+ *                  MU_STORE_ERR_PARAM if `v` is NULL, or `indices` is NULL
+ *                  and `n` is not 0,
+ *                  MU_STORE_ERR_INDEX if `indices` is out of range or not
+ *                  strictly ascending (the vector is left unchanged).
+ */
+mu_pvec_err_t mu_pvec_swap_remove_indices(mu_pvec_t *v, const size_t *indices,
+                                          size_t n, void **items_out);
+
 /**
  * @brief Replace the item at `index` with a new pointer.
  * @param v     Pointer to the vector. Must not be NULL.
@@ -205,6 +243,91 @@ mu_pvec_err_t mu_pvec_pop(mu_pvec_t *v, void **item_out);
  */
 mu_pvec_err_t mu_pvec_peek(const mu_pvec_t *v, void **item_out);
 
+/**
+ * @brief Append `n` pointers copied from an array.
+ *
+ * All or nothing: if the pointers do not all fit, nothing is appended.
+ *
+ * @param v      Pointer to the vector. Must not be NULL.
+ * @param items  Array of `n` pointers; may be NULL only if `n` is 0.
+ * @param n      Number of pointers to append.
+ * @return       MU_STORE_ERR_NONE,
+ *               MU_STORE_ERR_PARAM if `v` (or `items` with n > 0) is NULL,
+ *               MU_STORE_ERR_FULL if `count + n > capacity`.
+ */
+mu_pvec_err_t mu_pvec_push_n(mu_pvec_t *v, void *const *items, size_t n);
+
+/**
+ * @brief Insert `n` pointers at `index`, shifting later elements right once.
+ *
+ * See mu_vec_insert_range().
+ *
+ * @param v      Pointer to the vector. Must not be NULL.
+ * @param index  Position [0..count] of the first inserted pointer.
+ * @param items  Array of `n` pointers; may be NULL only if `n` is 0.  Must not
+ *               overlap the vector's storage.
+ * @param n      Number of pointers to insert.
+ * @return       MU_STORE_ERR_NONE,
+ *               MU_STORE_ERR_PARAM if `v` (or `items` with n > 0) is NULL,
+ *               MU_STORE_ERR_INDEX if `index > count`,
+ *               MU_STORE_ERR_FULL if `count + n > capacity`.
+ */
+mu_pvec_err_t mu_pvec_insert_range(mu_pvec_t *v, size_t index,
+                                   void *const *items, size_t n);
+
+/**
+ * @brief Delete the `n` pointers starting at `index`, shifting later
+ * elements left once.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param index      Position of the first pointer to delete.
+ * @param n          Number of pointers to delete.
+ * @param items_out  Optional array of at least `n` pointers to receive the
+ *                   deleted pointers; may be NULL.
+ * @return           MU_STORE_ERR_NONE,
+ *                   MU_STORE_ERR_PARAM if `v` is NULL,
+ *                   MU_STORE_ERR_INDEX if `index + n > count`.
+ */
+mu_pvec_err_t mu_pvec_delete_range(mu_pvec_t *v, size_t index, size_t n,
+                                   void **items_out);
+
+/**
+ * @brief Replace the `n_old` pointers starting at `index` with `n_new`
+ * pointers.
+ *
+ * See mu_vec_replace_range().
+ *
+ * @param v      Pointer to the vector. Must not be NULL.
+ * @param index  Position of the first pointer to replace.
+ * @param n_old  Number of existing pointers to remove.
+ * @param items  Array of `n_new` pointers; may be NULL only if `n_new` is 0.
+ *               Must not overlap the vector's storage.
+ * @param n_new  Number of pointers to put in their place.
+ * @return       MU_STORE_ERR_NONE,
+ *               MU_STORE_ERR_PARAM if `v` (or `items` with n_new > 0) is
+ *               NULL,
+ *               MU_STORE_ERR_INDEX if `index + n_old > count`,
+ *               MU_STORE_ERR_FULL if the result exceeds the capacity.
+ */
+mu_pvec_err_t mu_pvec_replace_range(mu_pvec_t *v, size_t index, size_t n_old,
+                                    void *const *items, size_t n_new);
+
+/**
+ * @brief Copy the `n` pointers starting at `index` into an array.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param index      Position of the first pointer to copy.
+ * @param n          Number of pointers to copy.
+ * @param items_out  Array of at least `n` pointers; may be NULL only if `n`
+ *                   is 0.
+ * @return           MU_STORE_ERR_NONE,
+ *                   MU_STORE_ERR_PARAM if `v` (or `items_out` with n > 0) is
+ *                   NULL,
+ *                   MU_STORE_ERR_INDEX if `index + n > count`.
+ */
+mu_pvec_err_t mu_pvec_copy_out_range(const mu_pvec_t *v, size_t index,
+                                     size_t n, void **items_out);
+
 /**
  * @brief Find the first index matching `find_fn(item,arg) == true`.
  * @param v         Pointer to the vector. Must not be NULL.
@@ -231,6 +354,133 @@ mu_pvec_err_t mu_pvec_find(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
 mu_pvec_err_t mu_pvec_rfind(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
                             const void *arg, size_t *index_out);
 
+/**
+ * @brief Find the first index at or after `start` matching
+ * `find_fn(item,arg) == true`.
+ *
+ * Resumes a search: after a match at `i`, search again from `i + 1`.
+ *
+ * @param v         Pointer to the vector. Must not be NULL.
+ * @param start     First index to test [0..count].
+ * @param find_fn   Function to test each pointer; must not be NULL.
+ * @param arg       Extra argument for `find_fn`; may be NULL.
+ * @param index_out Address to receive the found index; must not be NULL.
+ * @return          MU_STORE_ERR_NONE,
+ *                  MU_STORE_ERR_PARAM if `v`, `find_fn`, or `index_out` is
+ * NULL, MU_STORE_ERR_INDEX if `start > count`, MU_STORE_ERR_NOTFOUND if no
+ * match.
+ */
+mu_pvec_err_t mu_pvec_find_from(const mu_pvec_t *v, size_t start,
+                                mu_pvec_find_fn find_fn, const void *arg,
+                                size_t *index_out);
+
+/**
+ * @brief Collect the indices of all pointers matching
+ * `find_fn(item,arg) == true` in one pass.
+ *
+ * Equivalent to mu_pvec_find_all_from() with `start` 0.
+ *
+ * @param v           Pointer to the vector. Must not be NULL.
+ * @param find_fn     Function to test each pointer; must not be NULL.
+ * @param arg         Extra argument for `find_fn`; may be NULL.
+ * @param indices     Buffer of `max_indices` indices; may be NULL only if
+ *                    `max_indices` is 0.
+ * @param max_indices Number of indices `indices` can hold.
+ * @param n_found     Address to receive the number of indices written; must
+ *                    not be NULL.
+ * @return            MU_STORE_ERR_NONE,
+ *                    MU_STORE_ERR_PARAM if `v`, `find_fn` or `n_found` is
+ * NULL, or `indices` is NULL and `max_indices` is not 0,
+ *                    MU_STORE_ERR_FULL if there are more matches than fit.
+ */
+mu_pvec_err_t mu_pvec_find_all(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
+                               const void *arg, size_t *indices,
+                               size_t max_indices, size_t *n_found);
+
+/**
+ * @brief Collect the indices of all pointers at or after `start` matching
+ * `find_fn(item,arg) == true` in one pass.
+ *
+ * Indices are written in ascending order.  If there are more than
+ * `max_indices` matches, the first `max_indices` are written and
+ * MU_STORE_ERR_FULL is returned; the search continues by calling again with
+ * `start` one past the last index written, or with the same `start` if
+ * nothing was written (`max_indices` is 0).
+ *
+ * @param v           Pointer to the vector. Must not be NULL.
+ * @param start       First index to test [0..count].
+ * @param find_fn     Function to test each pointer; must not be NULL.
+ * @param arg         Extra argument for `find_fn`; may be NULL.
+ * @param indices     Buffer of `max_indices` indices; may be NULL only if
+ *                    `max_indices` is 0.
+ * @param max_indices Number of indices `indices` can hold.
+ * @param n_found     Address to receive the number of indices written; must
+ *                    not be NULL.
+ * @return            MU_STORE_ERR_NONE,
+ *                    MU_STORE_ERR_PARAM if `v`, `find_fn` or `n_found` is
+ * NULL, or `indices` is NULL and `max_indices` is not 0,
+ *                    MU_STORE_ERR_INDEX if `start > count`,
+ *                    MU_STORE_ERR_FULL if there are more matches than fit.
+ */
+mu_pvec_err_t mu_pvec_find_all_from(const mu_pvec_t *v, size_t start,
+                                    mu_pvec_find_fn find_fn, const void *arg,
+                                    size_t *indices, size_t max_indices,
+                                    size_t *n_found);
+
+/**
+ * @brief Append the indices of all pointers matching
+ * `find_fn(item,arg) == true` to a mu_vec of `size_t`.
+ *
+ * As mu_pvec_find_all(), writing into the free space of `out` and adding the
+ * indices written to its count.  If `out` fills up, MU_STORE_ERR_FULL is
+ * returned with the indices that fit appended; the search can be continued
+ * with mu_pvec_find_all_from() one past the last index appended, or from 0
+ * if `out` was already full.
+ *
+ * @param v       Pointer to the vector to search. Must not be NULL.
+ * @param find_fn Function to test each pointer; must not be NULL.
+ * @param arg     Extra argument for `find_fn`; may be NULL.
+ * @param out     Vector receiving the indices; must not be NULL, its
+ *                `item_size` must be `sizeof(size_t)`, and its storage must
+ *                not overlap the pointers of `v`.
+ * @return        MU_STORE_ERR_NONE,
+ *                MU_STORE_ERR_PARAM if `v`, `find_fn` or `out` is NULL, `out`
+ * does not hold `size_t` items, or its storage overlaps the pointers of `v`,
+ *                MU_STORE_ERR_FULL if there are more matches than fit.
+ */
+mu_pvec_err_t mu_pvec_find_all_vec(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
+                                   const void *arg, mu_vec_t *out);
+
+/**
+ * @brief Find the first index holding exactly the pointer `item`.
+ *
+ * Compares the stored pointers inline (see mu_store_find_eq()) rather than
+ * calling a find function per element.
+ *
+ * @param v         Pointer to the vector. Must not be NULL.
+ * @param item      Pointer value to look for; may be NULL.
+ * @param index_out Address to receive the found index; must not be NULL.
+ * @return          MU_STORE_ERR_NONE,
+ *                  MU_STORE_ERR_PARAM if `v` or `index_out` is NULL,
+ *                  MU_STORE_ERR_NOTFOUND if no match.
+ */
+mu_pvec_err_t mu_pvec_find_ptr(const mu_pvec_t *v, const void *item,
+                               size_t *index_out);
+
+/**
+ * @brief Keep only the pointers for which `keep_fn(item,arg)` is true.
+ *
+ * A single pass that tests each stored pointer once; the kept pointers keep
+ * their relative order.
+ *
+ * @param v       Pointer to the vector. Must not be NULL.
+ * @param keep_fn Function to test each pointer; must not be NULL.
+ * @param arg     Extra argument for `keep_fn`; may be NULL.
+ * @return        MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_pvec_err_t mu_pvec_retain(mu_pvec_t *v, mu_pvec_find_fn keep_fn,
+                             const void *arg);
+
 /**
  * @brief Sort the stored pointers in ascending order.
  * @param v          Pointer to the vector. Must not be NULL.
@@ -239,6 +489,112 @@ mu_pvec_err_t mu_pvec_rfind(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
  */
 mu_pvec_err_t mu_pvec_sort(mu_pvec_t *v, mu_pvec_compare_fn compare_fn);
 
+/**
+ * @brief Stable sort of the stored pointers in ascending order.
+ *
+ * Pointers whose targets compare equal keep their relative order.  See
+ * mu_store_stable_sort() for how the optional scratch buffer is used.
+ *
+ * @param v             Pointer to the vector. Must not be NULL.
+ * @param compare_fn    Comparison function; must not be NULL.
+ * @param scratch       Optional scratch array of `scratch_count` pointers;
+ *                      may be NULL.
+ * @param scratch_count Number of pointers `scratch` can hold.
+ * @return              MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_pvec_err_t mu_pvec_stable_sort(mu_pvec_t *v, mu_pvec_compare_fn compare_fn,
+                                  void **scratch, size_t scratch_count);
+
+/**
+ * @brief Sort the stored pointers by a key extracted once per item.
+ *
+ * See mu_store_psort_by_key(): each target is visited once to extract its
+ * key, and the sort runs over contiguous (key, pointer) pairs in `scratch`.
+ * A scratch buffer of `2 * count` pairs selects a stable radix sort; at
+ * least `count` pairs are required.
+ *
+ * @param v             Pointer to the vector. Must not be NULL.
+ * @param key_fn        Key extraction function; must not be NULL.
+ * @param scratch       Scratch array of `scratch_count` pairs; must not be
+ *                      NULL, even if the vector is empty.
+ * @param scratch_count Number of pairs `scratch` can hold.
+ * @return              MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_pvec_err_t mu_pvec_sort_by_key(mu_pvec_t *v, mu_store_key_fn key_fn,
+                                  mu_store_key_pair_t *scratch,
+                                  size_t scratch_count);
+
+/**
+ * @brief Place the `nth` pointer in its sorted position.
+ *
+ * See mu_store_pselect().
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param nth        Index to place; must be less than the vector's count.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_pvec_err_t mu_pvec_select(mu_pvec_t *v, size_t nth,
+                             mu_pvec_compare_fn compare_fn);
+
+/**
+ * @brief Sort the `k` smallest pointers into the front of the vector.
+ *
+ * See mu_store_partial_psort().
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param k          Number of leading pointers to sort.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_pvec_err_t mu_pvec_partial_sort(mu_pvec_t *v, size_t k,
+                                   mu_pvec_compare_fn compare_fn);
+
+/**
+ * @brief Copy the `k` smallest pointers, in order, into `out`.
+ *
+ * See mu_store_ptopk().  The vector is not modified.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param k          Maximum number of pointers to copy.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @param out        Array for `min(k, count)` pointers.
+ * @param n_out      Optional; receives the number of pointers written.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_pvec_err_t mu_pvec_topk(const mu_pvec_t *v, size_t k,
+                           mu_pvec_compare_fn compare_fn, void **out,
+                           size_t *n_out);
+
+/**
+ * @brief Compute the stable sorting permutation of the stored pointers.
+ *
+ * See mu_store_argsort().  As with mu_pvec_sort(), the comparison function
+ * receives the addresses of two pointer slots.  The vector is not modified.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @param indices    Array of `count` indices to receive the permutation.
+ * @param index_size `sizeof(uint32_t)` or `sizeof(size_t)`.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_pvec_err_t mu_pvec_argsort(const mu_pvec_t *v,
+                              mu_pvec_compare_fn compare_fn, void *indices,
+                              size_t index_size);
+
+/**
+ * @brief Reorder the stored pointers according to a permutation.
+ *
+ * See mu_store_apply_permutation().
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param perm       Permutation of [0..count).
+ * @param index_size `sizeof(uint32_t)` or `sizeof(size_t)`.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_pvec_err_t mu_pvec_apply_permutation(mu_pvec_t *v, void *perm,
+                                        size_t index_size);
+
 /**
  * @brief Reverse the order of stored pointers.
  * @param v Pointer to the vector. Must not be NULL.
@@ -248,6 +604,12 @@ mu_pvec_err_t mu_pvec_reverse(mu_pvec_t *v);
 
 /**
  * @brief Insert or update in sorted order based on policy.
+ *
+ * The vector must already be sorted according to `compare_fn`, which receives
+ * the addresses of the two pointer slots being compared (as with
+ * mu_pvec_sort()).  Matching items are located with binary searches, so every
+ * policy costs O(log n) comparisons.
+ *
  * @param v          Pointer to the vector. Must not be NULL.
  * @param item       Pointer to insert/update; may be NULL.
  * @param compare_fn Comparison function; must not be NULL.
@@ -262,6 +624,27 @@ mu_pvec_err_t mu_pvec_sorted_insert(mu_pvec_t *v, const void *item,
                                     mu_pvec_compare_fn compare_fn,
                                     mu_pvec_insert_policy_t policy);
 
+/**
+ * @brief Insert or update in sorted order, starting the search from a hint.
+ *
+ * Behaves exactly like mu_pvec_sorted_insert(), but gallops from `*hint`
+ * (see mu_store_search_from()) and stores the lower bound of `item` back in
+ * `*hint`, so that insertions near the previous one cost O(1) comparisons.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param item       Pointer to insert/update; may be NULL.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @param policy     Insertion/update policy.
+ * @param hint       In: expected position. Out: lower bound of `item` before
+ *                   the operation. Must not be NULL.
+ * @return           As mu_pvec_sorted_insert(); also MU_STORE_ERR_PARAM if
+ *                   `hint` is NULL.
+ */
+mu_pvec_err_t mu_pvec_sorted_insert_hint(mu_pvec_t *v, const void *item,
+                                         mu_pvec_compare_fn compare_fn,
+                                         mu_pvec_insert_policy_t policy,
+                                         size_t *hint);
+
 // *****************************************************************************
 // End of file
 
@@ -56,14 +56,22 @@ typedef mu_store_err_t mu_queue_err_t;
  *
  * The user must allocate an instance of this struct and provide a backing
  * store (a contiguous block of memory) to hold the actual item data.
+ *
+ * When the capacity is a power of two (greater than 1), mu_queue_init()
+ * selects a masked mode: `head` and `tail` are free-running counters whose
+ * low bits (`& mask`) select the slot, and the item count is their
+ * difference, so `count` is not maintained.  Other capacities keep `head`
+ * and `tail` in [0..capacity) and track `count`.  Use mu_queue_count()
+ * rather than reading `count` directly.
  */
 typedef struct {
     void *items;      /**< Pointer to user-supplied backing store */
     size_t capacity;  /**< Maximum number of items */
-    size_t count;     /**< Current number of items */
+    size_t count;     /**< Current number of items (unused in masked mode) */
     size_t item_size; /**< Size of an item in bytes */
     size_t head;      /**< Index of the next item to get (circular) */
     size_t tail;      /**< Index where the next item will be put (circular) */
+    size_t mask;      /**< capacity - 1 in masked mode, else 0 */
 } mu_queue_t;
 
 /**
@@ -85,7 +93,9 @@ typedef mu_store_err_t mu_queue_err_t;
  * @brief Initializes a generic queue with a given storage array.
  *
  * The `backing_store` must be a preallocated contiguous block of memory
- * with a size of at least `n_items * item_size` bytes.
+ * with a size of at least `n_items * item_size` bytes.  A power-of-two
+ * `n_items` selects the masked mode described in mu_queue_t, which avoids
+ * the wrap-around test on every operation.
  *
  * @param q Pointer to the queue structure to initialize.
  * @param backing_store Preallocated storage array for item data.
@@ -144,6 +154,27 @@ mu_queue_err_t mu_queue_clear(mu_queue_t *q);
  */
 mu_queue_err_t mu_queue_put(mu_queue_t *q, const void *item_in);
 
+/**
+ * @brief Adds an item to the tail of the generic queue, evicting the oldest
+ * item if the queue is full.
+ *
+ * Keeps the newest `capacity` items at constant cost, as for a trace or
+ * flight-recorder buffer: when full, head and tail advance together instead
+ * of the put failing.
+ *
+ * @param q Pointer to the generic queue structure.
+ * @param item_in Pointer to the item data to copy into the queue. Must be
+ * non-NULL.
+ * @param[out] evicted_out If non-NULL, receives a copy of the evicted item.
+ * Left unchanged if nothing was evicted.
+ * @param[out] evicted If non-NULL, set to true if an item was evicted, false
+ * otherwise.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if q or item_in
+ * is NULL.
+ */
+mu_queue_err_t mu_queue_put_overwrite(mu_queue_t *q, const void *item_in,
+                                      void *evicted_out, bool *evicted);
+
 /**
  * @brief Removes and copies the item from the head of the generic queue.
  *
@@ -169,6 +200,123 @@ mu_queue_err_t mu_queue_get(mu_queue_t *q, void *item_out);
  */
 mu_queue_err_t mu_queue_peek(const mu_queue_t *q, void *item_out);
 
+/**
+ * @brief Adds up to `n` items to the tail of the generic queue.
+ *
+ * Copies as many items as fit, in order, with at most two memcpy calls (one
+ * each side of the end of the backing store).
+ *
+ * @param q Pointer to the generic queue structure.
+ * @param items_in Pointer to `n` contiguous items. May be NULL only if `n`
+ * is 0.
+ * @param n Number of items to put.
+ * @return The number of items put: `n`, or fewer if the queue filled up; 0
+ * if q or items_in is NULL.
+ */
+size_t mu_queue_put_n(mu_queue_t *q, const void *items_in, size_t n);
+
+/**
+ * @brief Removes up to `n` items from the head of the generic queue.
+ *
+ * Copies with at most two memcpy calls, as mu_queue_put_n().
+ *
+ * @param q Pointer to the generic queue structure.
+ * @param[out] items_out Buffer for `n` items. Can be NULL if the caller
+ * doesn't need the item data.
+ * @param n Maximum number of items to get.
+ * @return The number of items removed: `n`, or fewer if the queue ran empty;
+ * 0 if q is NULL.
+ */
+size_t mu_queue_get_n(mu_queue_t *q, void *items_out, size_t n);
+
+/**
+ * @brief Copies up to `n` items from the head of the generic queue without
+ * removing them.
+ *
+ * @param q Pointer to the generic queue structure.
+ * @param[out] items_out Buffer for `n` items. Must be non-NULL.
+ * @param n Maximum number of items to copy.
+ * @return The number of items copied; 0 if q or items_out is NULL.
+ */
+size_t mu_queue_peek_n(const mu_queue_t *q, void *items_out, size_t n);
+
+// *****************************************************************************
+// Zero-copy access
+//
+// A producer may build items directly in the backing store: mu_queue_reserve()
+// or mu_queue_reserve_span() returns free slots at the tail, and
+// mu_queue_commit() publishes them.  A consumer may likewise use items in
+// place: mu_queue_front() or mu_queue_read_span() returns filled slots at the
+// head, and mu_queue_release() frees them.  A span never crosses the end of
+// the backing store, so it may be shorter than requested even when more
+// slots are available; call again after committing or releasing it.
+// Pointers remain valid until the slots are committed or released.
+
+/**
+ * @brief Returns the slot where the next item will be put, without adding it.
+ *
+ * @param q Pointer to the generic queue structure.
+ * @return Pointer to `item_size` writable bytes, or NULL if q is NULL or the
+ * queue is full.
+ */
+void *mu_queue_reserve(mu_queue_t *q);
+
+/**
+ * @brief Returns up to `n` contiguous free slots at the tail of the queue.
+ *
+ * @param q Pointer to the generic queue structure.
+ * @param n Maximum number of slots wanted.
+ * @param[out] n_reserved Receives the number of slots in the span (0 if
+ * none). Must be non-NULL.
+ * @return Pointer to the first slot of the span, or NULL if q or n_reserved
+ * is NULL, or no slots are available.
+ */
+void *mu_queue_reserve_span(mu_queue_t *q, size_t n, size_t *n_reserved);
+
+/**
+ * @brief Adds `n` items previously written through mu_queue_reserve() or
+ * mu_queue_reserve_span() to the tail of the queue.
+ *
+ * @param q Pointer to the generic queue structure.
+ * @param n Number of reserved slots to publish.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if q is NULL,
+ * MU_STORE_ERR_FULL (and no change) if fewer than `n` slots are free.
+ */
+mu_queue_err_t mu_queue_commit(mu_queue_t *q, size_t n);
+
+/**
+ * @brief Returns the item at the head of the queue, without removing it.
+ *
+ * @param q Pointer to the generic queue structure.
+ * @return Pointer to the head item, or NULL if q is NULL or the queue is
+ * empty.
+ */
+void *mu_queue_front(mu_queue_t *q);
+
+/**
+ * @brief Returns up to `n` contiguous items at the head of the queue.
+ *
+ * @param q Pointer to the generic queue structure.
+ * @param n Maximum number of items wanted.
+ * @param[out] n_read Receives the number of items in the span (0 if none).
+ * Must be non-NULL.
+ * @return Pointer to the first item of the span, or NULL if q or n_read is
+ * NULL, or the queue is empty.
+ */
+void *mu_queue_read_span(mu_queue_t *q, size_t n, size_t *n_read);
+
+/**
+ * @brief Removes `n` items from the head of the queue without copying them,
+ * typically after using them through mu_queue_front() or
+ * mu_queue_read_span().
+ *
+ * @param q Pointer to the generic queue structure.
+ * @param n Number of items to remove.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if q is NULL,
+ * MU_STORE_ERR_EMPTY (and no change) if fewer than `n` items are queued.
+ */
+mu_queue_err_t mu_queue_release(mu_queue_t *q, size_t n);
+
 // *****************************************************************************
 // End of file
 
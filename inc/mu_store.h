@@ -36,6 +36,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 // *****************************************************************************
 // C++ Compatibility
@@ -103,6 +104,42 @@ typedef int (*mu_store_compare_fn)(const void *a, const void *b);
  */
 typedef bool (*mu_store_find_fn)(const void *item, const void *arg);
 
+/**
+ * @brief Signature for key extraction, used by mu_store_psort_by_key()
+ *
+ * Keys are compared as unsigned integers.  Map other key types to an
+ * order-preserving unsigned value, e.g. `(uint64_t)x ^ (UINT64_C(1) << 63)`
+ * for a signed 64-bit `x`.
+ *
+ * @param item Item to examine (the stored pointer, not its slot)
+ * @return The item's sort key
+ */
+typedef uint64_t (*mu_store_key_fn)(const void *item);
+
+/**
+ * @brief A cached sort key and the pointer it was extracted from.
+ *
+ * Scratch element type for mu_store_psort_by_key().
+ */
+typedef struct {
+    uint64_t key; /**< Key returned by the mu_store_key_fn */
+    void *ptr;    /**< Pointer the key was extracted from */
+} mu_store_key_pair_t;
+
+/**
+ * @brief Key interpretation for mu_store_radix_sort() and
+ * mu_store_interp_search()
+ *
+ * Exactly one key type (UNSIGNED, SIGNED or FLOAT) may be combined with
+ * MU_STORE_RADIX_DESCENDING.
+ */
+typedef enum {
+    MU_STORE_RADIX_UNSIGNED = 0x00, /**< Unsigned integer key */
+    MU_STORE_RADIX_SIGNED = 0x01,   /**< Two's complement signed integer key */
+    MU_STORE_RADIX_FLOAT = 0x02,    /**< IEEE 754 float (4) or double (8) key */
+    MU_STORE_RADIX_DESCENDING = 0x10, /**< Sort largest key first */
+} mu_store_radix_flags_t;
+
 // *****************************************************************************
 // Public declarations
 
@@ -170,10 +207,160 @@ size_t mu_store_psearch(const void *const *base, size_t item_count,
                         mu_store_compare_fn compare_fn, const void *item);
 
 /**
- * @brief in-place sort of an array of equally sized items using Heapsort.
+ * @brief Find the index just past the last item equal to `item` in a sorted
+ * array.
+ *
+ * The "upper bound" counterpart to mu_store_search(): returns the smallest
+ * index `i` in [0..item_count] such that `compare_fn(item, &base[i]) < 0`.
+ * Together the two calls bracket the run of items that compare equal to
+ * `item` as [mu_store_search(), mu_store_search_upper()).
+ *
+ * @param base        Pointer to the first element of the array.
+ * @param item_count  Number of elements currently in the array.
+ * @param item_size   Size in bytes of each element.
+ * @param compare_fn  Comparison function, called as
+ *                    `compare_fn(item, &base[i])`.
+ * @param item        Pointer to the value to search for.
+ * @return Index in [0..item_count] of the first element greater than `item`.
+ */
+size_t mu_store_search_upper(const void *base, size_t item_count,
+                             size_t item_size, mu_store_compare_fn compare_fn,
+                             const void *item);
+
+/**
+ * @brief Find the index just past the last pointer equal to `item` in a
+ * sorted array of pointers.
+ *
+ * The "upper bound" counterpart to mu_store_psearch(): returns the smallest
+ * index `i` in [0..item_count] such that `compare_fn(item, base[i]) < 0`.
+ *
+ * @param base         Pointer to the first element of a sorted array of
+ *                     pointers. Must not be NULL unless `item_count == 0`.
+ * @param item_count   Number of elements currently in the array.
+ * @param compare_fn   Comparison function, called as
+ *                     `compare_fn(item, base[i])`.
+ * @param item         Pointer to the element to search for.
+ * @return Index in [0..item_count] of the first element greater than `item`.
+ */
+size_t mu_store_psearch_upper(const void *const *base, size_t item_count,
+                              mu_store_compare_fn compare_fn,
+                              const void *item);
+
+/**
+ * @brief Find the insertion index for an item in a sorted array, starting
+ * from a caller-supplied guess.
+ *
+ * Returns the same index as mu_store_search(), but gallops outwards from
+ * `hint` (probing at distances 1, 3, 7, 15, ...) before finishing with a
+ * binary search.  The cost is O(log d) comparisons, where d is the distance
+ * between `hint` and the result, so a good hint (e.g. the previous result
+ * when keys arrive mostly in order) costs one or two comparisons.  A bad
+ * hint costs at most about twice a plain binary search.
+ *
+ * @param base        Pointer to the first element of the array.
+ * @param item_count  Number of elements currently in the array.
+ * @param item_size   Size in bytes of each element.
+ * @param compare_fn  Comparison function, called as
+ *                    `compare_fn(item, &base[i])`.
+ * @param item        Pointer to the value to search for.
+ * @param hint        Expected result; values above `item_count` are treated
+ *                    as `item_count`.
+ * @return Index in [0..item_count] where `item` should be inserted.
+ */
+size_t mu_store_search_from(const void *base, size_t item_count,
+                            size_t item_size, mu_store_compare_fn compare_fn,
+                            const void *item, size_t hint);
+
+/**
+ * @brief Find the insertion index for a pointer in a sorted array of
+ * pointers, starting from a caller-supplied guess.
+ *
+ * Pointer counterpart of mu_store_search_from(); returns the same index as
+ * mu_store_psearch().
+ *
+ * @param base        Pointer to the first element of a sorted array of
+ *                    pointers. Must not be NULL unless `item_count == 0`.
+ * @param item_count  Number of elements currently in the array.
+ * @param compare_fn  Comparison function, called as
+ *                    `compare_fn(item, base[i])`.
+ * @param item        Pointer to the element to search for.
+ * @param hint        Expected result; values above `item_count` are treated
+ *                    as `item_count`.
+ * @return Index in [0..item_count] where `item` should be inserted.
+ */
+size_t mu_store_psearch_from(const void *const *base, size_t item_count,
+                             mu_store_compare_fn compare_fn, const void *item,
+                             size_t hint);
+
+/**
+ * @brief Find the insertion index of each of several items in a sorted array.
+ *
+ * Equivalent to calling mu_store_search() once per query, writing
+ * `results[i] = mu_store_search(base, item_count, item_size, compare_fn,
+ * &queries[i])`, but faster for large batches:
+ *   - While the queries arrive in ascending order, each search gallops
+ *     forward from the previous result, so a sorted batch costs about one
+ *     merge pass over the touched part of the array.
+ *   - Once a query is found out of order, the remaining queries are resolved
+ *     several at a time by interleaved binary searches whose next probes are
+ *     prefetched, overlapping their cache misses.
+ *
+ * Queries are items of the same size and type as the array, since ascending
+ * order is detected with `compare_fn(&queries[i - 1], &queries[i])`.
+ *
+ * @param base        Pointer to the first element of the sorted array. May
+ *                    be NULL only if `item_count` is 0.
+ * @param item_count  Number of elements in the array.
+ * @param item_size   Size of each element (and query) in bytes.
+ * @param compare_fn  Comparison function, called as
+ *                    `compare_fn(query, &base[i])`.
+ * @param queries     Array of `query_count` items to look up.
+ * @param query_count Number of queries.
+ * @param results     Array of `query_count` indices to receive the results.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if a required
+ * pointer is NULL or item_size is 0.
+ */
+mu_store_err_t mu_store_search_many(const void *base, size_t item_count,
+                                    size_t item_size,
+                                    mu_store_compare_fn compare_fn,
+                                    const void *queries, size_t query_count,
+                                    size_t *results);
+
+/**
+ * @brief Find the insertion index of each of several items in a sorted array
+ * of pointers.
+ *
+ * Pointer counterpart of mu_store_search_many(): `results[i] =
+ * mu_store_psearch(base, item_count, compare_fn, queries[i])`.  Ascending
+ * order is detected with `compare_fn(queries[i - 1], queries[i])`.
+ *
+ * @param base        Pointer to the first element of a sorted array of
+ *                    pointers. May be NULL only if `item_count` is 0.
+ * @param item_count  Number of elements in the array.
+ * @param compare_fn  Comparison function, called as
+ *                    `compare_fn(queries[j], base[i])`.
+ * @param queries     Array of `query_count` pointers to look up.
+ * @param query_count Number of queries.
+ * @param results     Array of `query_count` indices to receive the results.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if a required
+ * pointer is NULL.
+ */
+mu_store_err_t mu_store_psearch_many(const void *const *base,
+                                     size_t item_count,
+                                     mu_store_compare_fn compare_fn,
+                                     const void *const *queries,
+                                     size_t query_count, size_t *results);
+
+/**
+ * @brief in-place sort of an array of equally sized items.
  *
  * Sorts an array of items of a fixed size (`item_size`) in ascending order
- * based on the provided comparison function. Uses the Heapsort algorithm.
+ * based on the provided comparison function.  Uses a pattern-defeating
+ * quicksort (pdqsort): insertion sort for small partitions, median-of-3 /
+ * pseudo-median-of-9 pivots, detection of already-sorted and all-equal runs,
+ * and a heapsort fallback that bounds the worst case at O(n log n).
+ *
+ * The sort is not stable.  It uses O(log n) stack and never allocates.
  *
  * @param base Pointer to the beginning of the array of items to sort. Must not
  * be NULL.
@@ -190,12 +377,12 @@ mu_store_err_t mu_store_sort(void *base, size_t item_count, size_t item_size,
 
 
 /**
- * @brief in-place sort of an array of pointer-sized items using Heapsort.
+ * @brief in-place sort of an array of pointer-sized items.
  *
  * Sorts the array of `void*` pointers in ascending order based on the
  * comparison of the values they point to, using the provided comparison
- * function. Uses the Heapsort algorithm, which is an in-place comparison
- * sort.
+ * function.  Uses the same pattern-defeating quicksort as mu_store_sort().
+ * The comparison function receives the addresses of the two pointer slots.
  *
  * @param base Pointer to the beginning of the array of `void*` pointers to sort. Must not be NULL.
  * @param item_count The number of items in the array.
@@ -205,6 +392,503 @@ mu_store_err_t mu_store_sort(void *base, size_t item_count, size_t item_size,
 mu_store_err_t mu_store_psort(void **base, size_t item_count,
                              mu_store_compare_fn compare_fn);
 
+/**
+ * @brief Stable in-place sort of an array of equally sized items.
+ *
+ * Items that compare equal keep their original relative order.  Uses a
+ * bottom-up merge sort that detects natural ascending (and strictly
+ * descending) runs and gallops through long one-sided stretches while
+ * merging, in the style of timsort.  Already-sorted and reverse-sorted input
+ * is handled in O(n) comparisons.
+ *
+ * The caller may supply a scratch buffer.  When the shorter of two runs being
+ * merged fits in `scratch`, it is merged through the buffer in linear time;
+ * otherwise the merge degrades to an in-place rotation merge that uses no
+ * extra memory, at the cost of O(n log n) moves per merge.  A scratch buffer
+ * of `item_count / 2` items guarantees every merge is buffered.  The function
+ * never allocates memory.
+ *
+ * @param base Pointer to the beginning of the array of items to sort. Must not
+ * be NULL.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param compare_fn The comparison function used to determine the order of
+ * elements. Must not be NULL. The comparison function receives pointers to the
+ * items being compared.
+ * @param scratch Optional scratch buffer of `scratch_count * item_size` bytes.
+ * May be NULL.
+ * @param scratch_count Number of items `scratch` can hold.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base, compare_fn
+ * is NULL, or item_size is 0.
+ */
+mu_store_err_t mu_store_stable_sort(void *base, size_t item_count,
+                                    size_t item_size,
+                                    mu_store_compare_fn compare_fn,
+                                    void *scratch, size_t scratch_count);
+
+/**
+ * @brief Stable in-place sort of an array of pointer-sized items.
+ *
+ * Pointer counterpart of mu_store_stable_sort().  As with mu_store_psort(),
+ * the comparison function receives the addresses of the two pointer slots.
+ *
+ * @param base Pointer to the beginning of the array of `void*` pointers to
+ * sort. Must not be NULL.
+ * @param item_count The number of items in the array.
+ * @param compare_fn The comparison function used to determine the order of
+ * elements. Must not be NULL.
+ * @param scratch Optional scratch array of `scratch_count` pointers. May be
+ * NULL.
+ * @param scratch_count Number of pointers `scratch` can hold.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base or
+ * compare_fn is NULL.
+ */
+mu_store_err_t mu_store_stable_psort(void **base, size_t item_count,
+                                     mu_store_compare_fn compare_fn,
+                                     void **scratch, size_t scratch_count);
+
+/**
+ * @brief Stable LSD radix sort of items by a numeric key at a fixed offset.
+ *
+ * Sorts `item_count` items of `item_size` bytes by the `key_width`-byte key
+ * stored (in host byte order) at `key_offset` within each item.  The key is
+ * interpreted according to `flags`:
+ *   - MU_STORE_RADIX_UNSIGNED: unsigned integer of 1, 2, 4 or 8 bytes.
+ *   - MU_STORE_RADIX_SIGNED: two's complement integer of 1, 2, 4 or 8 bytes.
+ *   - MU_STORE_RADIX_FLOAT: IEEE 754 float (4 bytes) or double (8 bytes).
+ *     -0.0 sorts before +0.0; NaNs sort beyond the infinity of their sign.
+ *   - MU_STORE_RADIX_DESCENDING may be or'd in to reverse the order.
+ *
+ * Items with equal keys keep their relative order.  One pass is made per key
+ * byte, and passes in which every item has the same byte are skipped, so
+ * keys that only span a few low-order bytes sort in proportionally fewer
+ * passes.  No comparison function is called.  Very short arrays are sorted
+ * by a stable insertion sort instead.
+ *
+ * Each pass counts its own digit, so only 256 counters live on the stack.
+ *
+ * @param base Pointer to the beginning of the array of items to sort. Must not
+ * be NULL.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param key_offset Byte offset of the key within each item.
+ * @param key_width Size of the key in bytes: 1, 2, 4 or 8 (4 or 8 for FLOAT).
+ * @param flags Key type, optionally or'd with MU_STORE_RADIX_DESCENDING.
+ * @param scratch Scratch buffer of at least `item_count * item_size` bytes.
+ * Must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base or scratch
+ * is NULL, item_size is 0, the key does not fit within the item, or the key
+ * width or flags are invalid.
+ */
+mu_store_err_t mu_store_radix_sort(void *base, size_t item_count,
+                                   size_t item_size, size_t key_offset,
+                                   size_t key_width,
+                                   mu_store_radix_flags_t flags,
+                                   void *scratch);
+
+/**
+ * @brief Find the insertion index for a key in an array sorted by a numeric
+ * key at a fixed offset.
+ *
+ * Returns the smallest index `i` in [0..item_count] whose key is not less
+ * than `*key`, i.e. the lower bound, where keys are described and ordered
+ * exactly as by mu_store_radix_sort() with the same `key_offset`,
+ * `key_width` and `flags`.  The array must be sorted in that order.
+ *
+ * Rather than halving the range, each step estimates the position of `key`
+ * by linear interpolation between the keys at the ends of the range.  For
+ * roughly uniformly distributed keys this takes O(log log n) probes.  When
+ * an estimate leaves more than half the range, a bisection step follows, so
+ * skewed keys cost at most about twice the probes of a binary search.  FLOAT
+ * keys are interpolated on their bit patterns, which is only roughly linear
+ * in the value.  No comparison function is called.
+ *
+ * @param base Pointer to the first element of the array. May be NULL only if
+ * `item_count` is 0.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param key_offset Byte offset of the key within each item.
+ * @param key_width Size of the key in bytes: 1, 2, 4 or 8 (4 or 8 for FLOAT).
+ * @param flags Key type, optionally or'd with MU_STORE_RADIX_DESCENDING.
+ * @param key Pointer to the `key_width`-byte key to search for (host byte
+ * order). Must not be NULL.
+ * @param index Receives the index in [0..item_count]. Must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if a required
+ * pointer is NULL, item_size is 0, the key does not fit within the item, or
+ * the key width or flags are invalid.
+ */
+mu_store_err_t mu_store_interp_search(const void *base, size_t item_count,
+                                      size_t item_size, size_t key_offset,
+                                      size_t key_width,
+                                      mu_store_radix_flags_t flags,
+                                      const void *key, size_t *index);
+
+/**
+ * @brief Find the first item whose field at a fixed offset equals a value.
+ *
+ * A linear scan like mu_store_find_fn-based searches, but comparing the
+ * field inline rather than calling a function per item.  Fields are compared
+ * bit for bit, so for floating point fields -0.0 differs from 0.0 and a NaN
+ * matches an identical NaN.
+ *
+ * On x86-64 builds with GCC or Clang, 4- and 8-byte fields are scanned
+ * several items at a time with AVX2 (gathering the field from each item)
+ * when the CPU supports it, checked at run time.  Define MU_STORE_NO_SIMD to
+ * build the portable scan only.
+ *
+ * @param base Pointer to the first element of the array. May be NULL only if
+ * `item_count` is 0.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param field_offset Byte offset of the field within each item.
+ * @param field_width Size of the field in bytes: 1, 2, 4 or 8.
+ * @param value Pointer to the `field_width`-byte value to look for. Must not
+ * be NULL.
+ * @param index Receives the index of the first match. Must not be NULL.
+ * @return MU_STORE_ERR_NONE if found, MU_STORE_ERR_NOTFOUND if no item
+ * matches, MU_STORE_ERR_PARAM if a required pointer is NULL, item_size is 0,
+ * the field does not fit within the item, or the width is invalid.
+ */
+mu_store_err_t mu_store_find_eq(const void *base, size_t item_count,
+                                size_t item_size, size_t field_offset,
+                                size_t field_width, const void *value,
+                                size_t *index);
+
+/**
+ * @brief Count the items whose field at a fixed offset equals a value.
+ *
+ * See mu_store_find_eq() for how fields are compared and scanned.
+ *
+ * @param base Pointer to the first element of the array. May be NULL only if
+ * `item_count` is 0.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param field_offset Byte offset of the field within each item.
+ * @param field_width Size of the field in bytes: 1, 2, 4 or 8.
+ * @param value Pointer to the `field_width`-byte value to count. Must not be
+ * NULL.
+ * @param count Receives the number of matching items. Must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if a required
+ * pointer is NULL, item_size is 0, the field does not fit within the item,
+ * or the width is invalid.
+ */
+mu_store_err_t mu_store_count_eq(const void *base, size_t item_count,
+                                 size_t item_size, size_t field_offset,
+                                 size_t field_width, const void *value,
+                                 size_t *count);
+
+/**
+ * @brief Find the first item whose numeric key lies within [*lo, *hi].
+ *
+ * Keys are described as for mu_store_radix_sort(); the array need not be
+ * sorted.  MU_STORE_RADIX_DESCENDING is ignored.  Each key is mapped to an
+ * order-preserving unsigned integer, so the test is a single unsigned
+ * comparison for every key type and is vectorized as in mu_store_find_eq().
+ * If `*lo` is greater than `*hi` no item matches.
+ *
+ * @param base Pointer to the first element of the array. May be NULL only if
+ * `item_count` is 0.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param key_offset Byte offset of the key within each item.
+ * @param key_width Size of the key in bytes: 1, 2, 4 or 8 (4 or 8 for FLOAT).
+ * @param flags Key type.
+ * @param lo Pointer to the `key_width`-byte inclusive lower bound. Must not
+ * be NULL.
+ * @param hi Pointer to the `key_width`-byte inclusive upper bound. Must not
+ * be NULL.
+ * @param index Receives the index of the first match. Must not be NULL.
+ * @return MU_STORE_ERR_NONE if found, MU_STORE_ERR_NOTFOUND if no item
+ * matches, MU_STORE_ERR_PARAM if a required pointer is NULL, item_size is 0,
+ * the key does not fit within the item, or the key width or flags are
+ * invalid.
+ */
+mu_store_err_t mu_store_find_range(const void *base, size_t item_count,
+                                   size_t item_size, size_t key_offset,
+                                   size_t key_width,
+                                   mu_store_radix_flags_t flags,
+                                   const void *lo, const void *hi,
+                                   size_t *index);
+
+/**
+ * @brief Sort an array of pointers by a key extracted once per item.
+ *
+ * A comparison sort through pointers dereferences two (often scattered)
+ * objects per comparison.  This sort instead calls `key_fn` exactly once per
+ * pointer, sorts the contiguous (key, pointer) pairs held in `scratch`, and
+ * writes the pointers back in key order, so the objects themselves are only
+ * visited by the extraction pass.
+ *
+ * The pairs are sorted by one of two algorithms, chosen by the size of the
+ * scratch buffer:
+ *   - `scratch_count >= 2 * item_count`: a stable LSD radix sort (see
+ *     mu_store_radix_sort()) using the second half as its ping-pong buffer.
+ *     Pointers with equal keys keep their relative order.
+ *   - `item_count <= scratch_count < 2 * item_count`: pdqsort on the pairs.
+ *     Not stable.
+ *
+ * @param base Pointer to the beginning of the array of pointers. Must not be
+ * NULL.
+ * @param item_count The number of pointers in the array.
+ * @param key_fn Key extraction function, called with each stored pointer.
+ * Must not be NULL.
+ * @param scratch Scratch array of `scratch_count` pairs. Must not be NULL.
+ * @param scratch_count Number of pairs `scratch` can hold; at least
+ * `item_count`.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base, key_fn
+ * or scratch is NULL, or scratch_count is less than item_count.
+ */
+mu_store_err_t mu_store_psort_by_key(void **base, size_t item_count,
+                                     mu_store_key_fn key_fn,
+                                     mu_store_key_pair_t *scratch,
+                                     size_t scratch_count);
+
+/**
+ * @brief Partially sort an array so that its `nth` item is in sorted position.
+ *
+ * After the call, the item at index `nth` is the one that would be there if
+ * the whole array were sorted, no item before it compares greater and no
+ * item after it compares less (C++'s nth_element).  Uses introselect: the
+ * same partitioning as mu_store_sort(), but only the side containing `nth`
+ * is pursued, for O(n) expected time.  Runs of items equal to the pivot are
+ * skipped in one pass, and after too many unbalanced partitions the
+ * remaining range is heapsorted, bounding the worst case at O(n log n).
+ *
+ * Selecting `item_count / 2` gives the median; selecting `item_count * p /
+ * 100` gives the p-th percentile.
+ *
+ * @param base Pointer to the beginning of the array. Must not be NULL.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param nth Index of the item to place. Must be less than `item_count`.
+ * @param compare_fn The comparison function. Must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base or
+ * compare_fn is NULL, item_size is 0 or nth is not less than item_count.
+ */
+mu_store_err_t mu_store_select(void *base, size_t item_count, size_t item_size,
+                               size_t nth, mu_store_compare_fn compare_fn);
+
+/**
+ * @brief Pointer counterpart of mu_store_select().
+ *
+ * As with mu_store_psort(), the comparison function receives the addresses
+ * of the two pointer slots.
+ *
+ * @param base Pointer to the beginning of the array of pointers. Must not be
+ * NULL.
+ * @param item_count The number of pointers in the array.
+ * @param nth Index of the pointer to place. Must be less than `item_count`.
+ * @param compare_fn The comparison function. Must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base or
+ * compare_fn is NULL or nth is not less than item_count.
+ */
+mu_store_err_t mu_store_pselect(void **base, size_t item_count, size_t nth,
+                                mu_store_compare_fn compare_fn);
+
+/**
+ * @brief Move the `k` smallest items to the front of an array, in order.
+ *
+ * After the call, base[0..k) holds the first `k` items of the sorted order,
+ * sorted; the order of the remaining items is unspecified.  Selects the k-th
+ * item with mu_store_select() and sorts only the items before it, for
+ * O(n + k log k) expected time.  `k` larger than `item_count` sorts the
+ * whole array.
+ *
+ * The sort is not stable.  To get the `k` largest items, pass a comparison
+ * function that orders descending.
+ *
+ * @param base Pointer to the beginning of the array. Must not be NULL.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param k Number of leading items to sort.
+ * @param compare_fn The comparison function. Must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base or
+ * compare_fn is NULL, or item_size is 0.
+ */
+mu_store_err_t mu_store_partial_sort(void *base, size_t item_count,
+                                     size_t item_size, size_t k,
+                                     mu_store_compare_fn compare_fn);
+
+/**
+ * @brief Pointer counterpart of mu_store_partial_sort().
+ *
+ * As with mu_store_psort(), the comparison function receives the addresses
+ * of the two pointer slots.
+ *
+ * @param base Pointer to the beginning of the array of pointers. Must not be
+ * NULL.
+ * @param item_count The number of pointers in the array.
+ * @param k Number of leading pointers to sort.
+ * @param compare_fn The comparison function. Must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base or
+ * compare_fn is NULL.
+ */
+mu_store_err_t mu_store_partial_psort(void **base, size_t item_count, size_t k,
+                                      mu_store_compare_fn compare_fn);
+
+/**
+ * @brief Copy the `k` smallest items of an array, in order, into `out`.
+ *
+ * Unlike mu_store_partial_sort(), the input array is left untouched: a
+ * bounded max-heap of `k` items is kept in `out` while the input is scanned
+ * once, and each item smaller than the heap's maximum replaces it.  The heap
+ * is then sorted.  Cost is O(n log k) comparisons in the worst case, and
+ * close to n comparisons when most items are rejected by the heap's maximum;
+ * memory is just `out`.  This suits streaming a large array into a small
+ * leaderboard.
+ *
+ * `min(k, item_count)` items are written.  To get the `k` largest items,
+ * pass a comparison function that orders descending.
+ *
+ * @param base Pointer to the beginning of the array. May be NULL only if
+ * item_count is 0.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param k Maximum number of items to copy out.
+ * @param compare_fn The comparison function. Must not be NULL.
+ * @param out Buffer for at least `min(k, item_count)` items. Must not overlap
+ * `base`, and may be NULL only if k is 0.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if a required
+ * pointer is NULL or item_size is 0.
+ */
+mu_store_err_t mu_store_topk(const void *base, size_t item_count,
+                             size_t item_size, size_t k,
+                             mu_store_compare_fn compare_fn, void *out);
+
+/**
+ * @brief Pointer counterpart of mu_store_topk().
+ *
+ * Copies the `min(k, item_count)` pointers whose targets sort first into
+ * `out`, in order.  As with mu_store_psort(), the comparison function
+ * receives the addresses of two pointer slots.
+ *
+ * @param base Pointer to the beginning of the array of pointers. May be NULL
+ * only if item_count is 0.
+ * @param item_count The number of pointers in the array.
+ * @param k Maximum number of pointers to copy out.
+ * @param compare_fn The comparison function. Must not be NULL.
+ * @param out Array for at least `min(k, item_count)` pointers. May be NULL
+ * only if k is 0.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if a required
+ * pointer is NULL.
+ */
+mu_store_err_t mu_store_ptopk(void *const *base, size_t item_count, size_t k,
+                              mu_store_compare_fn compare_fn, void **out);
+
+/**
+ * @brief Compute the sorting permutation of an array without moving its items.
+ *
+ * Fills `indices` with 0..item_count-1, then sorts the indices so that
+ * `base[indices[0]], base[indices[1]], ...` is in ascending order.  Only the
+ * small indices are moved while sorting, which makes this much cheaper than
+ * mu_store_sort() for wide items; apply the result with
+ * mu_store_apply_permutation(), to this array and to any parallel arrays.
+ *
+ * Ties are broken by index, so the permutation is stable.  The items are not
+ * modified.  Indices are `uint32_t` or `size_t`, selected by `index_size`.
+ *
+ * @param base Pointer to the beginning of the array of items. Must not be
+ * NULL.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param compare_fn The comparison function; receives pointers to two items.
+ * Must not be NULL.
+ * @param indices Array of `item_count` indices to receive the permutation.
+ * Must not be NULL.
+ * @param index_size `sizeof(uint32_t)` or `sizeof(size_t)`.  32-bit indices
+ * support up to 2^31 items.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if a pointer is
+ * NULL, item_size is 0, or index_size is unsupported or too narrow for
+ * item_count.
+ */
+mu_store_err_t mu_store_argsort(const void *base, size_t item_count,
+                                size_t item_size,
+                                mu_store_compare_fn compare_fn, void *indices,
+                                size_t index_size);
+
+/**
+ * @brief Reorder an array in place according to a permutation.
+ *
+ * Afterwards item `i` is the item that was at `perm[i]` (so the output of
+ * mu_store_argsort() sorts the array).  Cycles of the permutation are
+ * followed so that every item is moved exactly once, via a small stack
+ * buffer: items wider than 256 bytes are moved in 256-byte pieces, one walk
+ * of the cycle per piece.
+ *
+ * `perm` is verified to be a permutation before any item moves.  It is used
+ * as scratch space (entries are marked in their top bit) but is restored
+ * before returning, so the same permutation can be applied to several
+ * parallel arrays in turn.  Not thread safe with respect to `perm`.
+ *
+ * @param base Pointer to the beginning of the array of items. Must not be
+ * NULL.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param perm Array of `item_count` indices forming a permutation of
+ * [0..item_count). Must not be NULL.
+ * @param index_size `sizeof(uint32_t)` or `sizeof(size_t)`.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if a pointer is
+ * NULL, item_size is 0, index_size is unsupported, or `perm` is not a
+ * permutation (in which case nothing is moved and `perm` is left exactly as
+ * passed).
+ */
+mu_store_err_t mu_store_apply_permutation(void *base, size_t item_count,
+                                          size_t item_size, void *perm,
+                                          size_t index_size);
+
+/**
+ * @brief Reorder an array so that the items matching a predicate come first.
+ *
+ * Scans inwards from both ends and swaps each non-matching item found from
+ * the front with a matching item found from the back, so every item is
+ * tested once and only misplaced items move.  The relative order within
+ * either group is not preserved.
+ *
+ * @param base Pointer to the beginning of the array. Must not be NULL.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param pred_fn Predicate, called as `pred_fn(&base[i], arg)`. Must not be
+ * NULL.
+ * @param arg Extra argument for `pred_fn`; may be NULL.
+ * @param split Receives the number of matching items, which now occupy
+ * [0..split). Must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base, pred_fn
+ * or split is NULL, or item_size is 0.
+ */
+mu_store_err_t mu_store_partition(void *base, size_t item_count,
+                                  size_t item_size, mu_store_find_fn pred_fn,
+                                  const void *arg, size_t *split);
+
+/**
+ * @brief Reorder an array so that the items matching a predicate come first,
+ * preserving the relative order within both groups.
+ *
+ * Each item is tested once.  When `scratch` can hold the whole array the
+ * partition takes one pass: matching items are compacted in place while the
+ * others are set aside in `scratch` and copied back after them.  Otherwise
+ * the array is partitioned by halves, recursively, and the halves joined by
+ * rotation (using `scratch` where it fits), for O(n log n) moves.
+ *
+ * @param base Pointer to the beginning of the array. Must not be NULL.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param pred_fn Predicate, called as `pred_fn(&base[i], arg)`. Must not be
+ * NULL.
+ * @param arg Extra argument for `pred_fn`; may be NULL.
+ * @param scratch Optional scratch buffer of `scratch_count` items; may be
+ * NULL.
+ * @param scratch_count Number of items `scratch` can hold.
+ * @param split Receives the number of matching items, which now occupy
+ * [0..split). Must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base, pred_fn
+ * or split is NULL, or item_size is 0.
+ */
+mu_store_err_t mu_store_stable_partition(void *base, size_t item_count,
+                                         size_t item_size,
+                                         mu_store_find_fn pred_fn,
+                                         const void *arg, void *scratch,
+                                         size_t scratch_count, size_t *split);
+
 // *****************************************************************************
 // End of file
 
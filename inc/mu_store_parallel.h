@@ -0,0 +1,165 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_store_parallel.h
+ *
+ * @brief Multithreaded sorting on POSIX threads.
+ *
+ * These functions live in their own translation unit so that the rest of
+ * the library does not depend on pthreads; link with `-pthread` when using
+ * them.  The mu_vec and mu_pvec wrappers are declared here for the same
+ * reason.
+ */
+
+#ifndef _MU_STORE_PARALLEL_H_
+#define _MU_STORE_PARALLEL_H_
+
+// *****************************************************************************
+// Includes
+
+#include "mu_pvec.h"
+#include "mu_store.h"
+#include "mu_vec.h"
+#include <stddef.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Upper bound on the number of threads a parallel sort will use.
+ */
+#ifndef MU_STORE_PARALLEL_MAX_THREADS
+#define MU_STORE_PARALLEL_MAX_THREADS 64
+#endif
+
+/**
+ * @brief Minimum number of items per thread.  Arrays too small to give two
+ * threads this many items each are sorted serially by mu_store_sort().
+ */
+#ifndef MU_STORE_PARALLEL_MIN_CHUNK
+#define MU_STORE_PARALLEL_MIN_CHUNK 8192
+#endif
+
+// *****************************************************************************
+// Public declarations
+
+/**
+ * @brief Multithreaded in-place sort of an array of equally sized items.
+ *
+ * Splits the array into one chunk per thread, sorts the chunks concurrently
+ * with mu_store_sort(), then merges them pairwise in log2(threads) rounds.
+ * Every merge round is divided evenly among all threads by splitting the
+ * output at balanced positions, so the later rounds (with few, long runs)
+ * stay parallel.  Merges ping-pong between `base` and `scratch`.
+ *
+ * The calling thread does its share of the work and at most
+ * `n_threads - 1` threads are created per phase.  If a thread cannot be
+ * created its share runs on the calling thread.  Arrays too small to give
+ * each thread MU_STORE_PARALLEL_MIN_CHUNK items use fewer threads, down to
+ * a plain serial mu_store_sort().
+ *
+ * The sort is not stable.  `compare_fn` is called concurrently from several
+ * threads and must be thread safe.
+ *
+ * @param base Pointer to the beginning of the array of items to sort. Must not
+ * be NULL.
+ * @param item_count The number of items in the array.
+ * @param item_size The size of each item in bytes. Must be greater than 0.
+ * @param compare_fn The comparison function. Must not be NULL.
+ * @param scratch Scratch buffer of at least `item_count * item_size` bytes.
+ * Must not be NULL.
+ * @param n_threads Maximum number of threads to use, including the caller
+ * (clamped to MU_STORE_PARALLEL_MAX_THREADS). 0 and 1 sort serially.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base,
+ * compare_fn or scratch is NULL, or item_size is 0.
+ */
+mu_store_err_t mu_store_parallel_sort(void *base, size_t item_count,
+                                      size_t item_size,
+                                      mu_store_compare_fn compare_fn,
+                                      void *scratch, size_t n_threads);
+
+/**
+ * @brief Multithreaded in-place sort of an array of pointers.
+ *
+ * Pointer counterpart of mu_store_parallel_sort().  As with
+ * mu_store_psort(), the comparison function receives the addresses of the
+ * two pointer slots.
+ *
+ * @param base Pointer to the beginning of the array of pointers. Must not be
+ * NULL.
+ * @param item_count The number of pointers in the array.
+ * @param compare_fn The comparison function. Must not be NULL.
+ * @param scratch Scratch array of at least `item_count` pointers. Must not be
+ * NULL.
+ * @param n_threads Maximum number of threads to use, including the caller.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if base,
+ * compare_fn or scratch is NULL.
+ */
+mu_store_err_t mu_store_parallel_psort(void **base, size_t item_count,
+                                       mu_store_compare_fn compare_fn,
+                                       void **scratch, size_t n_threads);
+
+/**
+ * @brief Multithreaded sort of the elements in a vector.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @param scratch    Scratch buffer of at least `count` elements; must not be
+ *                   NULL.
+ * @param n_threads  Maximum number of threads to use, including the caller.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_parallel_sort(mu_vec_t *v, mu_vec_compare_fn compare_fn,
+                                  void *scratch, size_t n_threads);
+
+/**
+ * @brief Multithreaded sort of the pointers in a pointer vector.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param compare_fn Comparison function on pointer slots; must not be NULL.
+ * @param scratch    Scratch array of at least `count` pointers; must not be
+ *                   NULL.
+ * @param n_threads  Maximum number of threads to use, including the caller.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_pvec_err_t mu_pvec_parallel_sort(mu_pvec_t *v,
+                                    mu_pvec_compare_fn compare_fn,
+                                    void **scratch, size_t n_threads);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MU_STORE_PARALLEL_H_ */
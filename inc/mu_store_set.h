@@ -0,0 +1,256 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_store_set.h
+ *
+ * @brief Merge and set algebra over sorted arrays.
+ *
+ * Each binary operation reads two arrays sorted by the same comparison
+ * function and writes its result, also sorted, into a caller buffer.  Inputs
+ * are treated as multisets, with the conventions of the C++ standard
+ * library: if an item appears m times in `a` and n times in `b`, the union
+ * holds it max(m, n) times, the intersection min(m, n) times and the
+ * difference `a - b` max(m - n, 0) times.  Where the result takes items from
+ * `a`, the leading ones are used.
+ *
+ * The merge loops switch to galloping (exponential search) once one input
+ * has supplied several items in a row, so inputs of very different sizes
+ * cost O(m log(n / m)) comparisons rather than O(m + n), and long runs are
+ * copied with a single memcpy.
+ *
+ * If the result does not fit, the buffer is filled with its first
+ * `out_capacity` items, `*out_count` is set to `out_capacity` and
+ * MU_STORE_ERR_FULL is returned.  The output must not overlap the inputs.
+ *
+ * Pointer variants (mu_store_p...) operate on arrays of pointers and, as with
+ * mu_store_psort(), pass the addresses of the pointer slots to the comparison
+ * function.  The _u32 / _u64 variants operate on plain arrays of unsigned
+ * integers without calling a comparison function.
+ */
+
+#ifndef _MU_STORE_SET_H_
+#define _MU_STORE_SET_H_
+
+// *****************************************************************************
+// Includes
+
+#include "mu_pvec.h"
+#include "mu_store.h"
+#include "mu_vec.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// C++ Compatibility
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// *****************************************************************************
+// Public declarations
+
+/**
+ * @brief Merge two sorted arrays into `out`.
+ *
+ * The merge is stable: items that compare equal are output with those from
+ * `a` first, each input keeping its own order.
+ *
+ * @param a            First sorted array; may be NULL if `a_count` is 0.
+ * @param a_count      Number of items in `a`.
+ * @param b            Second sorted array; may be NULL if `b_count` is 0.
+ * @param b_count      Number of items in `b`.
+ * @param item_size    Size of each item in bytes. Must be greater than 0.
+ * @param compare_fn   Comparison function; must not be NULL.
+ * @param out          Output buffer of `out_capacity` items; may be NULL only
+ *                     if `out_capacity` is 0.
+ * @param out_capacity Number of items `out` can hold.
+ * @param out_count    Receives the number of items written; must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_FULL if the result was
+ * truncated, MU_STORE_ERR_PARAM if a required pointer is NULL or item_size
+ * is 0.
+ */
+mu_store_err_t mu_store_merge(const void *a, size_t a_count, const void *b,
+                              size_t b_count, size_t item_size,
+                              mu_store_compare_fn compare_fn, void *out,
+                              size_t out_capacity, size_t *out_count);
+
+/**
+ * @brief Union of two sorted arrays.  Parameters as for mu_store_merge().
+ */
+mu_store_err_t mu_store_set_union(const void *a, size_t a_count,
+                                  const void *b, size_t b_count,
+                                  size_t item_size,
+                                  mu_store_compare_fn compare_fn, void *out,
+                                  size_t out_capacity, size_t *out_count);
+
+/**
+ * @brief Intersection of two sorted arrays, taking items from `a`.
+ * Parameters as for mu_store_merge().
+ */
+mu_store_err_t mu_store_set_intersection(const void *a, size_t a_count,
+                                         const void *b, size_t b_count,
+                                         size_t item_size,
+                                         mu_store_compare_fn compare_fn,
+                                         void *out, size_t out_capacity,
+                                         size_t *out_count);
+
+/**
+ * @brief Items of sorted array `a` not in sorted array `b`.  Parameters as
+ * for mu_store_merge().
+ */
+mu_store_err_t mu_store_set_difference(const void *a, size_t a_count,
+                                       const void *b, size_t b_count,
+                                       size_t item_size,
+                                       mu_store_compare_fn compare_fn,
+                                       void *out, size_t out_capacity,
+                                       size_t *out_count);
+
+/**
+ * @brief Remove all but the first of each run of equal items, in place.
+ *
+ * The array need only be sorted well enough that equal items are adjacent.
+ * The kept items are compacted to the front of the array.
+ *
+ * @param base       The array; may be NULL if `item_count` is 0.
+ * @param item_count Number of items in the array.
+ * @param item_size  Size of each item in bytes. Must be greater than 0.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @param out_count  Receives the number of items kept; must not be NULL.
+ * @return MU_STORE_ERR_NONE on success, MU_STORE_ERR_PARAM if a required
+ * pointer is NULL or item_size is 0.
+ */
+mu_store_err_t mu_store_unique(void *base, size_t item_count,
+                               size_t item_size,
+                               mu_store_compare_fn compare_fn,
+                               size_t *out_count);
+
+/**
+ * @brief Pointer counterparts of the functions above.
+ *
+ * The comparison function receives the addresses of two pointer slots.
+ */
+mu_store_err_t mu_store_pmerge(void *const *a, size_t a_count, void *const *b,
+                               size_t b_count, mu_store_compare_fn compare_fn,
+                               void **out, size_t out_capacity,
+                               size_t *out_count);
+mu_store_err_t mu_store_pset_union(void *const *a, size_t a_count,
+                                   void *const *b, size_t b_count,
+                                   mu_store_compare_fn compare_fn, void **out,
+                                   size_t out_capacity, size_t *out_count);
+mu_store_err_t mu_store_pset_intersection(void *const *a, size_t a_count,
+                                          void *const *b, size_t b_count,
+                                          mu_store_compare_fn compare_fn,
+                                          void **out, size_t out_capacity,
+                                          size_t *out_count);
+mu_store_err_t mu_store_pset_difference(void *const *a, size_t a_count,
+                                        void *const *b, size_t b_count,
+                                        mu_store_compare_fn compare_fn,
+                                        void **out, size_t out_capacity,
+                                        size_t *out_count);
+mu_store_err_t mu_store_punique(void **base, size_t item_count,
+                                mu_store_compare_fn compare_fn,
+                                size_t *out_count);
+
+/**
+ * @brief Fast paths for arrays of plain unsigned integers.
+ *
+ * Same results as the generic functions with a numeric comparison, but the
+ * inner loops compare the integers directly and are branch free, so they
+ * avoid both the indirect call and unpredictable branches.  When one input
+ * is much longer than the other, they switch to the galloping loop.
+ */
+mu_store_err_t mu_store_merge_u32(const uint32_t *a, size_t a_count,
+                                  const uint32_t *b, size_t b_count,
+                                  uint32_t *out, size_t out_capacity,
+                                  size_t *out_count);
+mu_store_err_t mu_store_set_union_u32(const uint32_t *a, size_t a_count,
+                                      const uint32_t *b, size_t b_count,
+                                      uint32_t *out, size_t out_capacity,
+                                      size_t *out_count);
+mu_store_err_t mu_store_set_intersection_u32(const uint32_t *a, size_t a_count,
+                                             const uint32_t *b, size_t b_count,
+                                             uint32_t *out, size_t out_capacity,
+                                             size_t *out_count);
+mu_store_err_t mu_store_set_difference_u32(const uint32_t *a, size_t a_count,
+                                           const uint32_t *b, size_t b_count,
+                                           uint32_t *out, size_t out_capacity,
+                                           size_t *out_count);
+mu_store_err_t mu_store_merge_u64(const uint64_t *a, size_t a_count,
+                                  const uint64_t *b, size_t b_count,
+                                  uint64_t *out, size_t out_capacity,
+                                  size_t *out_count);
+mu_store_err_t mu_store_set_union_u64(const uint64_t *a, size_t a_count,
+                                      const uint64_t *b, size_t b_count,
+                                      uint64_t *out, size_t out_capacity,
+                                      size_t *out_count);
+mu_store_err_t mu_store_set_intersection_u64(const uint64_t *a, size_t a_count,
+                                             const uint64_t *b, size_t b_count,
+                                             uint64_t *out, size_t out_capacity,
+                                             size_t *out_count);
+mu_store_err_t mu_store_set_difference_u64(const uint64_t *a, size_t a_count,
+                                           const uint64_t *b, size_t b_count,
+                                           uint64_t *out, size_t out_capacity,
+                                           size_t *out_count);
+
+/**
+ * @brief Vector wrappers.
+ *
+ * `a`, `b` and `out` must have the same item size.  The result replaces the
+ * contents of `out`, which must be distinct from `a` and `b`; on
+ * MU_STORE_ERR_FULL `out` holds as much of the result as fits.
+ */
+mu_vec_err_t mu_vec_merge(const mu_vec_t *a, const mu_vec_t *b,
+                          mu_vec_compare_fn compare_fn, mu_vec_t *out);
+mu_vec_err_t mu_vec_set_union(const mu_vec_t *a, const mu_vec_t *b,
+                              mu_vec_compare_fn compare_fn, mu_vec_t *out);
+mu_vec_err_t mu_vec_set_intersection(const mu_vec_t *a, const mu_vec_t *b,
+                                     mu_vec_compare_fn compare_fn,
+                                     mu_vec_t *out);
+mu_vec_err_t mu_vec_set_difference(const mu_vec_t *a, const mu_vec_t *b,
+                                   mu_vec_compare_fn compare_fn,
+                                   mu_vec_t *out);
+mu_vec_err_t mu_vec_unique(mu_vec_t *v, mu_vec_compare_fn compare_fn);
+
+mu_pvec_err_t mu_pvec_merge(const mu_pvec_t *a, const mu_pvec_t *b,
+                            mu_pvec_compare_fn compare_fn, mu_pvec_t *out);
+mu_pvec_err_t mu_pvec_set_union(const mu_pvec_t *a, const mu_pvec_t *b,
+                                mu_pvec_compare_fn compare_fn, mu_pvec_t *out);
+mu_pvec_err_t mu_pvec_set_intersection(const mu_pvec_t *a, const mu_pvec_t *b,
+                                       mu_pvec_compare_fn compare_fn,
+                                       mu_pvec_t *out);
+mu_pvec_err_t mu_pvec_set_difference(const mu_pvec_t *a, const mu_pvec_t *b,
+                                     mu_pvec_compare_fn compare_fn,
+                                     mu_pvec_t *out);
+mu_pvec_err_t mu_pvec_unique(mu_pvec_t *v, mu_pvec_compare_fn compare_fn);
+
+// *****************************************************************************
+// End of file
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _MU_STORE_SET_H_ */
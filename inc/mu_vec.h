@@ -132,6 +132,71 @@ mu_vec_err_t mu_vec_clear(mu_vec_t *v);
  */
 mu_vec_err_t mu_vec_ref(const mu_vec_t *v, size_t index, void *item_out);
 
+/**
+ * @brief Return the address of the item at `index`, without copying it.
+ *
+ * The pointer stays valid until the vector is modified by an operation that
+ * moves items (insert, delete, sort, ...).  Items may be read and written in
+ * place through it.
+ *
+ * @param v      Pointer to the vector; may be NULL.
+ * @param index  Position [0..count-1].
+ * @return       Address of the item, or NULL if `v` is NULL or
+ *               `index >= count`.
+ */
+void *mu_vec_at(const mu_vec_t *v, size_t index);
+
+/**
+ * @brief Return the address of the item at `index` with no checks.
+ *
+ * Defined inline for tight loops.  The caller guarantees that `v` is valid
+ * and `index < count`; use mu_vec_at() otherwise.
+ *
+ * @param v      Pointer to the vector. Must not be NULL.
+ * @param index  Position [0..count-1].
+ * @return       Address of the item.
+ */
+static inline void *mu_vec_at_unchecked(const mu_vec_t *v, size_t index) {
+    return (char *)v->item_store + index * v->item_size;
+}
+
+/**
+ * @brief Return the address of the first item (the backing store).
+ *
+ * The items are contiguous, `item_size` bytes apart.
+ *
+ * @param v  Pointer to the vector; may be NULL.
+ * @return   The backing store, or NULL if `v` is NULL.
+ */
+void *mu_vec_data(const mu_vec_t *v);
+
+/**
+ * @brief Append an uninitialized slot and return its address.
+ *
+ * Counterpart of mu_vec_push() for building an item in place: the count is
+ * incremented and the caller fills in the returned slot, avoiding the copy
+ * from a temporary.  The slot's previous contents are left unchanged.
+ *
+ * @param v  Pointer to the vector; may be NULL.
+ * @return   Address of the new last slot, or NULL if `v` is NULL or the
+ *           vector is full.
+ */
+void *mu_vec_emplace_back(mu_vec_t *v);
+
+/**
+ * @brief Open an uninitialized slot at `index` and return its address.
+ *
+ * Counterpart of mu_vec_insert(): later items are shifted right by one and
+ * the count is incremented, and the caller fills in the returned slot.
+ * `index == count` is equivalent to mu_vec_emplace_back().
+ *
+ * @param v      Pointer to the vector; may be NULL.
+ * @param index  Position [0..count].
+ * @return       Address of the new slot, or NULL if `v` is NULL, the vector
+ *               is full or `index > count`.
+ */
+void *mu_vec_emplace_at(mu_vec_t *v, size_t index);
+
 /**
  * @brief Insert an item at `index`, shifting later elements right.
  *        Inserting at `index == count` appends to the end.
@@ -156,6 +221,44 @@ mu_vec_err_t mu_vec_insert(mu_vec_t *v, size_t index, const void *item);
  */
 mu_vec_err_t mu_vec_delete(mu_vec_t *v, size_t index, void *item_out);
 
+/**
+ * @brief Delete an item at `index` by moving the last item into its place.
+ *
+ * Constant time regardless of the vector's size, but does not preserve the
+ * order of the remaining items.
+ *
+ * @param v         Pointer to the vector. Must not be NULL.
+ * @param index     Position [0..count-1].
+ * @param item_out  Optional address to receive the removed item; may be NULL.
+ * @return          MU_STORE_ERR_NONE,
+ *                  MU_STORE_ERR_PARAM if `v` is NULL,
+ *                  MU_STORE_ERR_INDEX if `index >= count`.
+ */
+mu_vec_err_t mu_vec_swap_remove(mu_vec_t *v, size_t index, void *item_out);
+
+/**
+ * @brief Swap-remove the items at several indices in one pass.
+ *
+ * `indices` must be strictly ascending.  They are processed from the last to
+ * the first, so the item moved into each hole always comes from beyond any
+ * index still to be removed: the cost is O(n) in the number of indices, not
+ * in the vector's size.  The order of the remaining items is not preserved.
+ *
+ * @param v         Pointer to the vector. Must not be NULL.
+ * @param indices   Strictly ascending positions in [0..count-1]; may be NULL
+ *                  only if `n` is 0.
+ * @param n         Number of indices.
+ * @param items_out Optional buffer of `n` items receiving the removed items
+ *                  in the order of `indices`; may be NULL.
+ * @return          MU_STORE_ERR_NONE,
+ *                  MU_STORE_ERR_PARAM if `v` is NULL, or `indices` is NULL
+ *                  and `n` is not 0,
+ *                  MU_STORE_ERR_INDEX if `indices` is out of range or not
+ *                  strictly ascending (the vector is left unchanged).
+ */
+mu_vec_err_t mu_vec_swap_remove_indices(mu_vec_t *v, const size_t *indices,
+                                        size_t n, void *items_out);
+
 /**
  * @brief Replace the item at `index` with a new item.
  * @param v     Pointer to the vector. Must not be NULL.
@@ -208,6 +311,94 @@ mu_vec_err_t mu_vec_pop(mu_vec_t *v, void *item_out);
  */
 mu_vec_err_t mu_vec_peek(const mu_vec_t *v, void *item_out);
 
+/**
+ * @brief Append `n` items copied from a contiguous array.
+ *
+ * All or nothing: if the items do not all fit, nothing is appended.
+ *
+ * @param v      Pointer to the vector. Must not be NULL.
+ * @param items  Array of `n` items; may be NULL only if `n` is 0.
+ * @param n      Number of items to append.
+ * @return       MU_STORE_ERR_NONE,
+ *               MU_STORE_ERR_PARAM if `v` (or `items` with n > 0) is NULL,
+ *               MU_STORE_ERR_FULL if `count + n > capacity`.
+ */
+mu_vec_err_t mu_vec_push_n(mu_vec_t *v, const void *items, size_t n);
+
+/**
+ * @brief Insert `n` items at `index`, shifting later elements right once.
+ *
+ * The tail is moved with a single memmove, so inserting a block costs
+ * O(count + n) rather than the O(count * n) of `n` mu_vec_insert() calls.
+ * All or nothing: if the items do not all fit, the vector is unchanged.
+ *
+ * @param v      Pointer to the vector. Must not be NULL.
+ * @param index  Position [0..count] of the first inserted item.
+ * @param items  Array of `n` items; may be NULL only if `n` is 0.  Must not
+ *               overlap the vector's storage.
+ * @param n      Number of items to insert.
+ * @return       MU_STORE_ERR_NONE,
+ *               MU_STORE_ERR_PARAM if `v` (or `items` with n > 0) is NULL,
+ *               MU_STORE_ERR_INDEX if `index > count`,
+ *               MU_STORE_ERR_FULL if `count + n > capacity`.
+ */
+mu_vec_err_t mu_vec_insert_range(mu_vec_t *v, size_t index, const void *items,
+                                 size_t n);
+
+/**
+ * @brief Delete the `n` items starting at `index`, shifting later elements
+ * left once.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param index      Position of the first item to delete.
+ * @param n          Number of items to delete.
+ * @param items_out  Optional buffer of at least `n` items to receive the
+ *                   deleted items; may be NULL.
+ * @return           MU_STORE_ERR_NONE,
+ *                   MU_STORE_ERR_PARAM if `v` is NULL,
+ *                   MU_STORE_ERR_INDEX if `index + n > count`.
+ */
+mu_vec_err_t mu_vec_delete_range(mu_vec_t *v, size_t index, size_t n,
+                                 void *items_out);
+
+/**
+ * @brief Replace the `n_old` items starting at `index` with `n_new` items.
+ *
+ * The tail is moved at most once, by `n_new - n_old` positions; when the
+ * counts are equal the items are simply overwritten.  All or nothing: if the
+ * result would not fit, the vector is unchanged.
+ *
+ * @param v      Pointer to the vector. Must not be NULL.
+ * @param index  Position of the first item to replace.
+ * @param n_old  Number of existing items to remove.
+ * @param items  Array of `n_new` items; may be NULL only if `n_new` is 0.
+ *               Must not overlap the vector's storage.
+ * @param n_new  Number of items to put in their place.
+ * @return       MU_STORE_ERR_NONE,
+ *               MU_STORE_ERR_PARAM if `v` (or `items` with n_new > 0) is
+ *               NULL,
+ *               MU_STORE_ERR_INDEX if `index + n_old > count`,
+ *               MU_STORE_ERR_FULL if the result exceeds the capacity.
+ */
+mu_vec_err_t mu_vec_replace_range(mu_vec_t *v, size_t index, size_t n_old,
+                                  const void *items, size_t n_new);
+
+/**
+ * @brief Copy the `n` items starting at `index` into a contiguous buffer.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param index      Position of the first item to copy.
+ * @param n          Number of items to copy.
+ * @param items_out  Buffer of at least `n` items; may be NULL only if `n` is
+ *                   0.
+ * @return           MU_STORE_ERR_NONE,
+ *                   MU_STORE_ERR_PARAM if `v` (or `items_out` with n > 0) is
+ *                   NULL,
+ *                   MU_STORE_ERR_INDEX if `index + n > count`.
+ */
+mu_vec_err_t mu_vec_copy_out_range(const mu_vec_t *v, size_t index, size_t n,
+                                   void *items_out);
+
 /**
  * @brief Find the first index matching `find_fn(item,arg) == true`.
  * @param v         Pointer to the vector. Must not be NULL.
@@ -234,6 +425,171 @@ mu_vec_err_t mu_vec_find(const mu_vec_t *v, mu_vec_find_fn find_fn,
 mu_vec_err_t mu_vec_rfind(const mu_vec_t *v, mu_vec_find_fn find_fn,
                           const void *arg, size_t *index_out);
 
+/**
+ * @brief Find the first index at or after `start` matching
+ * `find_fn(item,arg) == true`.
+ *
+ * Resumes a search: after a match at `i`, search again from `i + 1`.
+ *
+ * @param v         Pointer to the vector. Must not be NULL.
+ * @param start     First index to test [0..count].
+ * @param find_fn   Function to test each element; must not be NULL.
+ * @param arg       Extra argument for `find_fn`; may be NULL.
+ * @param index_out Address to receive the found index; must not be NULL.
+ * @return          MU_STORE_ERR_NONE,
+ *                  MU_STORE_ERR_PARAM if `v`, `find_fn`, or `index_out` is
+ * NULL, MU_STORE_ERR_INDEX if `start > count`, MU_STORE_ERR_NOTFOUND if no
+ * match.
+ */
+mu_vec_err_t mu_vec_find_from(const mu_vec_t *v, size_t start,
+                              mu_vec_find_fn find_fn, const void *arg,
+                              size_t *index_out);
+
+/**
+ * @brief Collect the indices of all elements matching
+ * `find_fn(item,arg) == true` in one pass.
+ *
+ * Equivalent to mu_vec_find_all_from() with `start` 0.
+ *
+ * @param v           Pointer to the vector. Must not be NULL.
+ * @param find_fn     Function to test each element; must not be NULL.
+ * @param arg         Extra argument for `find_fn`; may be NULL.
+ * @param indices     Buffer of `max_indices` indices; may be NULL only if
+ *                    `max_indices` is 0.
+ * @param max_indices Number of indices `indices` can hold.
+ * @param n_found     Address to receive the number of indices written; must
+ *                    not be NULL.
+ * @return            MU_STORE_ERR_NONE,
+ *                    MU_STORE_ERR_PARAM if `v`, `find_fn` or `n_found` is
+ * NULL, or `indices` is NULL and `max_indices` is not 0,
+ *                    MU_STORE_ERR_FULL if there are more matches than fit.
+ */
+mu_vec_err_t mu_vec_find_all(const mu_vec_t *v, mu_vec_find_fn find_fn,
+                             const void *arg, size_t *indices,
+                             size_t max_indices, size_t *n_found);
+
+/**
+ * @brief Collect the indices of all elements at or after `start` matching
+ * `find_fn(item,arg) == true` in one pass.
+ *
+ * Indices are written in ascending order.  If there are more than
+ * `max_indices` matches, the first `max_indices` are written and
+ * MU_STORE_ERR_FULL is returned; the search continues by calling again with
+ * `start` one past the last index written, or with the same `start` if
+ * nothing was written (`max_indices` is 0).
+ *
+ * @param v           Pointer to the vector. Must not be NULL.
+ * @param start       First index to test [0..count].
+ * @param find_fn     Function to test each element; must not be NULL.
+ * @param arg         Extra argument for `find_fn`; may be NULL.
+ * @param indices     Buffer of `max_indices` indices; may be NULL only if
+ *                    `max_indices` is 0.
+ * @param max_indices Number of indices `indices` can hold.
+ * @param n_found     Address to receive the number of indices written; must
+ *                    not be NULL.
+ * @return            MU_STORE_ERR_NONE,
+ *                    MU_STORE_ERR_PARAM if `v`, `find_fn` or `n_found` is
+ * NULL, or `indices` is NULL and `max_indices` is not 0,
+ *                    MU_STORE_ERR_INDEX if `start > count`,
+ *                    MU_STORE_ERR_FULL if there are more matches than fit.
+ */
+mu_vec_err_t mu_vec_find_all_from(const mu_vec_t *v, size_t start,
+                                  mu_vec_find_fn find_fn, const void *arg,
+                                  size_t *indices, size_t max_indices,
+                                  size_t *n_found);
+
+/**
+ * @brief Append the indices of all elements matching
+ * `find_fn(item,arg) == true` to a vector of `size_t`.
+ *
+ * As mu_vec_find_all(), writing into the free space of `out` and adding the
+ * indices written to its count.  If `out` fills up, MU_STORE_ERR_FULL is
+ * returned with the indices that fit appended; the search can be continued
+ * with mu_vec_find_all_from() one past the last index appended, or from 0
+ * if `out` was already full.
+ *
+ * @param v       Pointer to the vector to search. Must not be NULL.
+ * @param find_fn Function to test each element; must not be NULL.
+ * @param arg     Extra argument for `find_fn`; may be NULL.
+ * @param out     Vector receiving the indices; must not be NULL, its
+ *                `item_size` must be `sizeof(size_t)`, and its storage must
+ *                not overlap the items of `v`.
+ * @return        MU_STORE_ERR_NONE,
+ *                MU_STORE_ERR_PARAM if `v`, `find_fn` or `out` is NULL, `out`
+ * does not hold `size_t` items, or its storage overlaps the items of `v`,
+ *                MU_STORE_ERR_FULL if there are more matches than fit.
+ */
+mu_vec_err_t mu_vec_find_all_vec(const mu_vec_t *v, mu_vec_find_fn find_fn,
+                                 const void *arg, mu_vec_t *out);
+
+/**
+ * @brief Keep only the elements for which `keep_fn(item,arg)` is true.
+ *
+ * A single pass that tests each element once and moves each run of kept
+ * elements at most once; the kept elements keep their relative order.
+ *
+ * @param v       Pointer to the vector. Must not be NULL.
+ * @param keep_fn Function to test each element; must not be NULL.
+ * @param arg     Extra argument for `keep_fn`; may be NULL.
+ * @return        MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_retain(mu_vec_t *v, mu_vec_find_fn keep_fn,
+                           const void *arg);
+
+/**
+ * @brief Find the first element whose field at `field_offset` equals
+ * `*value`, comparing inline rather than through a find function.
+ *
+ * See mu_store_find_eq().
+ *
+ * @param v            Pointer to the vector. Must not be NULL.
+ * @param field_offset Byte offset of the field within each element.
+ * @param field_width  Size of the field in bytes: 1, 2, 4 or 8.
+ * @param value        Pointer to the value to look for; must not be NULL.
+ * @param index_out    Address to receive the found index; must not be NULL.
+ * @return             MU_STORE_ERR_NONE, MU_STORE_ERR_NOTFOUND if no match,
+ *                     MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_find_eq(const mu_vec_t *v, size_t field_offset,
+                            size_t field_width, const void *value,
+                            size_t *index_out);
+
+/**
+ * @brief Count the elements whose field at `field_offset` equals `*value`.
+ *
+ * See mu_store_count_eq().
+ *
+ * @param v            Pointer to the vector. Must not be NULL.
+ * @param field_offset Byte offset of the field within each element.
+ * @param field_width  Size of the field in bytes: 1, 2, 4 or 8.
+ * @param value        Pointer to the value to count; must not be NULL.
+ * @param count_out    Address to receive the count; must not be NULL.
+ * @return             MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_count_eq(const mu_vec_t *v, size_t field_offset,
+                             size_t field_width, const void *value,
+                             size_t *count_out);
+
+/**
+ * @brief Find the first element whose numeric key lies within [*lo, *hi].
+ *
+ * See mu_store_find_range().
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param key_offset Byte offset of the key within each element.
+ * @param key_width  Size of the key in bytes: 1, 2, 4 or 8.
+ * @param flags      Key type.
+ * @param lo         Pointer to the inclusive lower bound; must not be NULL.
+ * @param hi         Pointer to the inclusive upper bound; must not be NULL.
+ * @param index_out  Address to receive the found index; must not be NULL.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_NOTFOUND if no match,
+ *                   MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_find_range(const mu_vec_t *v, size_t key_offset,
+                               size_t key_width, mu_store_radix_flags_t flags,
+                               const void *lo, const void *hi,
+                               size_t *index_out);
+
 /**
  * @brief Sort the elements in the vector in-place.
  * @param v          Pointer to the vector. Must not be NULL.
@@ -242,6 +598,146 @@ mu_vec_err_t mu_vec_rfind(const mu_vec_t *v, mu_vec_find_fn find_fn,
  */
 mu_vec_err_t mu_vec_sort(mu_vec_t *v, mu_vec_compare_fn compare_fn);
 
+/**
+ * @brief Stable sort of the elements in the vector in-place.
+ *
+ * Elements that compare equal keep their relative order.  See
+ * mu_store_stable_sort() for how the optional scratch buffer is used.
+ *
+ * @param v             Pointer to the vector. Must not be NULL.
+ * @param compare_fn    Comparison function; must not be NULL.
+ * @param scratch       Optional scratch buffer of `scratch_count` items; may
+ *                      be NULL.
+ * @param scratch_count Number of items `scratch` can hold.
+ * @return              MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_stable_sort(mu_vec_t *v, mu_vec_compare_fn compare_fn,
+                                void *scratch, size_t scratch_count);
+
+/**
+ * @brief Stable radix sort of the elements by a numeric key field.
+ *
+ * See mu_store_radix_sort() for the supported key types and flags.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param key_offset Byte offset of the key within each element.
+ * @param key_width  Size of the key in bytes (1, 2, 4 or 8).
+ * @param flags      Key type, optionally or'd with MU_STORE_RADIX_DESCENDING.
+ * @param scratch    Scratch buffer of at least `count` elements; must not be
+ *                   NULL, even if the vector is empty.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_radix_sort(mu_vec_t *v, size_t key_offset,
+                               size_t key_width, mu_store_radix_flags_t flags,
+                               void *scratch);
+
+/**
+ * @brief Place the `nth` element in its sorted position.
+ *
+ * See mu_store_select(): no element before index `nth` compares greater than
+ * it, and none after it compares less.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param nth        Index to place; must be less than the vector's count.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_select(mu_vec_t *v, size_t nth,
+                           mu_vec_compare_fn compare_fn);
+
+/**
+ * @brief Sort the `k` smallest elements into the front of the vector.
+ *
+ * See mu_store_partial_sort().  The order of the remaining elements is
+ * unspecified.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param k          Number of leading elements to sort.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_partial_sort(mu_vec_t *v, size_t k,
+                                 mu_vec_compare_fn compare_fn);
+
+/**
+ * @brief Copy the `k` smallest elements, in order, into `out`.
+ *
+ * See mu_store_topk().  The vector is not modified.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param k          Maximum number of elements to copy.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @param out        Buffer for `min(k, count)` elements.
+ * @param n_out      Optional; receives the number of elements written.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_topk(const mu_vec_t *v, size_t k,
+                         mu_vec_compare_fn compare_fn, void *out,
+                         size_t *n_out);
+
+/**
+ * @brief Compute the stable sorting permutation of the vector's elements.
+ *
+ * See mu_store_argsort().  The vector is not modified.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param compare_fn Comparison function; must not be NULL.
+ * @param indices    Array of `count` indices to receive the permutation.
+ * @param index_size `sizeof(uint32_t)` or `sizeof(size_t)`.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_argsort(const mu_vec_t *v, mu_vec_compare_fn compare_fn,
+                            void *indices, size_t index_size);
+
+/**
+ * @brief Reorder the vector's elements according to a permutation.
+ *
+ * See mu_store_apply_permutation().  `perm` is restored afterwards, so one
+ * permutation can reorder several parallel vectors in lockstep.
+ *
+ * @param v          Pointer to the vector. Must not be NULL.
+ * @param perm       Permutation of [0..count).
+ * @param index_size `sizeof(uint32_t)` or `sizeof(size_t)`.
+ * @return           MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_apply_permutation(mu_vec_t *v, void *perm,
+                                      size_t index_size);
+
+/**
+ * @brief Move the elements matching `pred_fn(item,arg)` to the front.
+ *
+ * Unstable; see mu_store_partition().
+ *
+ * @param v       Pointer to the vector. Must not be NULL.
+ * @param pred_fn Predicate; must not be NULL.
+ * @param arg     Extra argument for `pred_fn`; may be NULL.
+ * @param split   Receives the number of matching elements; must not be NULL.
+ * @return        MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_partition(mu_vec_t *v, mu_vec_find_fn pred_fn,
+                              const void *arg, size_t *split);
+
+/**
+ * @brief Move the elements matching `pred_fn(item,arg)` to the front,
+ * preserving the relative order of both groups.
+ *
+ * See mu_store_stable_partition() for how the optional scratch buffer is
+ * used.
+ *
+ * @param v             Pointer to the vector. Must not be NULL.
+ * @param pred_fn       Predicate; must not be NULL.
+ * @param arg           Extra argument for `pred_fn`; may be NULL.
+ * @param scratch       Optional scratch buffer of `scratch_count` items; may
+ *                      be NULL.
+ * @param scratch_count Number of items `scratch` can hold.
+ * @param split         Receives the number of matching elements; must not be
+ *                      NULL.
+ * @return              MU_STORE_ERR_NONE, MU_STORE_ERR_PARAM otherwise.
+ */
+mu_vec_err_t mu_vec_stable_partition(mu_vec_t *v, mu_vec_find_fn pred_fn,
+                                     const void *arg, void *scratch,
+                                     size_t scratch_count, size_t *split);
+
 /**
  * @brief Reverse the order of stored pointers.
  * @param v Pointer to the vector. Must not be NULL.
@@ -252,17 +748,21 @@ mu_vec_err_t mu_vec_reverse(mu_vec_t *v);
 /**
  * @brief Inserts or updates an element in a sorted mu_vec according to policy.
  *
- * Performs a single linear scan to locate any existing “equal” elements (cmp ==
- * 0), then:
+ * Uses a binary search (see mu_store_search()) to locate the first element
+ * that is not less than `item`; policies that need the end of the run of
+ * equal elements (cmp == 0) perform a second binary search over the remainder
+ * with mu_store_search_upper().  Every policy therefore costs O(log n)
+ * comparisons, plus the memmove required to open a slot.  Then:
  *   - For update‐only policies (MU_STORE_UPDATE_*), replaces matching slots.
  *   - For upsert policies (MU_STORE_UPSERT_*), updates if found, otherwise
  * falls through to a normal insert.
  *   - For conditional‐insert policies (MU_STORE_INSERT_UNIQUE, _DUPLICATE,
  *     _FIRST, _LAST), enforces the policy or returns an error.
- *   - For MU_STORE_INSERT_ANY (or any other policy not handled above), or once
- *     upsert/update conditions are exhausted, does a “default” sorted insert:
- *       finds the first element > item and inserts before it, or appends if
- *       none are greater.
+ *   - For MU_STORE_INSERT_ANY (or any other policy not handled above), does a
+ *     “default” sorted insert: inserts after any equal elements, before the
+ *     first element > item, or appends if none are greater.
+ *
+ * The vector must already be sorted according to `cmp`.
  *
  * @param v      Pointer to the mu_vec to operate on.  Must not be NULL.
  * @param item   Pointer to the new element to insert or use for comparisons.
@@ -274,7 +774,7 @@ mu_vec_err_t mu_vec_reverse(mu_vec_t *v);
  * @param policy One of the mu_store_insert_policy_t values describing how to
  *               update or insert when matches occur.
  * @return MU_STORE_ERR_NONE on success; otherwise:
- *         - MU_STORE_ERR_PARAM    if `v` or `cmp` is NULL,
+ *         - MU_STORE_ERR_PARAM    if `v`, `item` or `cmp` is NULL,
  *         - MU_STORE_ERR_NOTFOUND if an update policy found no match,
  *         - MU_STORE_ERR_EXISTS   if MU_STORE_INSERT_UNIQUE found a match,
  *         - MU_STORE_ERR_FULL     if an insert was required but the vector is
@@ -285,6 +785,31 @@ mu_vec_err_t mu_vec_sorted_insert(mu_vec_t *v, const void *item,
                                   mu_vec_compare_fn cmp,
                                   mu_vec_insert_policy_t policy);
 
+/**
+ * @brief Insert or update in sorted order, starting the search from a hint.
+ *
+ * Behaves exactly like mu_vec_sorted_insert(), but locates the first element
+ * >= `item` with mu_store_search_from() starting at `*hint`, and stores that
+ * index back in `*hint`.  Passing the same `hint` variable to successive
+ * calls makes insertions that land at or near the previous one (such as
+ * mostly increasing timestamps) cost O(1) comparisons instead of O(log n).
+ * Initialize the hint to 0, or to mu_vec_count() for append-heavy streams;
+ * any value is correct, only the cost changes.
+ *
+ * @param v      Pointer to the vector. Must not be NULL.
+ * @param item   Pointer to the element to insert or update. Must not be NULL.
+ * @param cmp    Comparison function, as for mu_vec_sorted_insert().
+ * @param policy One of the mu_store_insert_policy_t values.
+ * @param hint   In: expected position. Out: lower bound of `item` before the
+ *               operation. Must not be NULL.
+ * @return As mu_vec_sorted_insert(); also MU_STORE_ERR_PARAM if `hint` is
+ *         NULL.
+ */
+mu_vec_err_t mu_vec_sorted_insert_hint(mu_vec_t *v, const void *item,
+                                       mu_vec_compare_fn cmp,
+                                       mu_vec_insert_policy_t policy,
+                                       size_t *hint);
+
 // *****************************************************************************
 // End of file
 
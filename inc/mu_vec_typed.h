@@ -0,0 +1,372 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_vec_typed.h
+ *
+ * @brief Typed, comparator-inlined wrappers around mu_vec_t.
+ *
+ * `MU_VEC_DEFINE(name, T, less)` expands to a family of `static inline`
+ * functions named `name_<op>` that operate on an ordinary mu_vec_t holding
+ * items of type `T`.  Because the item size is `sizeof(T)` and `less` is
+ * called directly, the compiler can inline the comparison and use fixed-size
+ * moves instead of the runtime `item_size` and indirect `mu_store_compare_fn`
+ * calls of the generic API.
+ *
+ * The generated functions share storage and layout with mu_vec: a vector
+ * initialized with `name_init()` may be passed to any `mu_vec_*()` function,
+ * and vice versa, provided `item_size == sizeof(T)`.
+ *
+ * `less` is a function or function-like macro taking two `const T *` and
+ * returning non-zero if the first item sorts strictly before the second.  It
+ * must define a strict weak ordering.  Example:
+ *
+ * @code
+ * typedef struct { uint64_t ts; uint32_t qty; } tick_t;
+ * static inline bool tick_less(const tick_t *a, const tick_t *b) {
+ *     return a->ts < b->ts;
+ * }
+ * MU_VEC_DEFINE(tick_vec, tick_t, tick_less)
+ *
+ * tick_t ticks[1000];
+ * mu_vec_t v;
+ * tick_vec_init(&v, ticks, 1000);
+ * tick_vec_sorted_insert(&v, &(tick_t){.ts = 42}, MU_STORE_INSERT_ANY);
+ * @endcode
+ */
+
+#ifndef _MU_VEC_TYPED_H_
+#define _MU_VEC_TYPED_H_
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store.h"
+#include "mu_vec.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// *****************************************************************************
+// Public types and definitions
+
+/**
+ * @brief Partitions at or below this size are left for the final insertion
+ * sort pass of the generated `_sort()` function.
+ */
+#ifndef MU_VEC_TYPED_INSERTION_THRESHOLD
+#define MU_VEC_TYPED_INSERTION_THRESHOLD 16
+#endif
+
+/**
+ * @brief Generate typed, comparator-inlined functions for a mu_vec of `T`.
+ *
+ * Generates (each prefixed with `name_`):
+ *   - init(v, store, capacity)        mu_vec_init() with sizeof(T)
+ *   - data(v)                         typed pointer to the item store
+ *   - push(v, item) / pop(v, out)     as mu_vec_push() / mu_vec_pop()
+ *   - insert(v, index, item)          as mu_vec_insert()
+ *   - delete(v, index, out)           as mu_vec_delete()
+ *   - find(v, key, index_out)         first item equal to `key`
+ *   - sort(v)                         unstable introsort
+ *   - search(v, key)                  lower bound, as mu_store_search()
+ *   - search_upper(v, key)            upper bound, as mu_store_search_upper()
+ *   - sorted_insert(v, item, policy)  as mu_vec_sorted_insert()
+ *
+ * Error codes and insertion policies are those of mu_vec.
+ *
+ * @param name Prefix for the generated functions.
+ * @param T    Item type.
+ * @param less Strict "less than" predicate on two `const T *`.
+ */
+#define MU_VEC_DEFINE(name, T, less)                                           \
+                                                                               \
+    static inline mu_vec_t *name##_init(mu_vec_t *v, T *store,                 \
+                                        size_t capacity) {                     \
+        return mu_vec_init(v, store, capacity, sizeof(T));                     \
+    }                                                                          \
+                                                                               \
+    static inline T *name##_data(const mu_vec_t *v) {                          \
+        return (T *)v->item_store;                                             \
+    }                                                                          \
+                                                                               \
+    static inline mu_vec_err_t name##_push(mu_vec_t *v, const T *item) {       \
+        if (!v || !item) {                                                     \
+            return MU_STORE_ERR_PARAM;                                         \
+        }                                                                      \
+        if (v->count >= v->capacity) {                                         \
+            return MU_STORE_ERR_FULL;                                          \
+        }                                                                      \
+        name##_data(v)[v->count++] = *item;                                    \
+        return MU_STORE_ERR_NONE;                                              \
+    }                                                                          \
+                                                                               \
+    static inline mu_vec_err_t name##_pop(mu_vec_t *v, T *item_out) {          \
+        if (!v) {                                                              \
+            return MU_STORE_ERR_PARAM;                                         \
+        }                                                                      \
+        if (v->count == 0) {                                                   \
+            return MU_STORE_ERR_EMPTY;                                         \
+        }                                                                      \
+        v->count--;                                                            \
+        if (item_out) {                                                        \
+            *item_out = name##_data(v)[v->count];                              \
+        }                                                                      \
+        return MU_STORE_ERR_NONE;                                              \
+    }                                                                          \
+                                                                               \
+    static inline mu_vec_err_t name##_insert(mu_vec_t *v, size_t index,        \
+                                             const T *item) {                  \
+        if (!v || !item) {                                                     \
+            return MU_STORE_ERR_PARAM;                                         \
+        }                                                                      \
+        if (index > v->count) {                                                \
+            return MU_STORE_ERR_INDEX;                                         \
+        }                                                                      \
+        if (v->count >= v->capacity) {                                         \
+            return MU_STORE_ERR_FULL;                                          \
+        }                                                                      \
+        T *a = name##_data(v);                                                 \
+        T tmp = *item; /* `item` may point into the store */                   \
+        memmove(&a[index + 1], &a[index], (v->count - index) * sizeof(T));     \
+        a[index] = tmp;                                                        \
+        v->count++;                                                            \
+        return MU_STORE_ERR_NONE;                                              \
+    }                                                                          \
+                                                                               \
+    static inline mu_vec_err_t name##_delete(mu_vec_t *v, size_t index,        \
+                                             T *item_out) {                    \
+        if (!v) {                                                              \
+            return MU_STORE_ERR_PARAM;                                         \
+        }                                                                      \
+        if (index >= v->count) {                                               \
+            return MU_STORE_ERR_INDEX;                                         \
+        }                                                                      \
+        T *a = name##_data(v);                                                 \
+        if (item_out) {                                                        \
+            *item_out = a[index];                                              \
+        }                                                                      \
+        memmove(&a[index], &a[index + 1], (v->count - index - 1) * sizeof(T)); \
+        v->count--;                                                            \
+        return MU_STORE_ERR_NONE;                                              \
+    }                                                                          \
+                                                                               \
+    static inline mu_vec_err_t name##_find(const mu_vec_t *v, const T *key,    \
+                                           size_t *index_out) {                \
+        if (!v || !key || !index_out) {                                        \
+            return MU_STORE_ERR_PARAM;                                         \
+        }                                                                      \
+        const T *a = name##_data(v);                                           \
+        for (size_t i = 0; i < v->count; ++i) {                                \
+            if (!less(&a[i], key) && !less(key, &a[i])) {                      \
+                *index_out = i;                                                \
+                return MU_STORE_ERR_NONE;                                      \
+            }                                                                  \
+        }                                                                      \
+        return MU_STORE_ERR_NOTFOUND;                                          \
+    }                                                                          \
+                                                                               \
+    static inline size_t name##_search(const mu_vec_t *v, const T *key) {      \
+        const T *a = name##_data(v);                                           \
+        size_t lo = 0, n = v->count;                                           \
+        while (n > 0) {                                                        \
+            size_t half = n / 2;                                               \
+            if (less(&a[lo + half], key)) {                                    \
+                lo += half + 1;                                                \
+                n -= half + 1;                                                 \
+            } else {                                                           \
+                n = half;                                                      \
+            }                                                                  \
+        }                                                                      \
+        return lo;                                                             \
+    }                                                                          \
+                                                                               \
+    static inline size_t name##_search_upper(const mu_vec_t *v,                \
+                                             const T *key) {                   \
+        const T *a = name##_data(v);                                           \
+        size_t lo = 0, n = v->count;                                           \
+        while (n > 0) {                                                        \
+            size_t half = n / 2;                                               \
+            if (!less(key, &a[lo + half])) {                                   \
+                lo += half + 1;                                                \
+                n -= half + 1;                                                 \
+            } else {                                                           \
+                n = half;                                                      \
+            }                                                                  \
+        }                                                                      \
+        return lo;                                                             \
+    }                                                                          \
+                                                                               \
+    static inline void name##_swap_(T *a, T *b) {                              \
+        T tmp = *a;                                                            \
+        *a = *b;                                                               \
+        *b = tmp;                                                              \
+    }                                                                          \
+                                                                               \
+    static inline void name##_sift_down_(T *a, size_t root, size_t n) {        \
+        for (size_t child; (child = 2 * root + 1) < n; root = child) {         \
+            if (child + 1 < n && less(&a[child], &a[child + 1])) {             \
+                child++;                                                       \
+            }                                                                  \
+            if (!less(&a[root], &a[child])) {                                  \
+                return;                                                        \
+            }                                                                  \
+            name##_swap_(&a[root], &a[child]);                                 \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    static inline void name##_heap_sort_(T *a, size_t n) {                     \
+        for (size_t i = n / 2; i-- > 0;) {                                     \
+            name##_sift_down_(a, i, n);                                        \
+        }                                                                      \
+        for (size_t i = n; i-- > 1;) {                                         \
+            name##_swap_(&a[0], &a[i]);                                        \
+            name##_sift_down_(a, 0, i);                                        \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    /* Quicksort down to MU_VEC_TYPED_INSERTION_THRESHOLD-sized partitions,   \
+       falling back to heapsort once `depth` is exhausted. */                  \
+    static void name##_introsort_(T *a, size_t n, int depth) {                 \
+        while (n > MU_VEC_TYPED_INSERTION_THRESHOLD) {                         \
+            if (depth-- == 0) {                                                \
+                name##_heap_sort_(a, n);                                       \
+                return;                                                        \
+            }                                                                  \
+            /* Median of three; a[0] and a[n-1] then act as sentinels. */      \
+            size_t mid = n / 2;                                                \
+            if (less(&a[mid], &a[0])) name##_swap_(&a[mid], &a[0]);            \
+            if (less(&a[n - 1], &a[mid])) name##_swap_(&a[n - 1], &a[mid]);    \
+            if (less(&a[mid], &a[0])) name##_swap_(&a[mid], &a[0]);            \
+            T pivot = a[mid];                                                  \
+            size_t i = 0, j = n - 1;                                           \
+            for (;;) {                                                         \
+                while (less(&a[++i], &pivot)) {                                \
+                }                                                              \
+                while (less(&pivot, &a[--j])) {                                \
+                }                                                              \
+                if (i >= j) {                                                  \
+                    break;                                                     \
+                }                                                              \
+                name##_swap_(&a[i], &a[j]);                                    \
+            }                                                                  \
+            /* [0, i) <= pivot <= [i, n): recurse on the smaller side. */      \
+            if (i < n - i) {                                                   \
+                name##_introsort_(a, i, depth);                                \
+                a += i;                                                        \
+                n -= i;                                                        \
+            } else {                                                           \
+                name##_introsort_(a + i, n - i, depth);                        \
+                n = i;                                                         \
+            }                                                                  \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    static inline mu_vec_err_t name##_sort(mu_vec_t *v) {                      \
+        if (!v) {                                                              \
+            return MU_STORE_ERR_PARAM;                                         \
+        }                                                                      \
+        T *a = name##_data(v);                                                 \
+        size_t n = v->count;                                                   \
+        int depth = 0;                                                         \
+        for (size_t k = n; k > 1; k >>= 1) {                                   \
+            depth += 2;                                                        \
+        }                                                                      \
+        name##_introsort_(a, n, depth);                                        \
+        /* Finish the small partitions left behind by introsort. */            \
+        for (size_t i = 1; i < n; ++i) {                                       \
+            T tmp = a[i];                                                      \
+            size_t j = i;                                                      \
+            while (j > 0 && less(&tmp, &a[j - 1])) {                           \
+                a[j] = a[j - 1];                                               \
+                j--;                                                           \
+            }                                                                  \
+            a[j] = tmp;                                                        \
+        }                                                                      \
+        return MU_STORE_ERR_NONE;                                              \
+    }                                                                          \
+                                                                               \
+    static inline mu_vec_err_t name##_sorted_insert(                           \
+        mu_vec_t *v, const T *item, mu_vec_insert_policy_t policy) {           \
+        if (!v || !item) {                                                     \
+            return MU_STORE_ERR_PARAM;                                         \
+        }                                                                      \
+        T *a = name##_data(v);                                                 \
+        size_t lo = name##_search(v, item);                                    \
+        bool found = lo < v->count && !less(item, &a[lo]);                     \
+        size_t hi = lo;                                                        \
+        if (found) {                                                           \
+            /* End of the matching run: upper bound within [lo, count). */     \
+            for (size_t n = v->count - lo; n > 0;) {                           \
+                size_t half = n / 2;                                           \
+                if (!less(item, &a[hi + half])) {                              \
+                    hi += half + 1;                                            \
+                    n -= half + 1;                                             \
+                } else {                                                       \
+                    n = half;                                                  \
+                }                                                              \
+            }                                                                  \
+        }                                                                      \
+        switch (policy) {                                                      \
+        case MU_STORE_UPDATE_FIRST:                                            \
+        case MU_STORE_UPDATE_LAST:                                             \
+        case MU_STORE_UPDATE_ALL:                                              \
+            if (!found) {                                                      \
+                return MU_STORE_ERR_NOTFOUND;                                  \
+            }                                                                  \
+            if (policy == MU_STORE_UPDATE_ALL) {                               \
+                for (size_t i = lo; i < hi; ++i) {                             \
+                    a[i] = *item;                                              \
+                }                                                              \
+            } else {                                                           \
+                a[policy == MU_STORE_UPDATE_FIRST ? lo : hi - 1] = *item;      \
+            }                                                                  \
+            return MU_STORE_ERR_NONE;                                          \
+        case MU_STORE_UPSERT_FIRST:                                            \
+        case MU_STORE_UPSERT_LAST:                                             \
+            if (found) {                                                       \
+                a[policy == MU_STORE_UPSERT_FIRST ? lo : hi - 1] = *item;      \
+                return MU_STORE_ERR_NONE;                                      \
+            }                                                                  \
+            return name##_insert(v, lo, item);                                 \
+        case MU_STORE_INSERT_UNIQUE:                                           \
+            if (found) {                                                       \
+                return MU_STORE_ERR_EXISTS;                                    \
+            }                                                                  \
+            return name##_insert(v, lo, item);                                 \
+        case MU_STORE_INSERT_DUPLICATE:                                        \
+            if (!found) {                                                      \
+                return MU_STORE_ERR_NOTFOUND;                                  \
+            }                                                                  \
+            return name##_insert(v, hi, item);                                 \
+        case MU_STORE_INSERT_FIRST:                                            \
+            return name##_insert(v, lo, item);                                 \
+        case MU_STORE_INSERT_LAST:                                             \
+        case MU_STORE_INSERT_ANY:                                              \
+        default:                                                               \
+            return name##_insert(v, hi, item);                                 \
+        }                                                                      \
+    }
+
+#endif /* _MU_VEC_TYPED_H_ */
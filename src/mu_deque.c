@@ -0,0 +1,378 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_deque.c
+ * @brief Implementation of the mu_deque fixed-size double-ended queue.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_deque.h"
+#include "mu_ring_internal.h"
+#include "mu_store.h" // For error codes
+#include <string.h> // For memcpy
+#include <stdint.h> // For uint8_t
+
+// *****************************************************************************
+// Private types and definitions
+
+
+// *****************************************************************************
+// Private static function declarations
+
+/**
+ * @brief Return the number of items in the deque.
+ */
+static inline size_t item_count(const mu_deque_t *d);
+
+/**
+ * @brief Return the address of the slot at (possibly free-running) `index`.
+ */
+static inline uint8_t *slot_address(const mu_deque_t *d, size_t index);
+
+/**
+ * @brief Copy `n` items from `src` into the ring starting at `index`.
+ */
+static void copy_in(mu_deque_t *d, size_t index, const uint8_t *src, size_t n);
+
+/**
+ * @brief Copy `n` items out of the ring starting at `index` into `dst`.
+ */
+static void copy_out(const mu_deque_t *d, size_t index, uint8_t *dst,
+                     size_t n);
+
+/**
+ * @brief Account for `n` items added at the back.
+ */
+static inline void grow_back(mu_deque_t *d, size_t n);
+
+/**
+ * @brief Account for `n` items added at the front.
+ */
+static inline void grow_front(mu_deque_t *d, size_t n);
+
+/**
+ * @brief Account for `n` items removed from the front.
+ */
+static inline void shrink_front(mu_deque_t *d, size_t n);
+
+/**
+ * @brief Account for `n` items removed from the back.
+ */
+static inline void shrink_back(mu_deque_t *d, size_t n);
+
+// *****************************************************************************
+// Public function definitions
+
+mu_deque_t *mu_deque_init(mu_deque_t *d, void *backing_store, size_t n_items,
+                          size_t item_size) {
+    if (!d || !backing_store || n_items == 0 || item_size == 0) {
+        return NULL;
+    }
+    d->items = backing_store;
+    d->capacity = n_items;
+    d->item_size = item_size;
+    d->count = 0;
+    d->head = 0;
+    d->tail = 0;
+    d->mask = mu_ring_mask(n_items);
+    return d;
+}
+
+size_t mu_deque_capacity(const mu_deque_t *d) {
+    return d ? d->capacity : 0;
+}
+
+size_t mu_deque_count(const mu_deque_t *d) {
+    return d ? item_count(d) : 0;
+}
+
+bool mu_deque_is_empty(const mu_deque_t *d) {
+    return d == NULL || item_count(d) == 0;
+}
+
+bool mu_deque_is_full(const mu_deque_t *d) {
+    return d == NULL || item_count(d) >= d->capacity;
+}
+
+mu_deque_err_t mu_deque_clear(mu_deque_t *d) {
+    if (!d) return MU_STORE_ERR_PARAM;
+    d->count = 0;
+    d->head = 0;
+    d->tail = 0;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_deque_err_t mu_deque_push_back(mu_deque_t *d, const void *item_in) {
+    if (!d || !item_in) return MU_STORE_ERR_PARAM;
+    if (mu_deque_is_full(d)) return MU_STORE_ERR_FULL;
+
+    memcpy(slot_address(d, d->tail), item_in, d->item_size);
+    grow_back(d, 1);
+    return MU_STORE_ERR_NONE;
+}
+
+mu_deque_err_t mu_deque_push_front(mu_deque_t *d, const void *item_in) {
+    if (!d || !item_in) return MU_STORE_ERR_PARAM;
+    if (mu_deque_is_full(d)) return MU_STORE_ERR_FULL;
+
+    // Step head back first: the new item goes into the slot before the front
+    grow_front(d, 1);
+    memcpy(slot_address(d, d->head), item_in, d->item_size);
+    return MU_STORE_ERR_NONE;
+}
+
+mu_deque_err_t mu_deque_pop_front(mu_deque_t *d, void *item_out) {
+    if (!d) return MU_STORE_ERR_PARAM;
+    if (mu_deque_is_empty(d)) return MU_STORE_ERR_EMPTY;
+
+    if (item_out) {
+        memcpy(item_out, slot_address(d, d->head), d->item_size);
+    }
+    shrink_front(d, 1);
+    return MU_STORE_ERR_NONE;
+}
+
+mu_deque_err_t mu_deque_pop_back(mu_deque_t *d, void *item_out) {
+    if (!d) return MU_STORE_ERR_PARAM;
+    if (mu_deque_is_empty(d)) return MU_STORE_ERR_EMPTY;
+
+    // Step tail back first: it then indexes the back item
+    shrink_back(d, 1);
+    if (item_out) {
+        memcpy(item_out, slot_address(d, d->tail), d->item_size);
+    }
+    return MU_STORE_ERR_NONE;
+}
+
+void *mu_deque_at(const mu_deque_t *d, size_t index) {
+    if (!d || index >= item_count(d)) return NULL;
+    size_t at = mu_ring_advance(d->capacity, d->mask, d->head, index);
+    return slot_address(d, at);
+}
+
+void *mu_deque_front(const mu_deque_t *d) {
+    return mu_deque_at(d, 0);
+}
+
+void *mu_deque_back(const mu_deque_t *d) {
+    if (!d || item_count(d) == 0) return NULL;
+    return slot_address(d, mu_ring_retreat(d->capacity, d->mask, d->tail, 1));
+}
+
+size_t mu_deque_push_back_n(mu_deque_t *d, const void *items_in, size_t n) {
+    if (!d || !items_in) return 0;
+
+    size_t space = d->capacity - item_count(d);
+    if (n > space) n = space;
+    copy_in(d, d->tail, (const uint8_t *)items_in, n);
+    grow_back(d, n);
+    return n;
+}
+
+size_t mu_deque_push_front_n(mu_deque_t *d, const void *items_in, size_t n) {
+    if (!d || !items_in) return 0;
+
+    size_t space = d->capacity - item_count(d);
+    if (n > space) n = space;
+    grow_front(d, n);
+    copy_in(d, d->head, (const uint8_t *)items_in, n);
+    return n;
+}
+
+size_t mu_deque_pop_front_n(mu_deque_t *d, void *items_out, size_t n) {
+    if (!d) return 0;
+
+    size_t count = item_count(d);
+    if (n > count) n = count;
+    if (items_out) {
+        copy_out(d, d->head, (uint8_t *)items_out, n);
+    }
+    shrink_front(d, n);
+    return n;
+}
+
+size_t mu_deque_pop_back_n(mu_deque_t *d, void *items_out, size_t n) {
+    if (!d) return 0;
+
+    size_t count = item_count(d);
+    if (n > count) n = count;
+    shrink_back(d, n);
+    if (items_out) {
+        copy_out(d, d->tail, (uint8_t *)items_out, n);
+    }
+    return n;
+}
+
+void *mu_deque_reserve_back(mu_deque_t *d) {
+    if (!d || mu_deque_is_full(d)) return NULL;
+    return slot_address(d, d->tail);
+}
+
+void *mu_deque_reserve_back_span(mu_deque_t *d, size_t n, size_t *n_reserved) {
+    if (!n_reserved) return NULL;
+    *n_reserved = 0;
+    if (!d) return NULL;
+
+    // Limited by the free space and by the end of the backing store
+    size_t space = d->capacity - item_count(d);
+    size_t to_end = mu_ring_to_end(d->capacity, d->mask, d->tail);
+    if (n > space) n = space;
+    if (n > to_end) n = to_end;
+    if (n == 0) return NULL;
+
+    *n_reserved = n;
+    return slot_address(d, d->tail);
+}
+
+mu_deque_err_t mu_deque_commit_back(mu_deque_t *d, size_t n) {
+    if (!d) return MU_STORE_ERR_PARAM;
+    if (n > d->capacity - item_count(d)) return MU_STORE_ERR_FULL;
+
+    grow_back(d, n);
+    return MU_STORE_ERR_NONE;
+}
+
+void *mu_deque_reserve_front(mu_deque_t *d) {
+    if (!d || mu_deque_is_full(d)) return NULL;
+    return slot_address(d, mu_ring_retreat(d->capacity, d->mask, d->head, 1));
+}
+
+void *mu_deque_reserve_front_span(mu_deque_t *d, size_t n,
+                                  size_t *n_reserved) {
+    if (!n_reserved) return NULL;
+    *n_reserved = 0;
+    if (!d) return NULL;
+
+    // Limited by the free space and by the start of the backing store
+    size_t space = d->capacity - item_count(d);
+    size_t slot = mu_ring_slot(d->mask, d->head);
+    size_t to_start = slot ? slot : d->capacity;
+    if (n > space) n = space;
+    if (n > to_start) n = to_start;
+    if (n == 0) return NULL;
+
+    *n_reserved = n;
+    return slot_address(d, mu_ring_retreat(d->capacity, d->mask, d->head, n));
+}
+
+mu_deque_err_t mu_deque_commit_front(mu_deque_t *d, size_t n) {
+    if (!d) return MU_STORE_ERR_PARAM;
+    if (n > d->capacity - item_count(d)) return MU_STORE_ERR_FULL;
+
+    grow_front(d, n);
+    return MU_STORE_ERR_NONE;
+}
+
+void *mu_deque_read_span(mu_deque_t *d, size_t n, size_t *n_read) {
+    if (!n_read) return NULL;
+    *n_read = 0;
+    if (!d) return NULL;
+
+    // Limited by the item count and by the end of the backing store
+    size_t count = item_count(d);
+    size_t to_end = mu_ring_to_end(d->capacity, d->mask, d->head);
+    if (n > count) n = count;
+    if (n > to_end) n = to_end;
+    if (n == 0) return NULL;
+
+    *n_read = n;
+    return slot_address(d, d->head);
+}
+
+mu_deque_err_t mu_deque_release_front(mu_deque_t *d, size_t n) {
+    if (!d) return MU_STORE_ERR_PARAM;
+    if (n > item_count(d)) return MU_STORE_ERR_EMPTY;
+
+    shrink_front(d, n);
+    return MU_STORE_ERR_NONE;
+}
+
+mu_deque_err_t mu_deque_release_back(mu_deque_t *d, size_t n) {
+    if (!d) return MU_STORE_ERR_PARAM;
+    if (n > item_count(d)) return MU_STORE_ERR_EMPTY;
+
+    shrink_back(d, n);
+    return MU_STORE_ERR_NONE;
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static inline size_t item_count(const mu_deque_t *d) {
+    return mu_ring_count(d->mask, d->head, d->tail, d->count);
+}
+
+static inline uint8_t *slot_address(const mu_deque_t *d, size_t index) {
+    return (uint8_t *)d->items + mu_ring_slot(d->mask, index) * d->item_size;
+}
+
+static void copy_in(mu_deque_t *d, size_t index, const uint8_t *src, size_t n) {
+    // At most two runs: up to the end of the store, then from its start.
+    size_t first = mu_ring_to_end(d->capacity, d->mask, index);
+    if (first > n) first = n;
+    memcpy(slot_address(d, index), src, first * d->item_size);
+    memcpy(d->items, src + first * d->item_size, (n - first) * d->item_size);
+}
+
+static void copy_out(const mu_deque_t *d, size_t index, uint8_t *dst,
+                     size_t n) {
+    size_t first = mu_ring_to_end(d->capacity, d->mask, index);
+    if (first > n) first = n;
+    memcpy(dst, slot_address(d, index), first * d->item_size);
+    memcpy(dst + first * d->item_size, d->items, (n - first) * d->item_size);
+}
+
+static inline void grow_back(mu_deque_t *d, size_t n) {
+    d->tail = mu_ring_advance(d->capacity, d->mask, d->tail, n);
+    if (!d->mask) {
+        d->count += n;
+    }
+}
+
+static inline void grow_front(mu_deque_t *d, size_t n) {
+    d->head = mu_ring_retreat(d->capacity, d->mask, d->head, n);
+    if (!d->mask) {
+        d->count += n;
+    }
+}
+
+static inline void shrink_front(mu_deque_t *d, size_t n) {
+    d->head = mu_ring_advance(d->capacity, d->mask, d->head, n);
+    if (!d->mask) {
+        d->count -= n;
+    }
+}
+
+static inline void shrink_back(mu_deque_t *d, size_t n) {
+    d->tail = mu_ring_retreat(d->capacity, d->mask, d->tail, n);
+    if (!d->mask) {
+        d->count -= n;
+    }
+}
+
+// *****************************************************************************
+// End of file
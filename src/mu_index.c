@@ -0,0 +1,242 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_index.c
+ * @brief Implementation of the mu_index Eytzinger search accelerator.
+ *
+ * Tree nodes are numbered from 1 in breadth-first order: node k has children
+ * 2k and 2k+1, and is stored at item_store[k - 1].  A search descends from
+ * node 1, stepping right whenever the key is greater than the node, until it
+ * falls off the tree.  The path taken is then encoded in the bits of k: the
+ * lower bound is the last node at which the search stepped left, found by
+ * stripping the trailing right-steps (1 bits) and that final left-step.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_index.h"
+#include "mu_store.h"
+#include <stdint.h> // For uint8_t
+#include <string.h> // For memcpy
+
+// *****************************************************************************
+// Private types and definitions
+
+// Bytes fetched per prefetch; the descendants covered by one prefetch should
+// fit in about this much memory.
+#define MU_INDEX_PREFETCH_BYTES 64
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MU_INDEX_PREFETCH(addr) __builtin_prefetch((addr), 0, 1)
+#else
+#define MU_INDEX_PREFETCH(addr) ((void)(addr))
+#endif
+
+// *****************************************************************************
+// Private static function declarations
+
+/**
+ * @brief Return the address of tree node `k` (1-based).
+ */
+static inline const uint8_t *node_at(const mu_index_t *ix, size_t k);
+
+/**
+ * @brief Descend the tree and return the sorted-array index of the lower
+ * bound of `item`.  `deref` selects whether the comparison function receives
+ * the node address or the pointer stored in the node.
+ */
+static inline size_t descend(const mu_index_t *ix,
+                             mu_index_compare_fn compare_fn, const void *item,
+                             bool deref);
+
+/**
+ * @brief Return the position in sorted order of tree node `k` (1-based).
+ */
+static size_t node_rank(const mu_index_t *ix, size_t k);
+
+/**
+ * @brief Return floor(log2(n)) for n > 0.
+ */
+static inline unsigned log2_floor(size_t n);
+
+/**
+ * @brief Return the number of trailing 1 bits in `n`.
+ */
+static inline unsigned trailing_ones(size_t n);
+
+// *****************************************************************************
+// Public function definitions
+
+mu_index_t *mu_index_init(mu_index_t *ix, void *item_store, size_t capacity,
+                          size_t item_size) {
+    if (!ix || !item_store || capacity == 0 || item_size == 0) {
+        return NULL;
+    }
+    ix->item_store = item_store;
+    ix->item_size = item_size;
+    ix->capacity = capacity;
+    ix->count = 0;
+    ix->height = 0;
+    ix->last_level_count = 0;
+
+    // Prefetch the 2^shift descendants `shift` levels down, which are
+    // contiguous, as long as they fit in a cache line (and at least the
+    // children otherwise).
+    unsigned shift = 1;
+    while (shift < 4 && (item_size << (shift + 1)) <= MU_INDEX_PREFETCH_BYTES) {
+        shift++;
+    }
+    ix->prefetch_shift = shift;
+    return ix;
+}
+
+size_t mu_index_count(const mu_index_t *ix) { return ix ? ix->count : 0; }
+
+mu_index_err_t mu_index_build(mu_index_t *ix, const void *sorted,
+                              size_t count) {
+    if (!ix || (!sorted && count > 0)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (count > ix->capacity) {
+        return MU_STORE_ERR_FULL;
+    }
+
+    ix->count = count;
+    if (count == 0) {
+        ix->height = 0;
+        ix->last_level_count = 0;
+        return MU_STORE_ERR_NONE;
+    }
+    ix->height = log2_floor(count);
+    ix->last_level_count = count - (((size_t)1 << ix->height) - 1);
+
+    // Each node takes the item whose sorted position matches the node's
+    // in-order position in the tree.
+    const uint8_t *src = (const uint8_t *)sorted;
+    uint8_t *dst = (uint8_t *)ix->item_store;
+    size_t size = ix->item_size;
+    for (size_t k = 1; k <= count; k++) {
+        memcpy(dst + (k - 1) * size, src + node_rank(ix, k) * size, size);
+    }
+    return MU_STORE_ERR_NONE;
+}
+
+mu_index_err_t mu_index_build_vec(mu_index_t *ix, const mu_vec_t *v) {
+    if (!ix || !v || v->item_size != ix->item_size) {
+        return MU_STORE_ERR_PARAM;
+    }
+    return mu_index_build(ix, v->item_store, v->count);
+}
+
+mu_index_err_t mu_index_build_pvec(mu_index_t *ix, const mu_pvec_t *v) {
+    if (!ix || !v || ix->item_size != sizeof(void *)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    return mu_index_build(ix, v->item_store, v->count);
+}
+
+size_t mu_index_search(const mu_index_t *ix, mu_index_compare_fn compare_fn,
+                       const void *item) {
+    return descend(ix, compare_fn, item, false);
+}
+
+size_t mu_index_psearch(const mu_index_t *ix, mu_index_compare_fn compare_fn,
+                        const void *item) {
+    return descend(ix, compare_fn, item, true);
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static inline const uint8_t *node_at(const mu_index_t *ix, size_t k) {
+    return (const uint8_t *)ix->item_store + (k - 1) * ix->item_size;
+}
+
+static inline size_t descend(const mu_index_t *ix,
+                             mu_index_compare_fn compare_fn, const void *item,
+                             bool deref) {
+    size_t n = ix->count;
+    unsigned shift = ix->prefetch_shift;
+    size_t k = 1;
+
+    while (k <= n) {
+        size_t ahead = k << shift;
+        if (ahead <= n) {
+            MU_INDEX_PREFETCH(node_at(ix, ahead));
+        }
+        const uint8_t *node = node_at(ix, k);
+        const void *other = deref ? *(void *const *)node : (const void *)node;
+        // Step right if item > node; the compiler turns this into a setcc
+        // rather than a branch.
+        k = 2 * k + (compare_fn(item, other) > 0);
+    }
+
+    // Undo the trailing right-steps and the left-step before them.
+    k >>= trailing_ones(k) + 1;
+    return k == 0 ? n : node_rank(ix, k);
+}
+
+static size_t node_rank(const mu_index_t *ix, size_t k) {
+    // Position of k in a perfect tree of height `height`, less the missing
+    // deepest-level nodes that would have preceded it.
+    unsigned depth = log2_floor(k);
+    size_t pos = k - ((size_t)1 << depth);
+    size_t rank = ((2 * pos + 1) << (ix->height - depth)) - 1;
+    size_t leaves_before = (rank + 1) / 2;
+    if (leaves_before > ix->last_level_count) {
+        rank -= leaves_before - ix->last_level_count;
+    }
+    return rank;
+}
+
+static inline unsigned log2_floor(size_t n) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)(sizeof(unsigned long long) * 8 - 1) -
+           (unsigned)__builtin_clzll((unsigned long long)n);
+#else
+    unsigned log = 0;
+    while (n >>= 1) {
+        log++;
+    }
+    return log;
+#endif
+}
+
+static inline unsigned trailing_ones(size_t n) {
+#if defined(__GNUC__) || defined(__clang__)
+    return (unsigned)__builtin_ctzll(~(unsigned long long)n);
+#else
+    unsigned ones = 0;
+    while (n & 1) {
+        n >>= 1;
+        ones++;
+    }
+    return ones;
+#endif
+}
+
+// *****************************************************************************
+// End of file
@@ -31,6 +31,7 @@
 // Includes
 
 #include "mu_pqueue.h"
+#include "mu_ring_internal.h"
 #include "mu_store.h" // For error codes
 #include <stdint.h>   // For uint8_t
 #include <string.h>   // For memcpy
@@ -41,6 +42,33 @@
 // *****************************************************************************
 // Private static function declarations
 
+/**
+ * @brief Return the number of items in the queue.
+ */
+static inline size_t item_count(const mu_pqueue_t *q);
+
+/**
+ * @brief Copy `n` pointers from `src` into the ring starting at `index`.
+ */
+static void copy_in(mu_pqueue_t *q, size_t index, void *const *src,
+                    size_t n);
+
+/**
+ * @brief Copy `n` pointers out of the ring starting at `index` into `dst`.
+ */
+static void copy_out(const mu_pqueue_t *q, size_t index, void **dst,
+                     size_t n);
+
+/**
+ * @brief Account for `n` items added at the tail.
+ */
+static inline void advance_tail(mu_pqueue_t *q, size_t n);
+
+/**
+ * @brief Account for `n` items removed from the head.
+ */
+static inline void advance_head(mu_pqueue_t *q, size_t n);
+
 // *****************************************************************************
 // Public function definitions (Pointer Queue)
 
@@ -54,20 +82,23 @@ mu_pqueue_t *mu_pqueue_init(mu_pqueue_t *q, void **backing_store,
     q->count = 0;
     q->head = 0; // Head starts at the beginning
     q->tail = 0; // Tail starts at the beginning
+    q->mask = mu_ring_mask(n_items);
     // No item_size for pointer queue
     return q;
 }
 
 size_t mu_pqueue_capacity(const mu_pqueue_t *q) { return q ? q->capacity : 0; }
 
-size_t mu_pqueue_count(const mu_pqueue_t *q) { return q ? q->count : 0; }
+size_t mu_pqueue_count(const mu_pqueue_t *q) {
+    return q ? item_count(q) : 0;
+}
 
 bool mu_pqueue_is_empty(const mu_pqueue_t *q) {
-    return q == NULL || q->count == 0;
+    return q == NULL || item_count(q) == 0;
 }
 
 bool mu_pqueue_is_full(const mu_pqueue_t *q) {
-    return q == NULL || q->count >= q->capacity;
+    return q == NULL || item_count(q) >= q->capacity;
 }
 
 mu_pqueue_err_t mu_pqueue_clear(mu_pqueue_t *q) {
@@ -85,17 +116,33 @@ mu_pqueue_err_t mu_pqueue_put(mu_pqueue_t *q, void *item_in) {
     if (mu_pqueue_is_full(q))
         return MU_STORE_ERR_FULL;
 
-    // Calculate the address of the tail slot (which holds a void* pointer)
-    void **tail_slot_ptr = q->items + q->tail;
-
     // Assign the pointer value into the tail slot
-    *tail_slot_ptr = item_in; // or q->items[q->tail] = item_in;
+    q->items[mu_ring_slot(q->mask, q->tail)] = item_in;
 
-    // Update tail index (circular)
-    q->tail = (q->tail + 1) % q->capacity;
+    // Update tail index (circular) and count
+    advance_tail(q, 1);
 
-    // Increment count
-    q->count++;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_pqueue_err_t mu_pqueue_put_overwrite(mu_pqueue_t *q, void *item_in,
+                                        void **evicted_out, bool *evicted) {
+    if (!q)
+        return MU_STORE_ERR_PARAM;
+
+    // When full, drop the oldest pointer so that head moves along with tail
+    bool full = mu_pqueue_is_full(q);
+    if (full) {
+        if (evicted_out) {
+            *evicted_out = q->items[mu_ring_slot(q->mask, q->head)];
+        }
+        advance_head(q, 1);
+    }
+    if (evicted)
+        *evicted = full;
+
+    q->items[mu_ring_slot(q->mask, q->tail)] = item_in;
+    advance_tail(q, 1);
 
     return MU_STORE_ERR_NONE;
 }
@@ -106,17 +153,11 @@ mu_pqueue_err_t mu_pqueue_get(mu_pqueue_t *q, void **item_out) {
     if (mu_pqueue_is_empty(q))
         return MU_STORE_ERR_EMPTY;
 
-    // Calculate the address of the head slot (which holds a void* pointer)
-    void **head_slot_ptr = q->items + q->head; // or &q->items[q->head];
-
     // Copy the pointer value out to the location pointed to by item_out
-    *item_out = *head_slot_ptr; // or *item_out = q->items[q->head];
+    *item_out = q->items[mu_ring_slot(q->mask, q->head)];
 
-    // Update head index (circular)
-    q->head = (q->head + 1) % q->capacity;
-
-    // Decrement count
-    q->count--;
+    // Update head index (circular) and count
+    advance_head(q, 1);
 
     return MU_STORE_ERR_NONE;
 }
@@ -127,19 +168,92 @@ mu_pqueue_err_t mu_pqueue_peek(const mu_pqueue_t *q, void **item_out) {
     if (mu_pqueue_is_empty(q))
         return MU_STORE_ERR_EMPTY;
 
-    // Calculate the address of the head slot (which holds a void* pointer)
-    void *const *head_slot_ptr = &q->items[q->head];
-
     // Copy the pointer value out to the location pointed to by item_out
-    *item_out = (void *)*head_slot_ptr; // Need cast from const void* const *
+    *item_out = q->items[mu_ring_slot(q->mask, q->head)];
 
     // Do NOT update head, tail, or count for peek
 
     return MU_STORE_ERR_NONE;
 }
 
+size_t mu_pqueue_put_n(mu_pqueue_t *q, void *const *items_in, size_t n) {
+    if (!q || !items_in)
+        return 0;
+
+    size_t space = q->capacity - item_count(q);
+    if (n > space)
+        n = space;
+    copy_in(q, q->tail, items_in, n);
+    advance_tail(q, n);
+    return n;
+}
+
+size_t mu_pqueue_get_n(mu_pqueue_t *q, void **items_out, size_t n) {
+    if (!q)
+        return 0;
+
+    size_t count = item_count(q);
+    if (n > count)
+        n = count;
+    if (items_out) {
+        copy_out(q, q->head, items_out, n);
+    }
+    advance_head(q, n);
+    return n;
+}
+
+size_t mu_pqueue_peek_n(const mu_pqueue_t *q, void **items_out, size_t n) {
+    if (!q || !items_out)
+        return 0;
+
+    size_t count = item_count(q);
+    if (n > count)
+        n = count;
+    copy_out(q, q->head, items_out, n);
+    return n;
+}
+
 // *****************************************************************************
 // Private (static) function definitions
 
+static inline size_t item_count(const mu_pqueue_t *q) {
+    return mu_ring_count(q->mask, q->head, q->tail, q->count);
+}
+
+static void copy_in(mu_pqueue_t *q, size_t index, void *const *src,
+                    size_t n) {
+    // At most two runs: up to the end of the store, then from its start.
+    size_t slot = mu_ring_slot(q->mask, index);
+    size_t first = q->capacity - slot;
+    if (first > n)
+        first = n;
+    memcpy(&q->items[slot], src, first * sizeof(void *));
+    memcpy(q->items, src + first, (n - first) * sizeof(void *));
+}
+
+static void copy_out(const mu_pqueue_t *q, size_t index, void **dst,
+                     size_t n) {
+    size_t slot = mu_ring_slot(q->mask, index);
+    size_t first = q->capacity - slot;
+    if (first > n)
+        first = n;
+    memcpy(dst, &q->items[slot], first * sizeof(void *));
+    memcpy(dst + first, q->items, (n - first) * sizeof(void *));
+}
+
+static inline void advance_tail(mu_pqueue_t *q, size_t n) {
+    q->tail = mu_ring_advance(q->capacity, q->mask, q->tail, n);
+    if (!q->mask) {
+        q->count += n;
+    }
+}
+
+static inline void advance_head(mu_pqueue_t *q, size_t n) {
+    q->head = mu_ring_advance(q->capacity, q->mask, q->head, n);
+    if (!q->mask) {
+        q->count -= n;
+    }
+}
+
 // *****************************************************************************
 // End of file
\ No newline at end of file
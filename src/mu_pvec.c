@@ -47,6 +47,28 @@
 // *****************************************************************************
 // Private static inline function and function declarations
 
+/**
+ * @brief Find the end of the run of pointers equal to `*key` starting at `lo`.
+ *
+ * `key` is the address of the pointer being inserted, matching the
+ * slot-address convention of the comparison function.
+ */
+static size_t upper_bound_from(const mu_pvec_t *v, size_t lo,
+                               mu_pvec_compare_fn cmp, const void *key);
+
+/**
+ * @brief Apply a sorted-insert policy, given the lower bound `lo` of `item`.
+ */
+static mu_pvec_err_t sorted_insert(mu_pvec_t *v, const void *item,
+                                   mu_pvec_compare_fn cmp,
+                                   mu_pvec_insert_policy_t policy, size_t lo);
+
+/**
+ * @brief Insert `item` at `index` after checking for a full vector.
+ */
+static mu_pvec_err_t sorted_insert_at(mu_pvec_t *v, size_t index,
+                                      const void *item);
+
 // *****************************************************************************
 // Public code
 
@@ -145,6 +167,43 @@ mu_pvec_err_t mu_pvec_delete(mu_pvec_t *v, size_t index, void **item) {
     return MU_STORE_ERR_NONE;
 }
 
+mu_pvec_err_t mu_pvec_swap_remove(mu_pvec_t *v, size_t index, void **item) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (index >= v->count) {
+        return MU_STORE_ERR_INDEX;
+    }
+
+    if (item) {
+        *item = v->item_store[index];
+    }
+    // Harmless self-assignment when removing the last element
+    v->item_store[index] = v->item_store[--v->count];
+    return MU_STORE_ERR_NONE;
+}
+
+mu_pvec_err_t mu_pvec_swap_remove_indices(mu_pvec_t *v, const size_t *indices,
+                                          size_t n, void **items_out) {
+    if (!v || (!indices && n > 0)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    for (size_t j = 0; j < n; j++) {
+        if (indices[j] >= v->count || (j > 0 && indices[j] <= indices[j - 1])) {
+            return MU_STORE_ERR_INDEX;
+        }
+    }
+
+    // Highest index first: the last item is never one still to be removed.
+    for (size_t j = n; j-- > 0;) {
+        if (items_out) {
+            items_out[j] = v->item_store[indices[j]];
+        }
+        v->item_store[indices[j]] = v->item_store[--v->count];
+    }
+    return MU_STORE_ERR_NONE;
+}
+
 mu_pvec_err_t mu_pvec_replace(mu_pvec_t *v, size_t index, const void *item) {
     if (!v) {
         return MU_STORE_ERR_PARAM;
@@ -210,13 +269,87 @@ mu_pvec_err_t mu_pvec_peek(const mu_pvec_t *v, void **item_out) {
     return mu_pvec_ref((mu_pvec_t *)v, count - 1, item_out);
 }
 
+mu_pvec_err_t mu_pvec_push_n(mu_pvec_t *v, void *const *items, size_t n) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+    return mu_pvec_replace_range(v, v->count, 0, items, n);
+}
+
+mu_pvec_err_t mu_pvec_insert_range(mu_pvec_t *v, size_t index,
+                                   void *const *items, size_t n) {
+    return mu_pvec_replace_range(v, index, 0, items, n);
+}
+
+mu_pvec_err_t mu_pvec_delete_range(mu_pvec_t *v, size_t index, size_t n,
+                                   void **items_out) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (items_out) {
+        mu_pvec_err_t err = mu_pvec_copy_out_range(v, index, n, items_out);
+        if (err != MU_STORE_ERR_NONE) {
+            return err;
+        }
+    }
+    return mu_pvec_replace_range(v, index, n, NULL, 0);
+}
+
+mu_pvec_err_t mu_pvec_replace_range(mu_pvec_t *v, size_t index, size_t n_old,
+                                    void *const *items, size_t n_new) {
+    if (!v || (!items && n_new > 0)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (index > v->count || n_old > v->count - index) {
+        return MU_STORE_ERR_INDEX;
+    }
+    if (n_new > n_old && n_new - n_old > v->capacity - v->count) {
+        return MU_STORE_ERR_FULL;
+    }
+
+    size_t tail = v->count - index - n_old;
+    // Move the tail once, directly to its final position
+    if (n_new != n_old && tail > 0) {
+        memmove(&v->item_store[index + n_new], &v->item_store[index + n_old],
+                tail * sizeof(void *));
+    }
+    if (n_new > 0) {
+        memcpy(&v->item_store[index], items, n_new * sizeof(void *));
+    }
+    v->count = v->count - n_old + n_new;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_pvec_err_t mu_pvec_copy_out_range(const mu_pvec_t *v, size_t index,
+                                     size_t n, void **items_out) {
+    if (!v || (!items_out && n > 0)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (index > v->count || n > v->count - index) {
+        return MU_STORE_ERR_INDEX;
+    }
+    if (n > 0) {
+        memcpy(items_out, &v->item_store[index], n * sizeof(void *));
+    }
+    return MU_STORE_ERR_NONE;
+}
+
 mu_pvec_err_t mu_pvec_find(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
                            const void *arg, size_t *index) {
+    return mu_pvec_find_from(v, 0, find_fn, arg, index);
+}
+
+mu_pvec_err_t mu_pvec_find_from(const mu_pvec_t *v, size_t start,
+                                mu_pvec_find_fn find_fn, const void *arg,
+                                size_t *index) {
     if (!v || !find_fn || !index) {
         return MU_STORE_ERR_PARAM;
     }
+    if (start > v->count) {
+        return MU_STORE_ERR_INDEX;
+    }
 
-    for (size_t i = 0; i < v->count; i++) {
+    for (size_t i = start; i < v->count; i++) {
         // Pass the stored pointer (void*) to the find_fn
         if (find_fn(v->item_store[i], arg)) {
             *index = i;
@@ -226,6 +359,60 @@ mu_pvec_err_t mu_pvec_find(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
     return MU_STORE_ERR_NOTFOUND;
 }
 
+mu_pvec_err_t mu_pvec_find_all(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
+                               const void *arg, size_t *indices,
+                               size_t max_indices, size_t *n_found) {
+    return mu_pvec_find_all_from(v, 0, find_fn, arg, indices, max_indices,
+                                 n_found);
+}
+
+mu_pvec_err_t mu_pvec_find_all_from(const mu_pvec_t *v, size_t start,
+                                    mu_pvec_find_fn find_fn, const void *arg,
+                                    size_t *indices, size_t max_indices,
+                                    size_t *n_found) {
+    if (!v || !find_fn || !n_found || (!indices && max_indices > 0)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (start > v->count) {
+        return MU_STORE_ERR_INDEX;
+    }
+
+    size_t found = 0;
+    for (size_t i = start; i < v->count; i++) {
+        if (find_fn(v->item_store[i], arg)) {
+            if (found == max_indices) {
+                *n_found = found;
+                return MU_STORE_ERR_FULL;
+            }
+            indices[found++] = i;
+        }
+    }
+    *n_found = found;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_pvec_err_t mu_pvec_find_all_vec(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
+                                   const void *arg, mu_vec_t *out) {
+    if (!v || !find_fn || !out || out->item_size != sizeof(size_t)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    // The indices must not be written over the pointers being searched.
+    uintptr_t items = (uintptr_t)v->item_store;
+    uintptr_t slots = (uintptr_t)out->item_store;
+    if (slots < items + v->count * sizeof(void *) &&
+        items < slots + out->capacity * sizeof(size_t)) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    // Fill the free tail of `out` directly, then account for it.
+    size_t n_found;
+    mu_pvec_err_t err = mu_pvec_find_all(
+        v, find_fn, arg, (size_t *)out->item_store + out->count,
+        out->capacity - out->count, &n_found);
+    out->count += n_found;
+    return err;
+}
+
 mu_pvec_err_t mu_pvec_rfind(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
                             const void *arg, size_t *index) {
     if (!v || !find_fn || !index) {
@@ -243,6 +430,33 @@ mu_pvec_err_t mu_pvec_rfind(const mu_pvec_t *v, mu_pvec_find_fn find_fn,
     return MU_STORE_ERR_NOTFOUND;
 }
 
+mu_pvec_err_t mu_pvec_find_ptr(const mu_pvec_t *v, const void *item,
+                               size_t *index) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_find_eq(v->item_store, v->count, sizeof(void *), 0,
+                            sizeof(void *), &item, index);
+}
+
+mu_pvec_err_t mu_pvec_retain(mu_pvec_t *v, mu_pvec_find_fn keep_fn,
+                             const void *arg) {
+    if (!v || !keep_fn) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    size_t kept = 0;
+    for (size_t i = 0; i < v->count; i++) {
+        void *item = v->item_store[i];
+        // Unconditional store: cheaper than a branch around it.
+        v->item_store[kept] = item;
+        kept += keep_fn(item, arg) ? 1 : 0;
+    }
+    v->count = kept;
+    return MU_STORE_ERR_NONE;
+}
+
 mu_pvec_err_t mu_pvec_sort(mu_pvec_t *v, mu_pvec_compare_fn compare_fn) {
     if (!v || !compare_fn) {
         return MU_STORE_ERR_PARAM;
@@ -256,6 +470,86 @@ mu_pvec_err_t mu_pvec_sort(mu_pvec_t *v, mu_pvec_compare_fn compare_fn) {
     return store_err;
 }
 
+mu_pvec_err_t mu_pvec_stable_sort(mu_pvec_t *v, mu_pvec_compare_fn compare_fn,
+                                  void **scratch, size_t scratch_count) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    // mu_store validates every argument before its empty-input shortcut.
+    return mu_store_stable_psort(v->item_store, v->count, compare_fn, scratch,
+                                 scratch_count);
+}
+
+mu_pvec_err_t mu_pvec_sort_by_key(mu_pvec_t *v, mu_store_key_fn key_fn,
+                                  mu_store_key_pair_t *scratch,
+                                  size_t scratch_count) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    // mu_store validates every argument before its empty-input shortcut.
+    return mu_store_psort_by_key(v->item_store, v->count, key_fn, scratch,
+                                 scratch_count);
+}
+
+mu_pvec_err_t mu_pvec_select(mu_pvec_t *v, size_t nth,
+                             mu_pvec_compare_fn compare_fn) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_pselect(v->item_store, v->count, nth, compare_fn);
+}
+
+mu_pvec_err_t mu_pvec_partial_sort(mu_pvec_t *v, size_t k,
+                                   mu_pvec_compare_fn compare_fn) {
+    if (!v || !compare_fn) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (v->count < 2) {
+        return MU_STORE_ERR_NONE;
+    }
+
+    return mu_store_partial_psort(v->item_store, v->count, k, compare_fn);
+}
+
+mu_pvec_err_t mu_pvec_topk(const mu_pvec_t *v, size_t k,
+                           mu_pvec_compare_fn compare_fn, void **out,
+                           size_t *n_out) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    mu_store_err_t err =
+        mu_store_ptopk(v->item_store, v->count, k, compare_fn, out);
+    if (err == MU_STORE_ERR_NONE && n_out) {
+        *n_out = k < v->count ? k : v->count;
+    }
+    return err;
+}
+
+mu_pvec_err_t mu_pvec_argsort(const mu_pvec_t *v,
+                              mu_pvec_compare_fn compare_fn, void *indices,
+                              size_t index_size) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_argsort(v->item_store, v->count, sizeof(void *),
+                            compare_fn, indices, index_size);
+}
+
+mu_pvec_err_t mu_pvec_apply_permutation(mu_pvec_t *v, void *perm,
+                                        size_t index_size) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_apply_permutation(v->item_store, v->count, sizeof(void *),
+                                      perm, index_size);
+}
+
 mu_pvec_err_t mu_pvec_reverse(mu_pvec_t *v) {
     if (!v) {
         return MU_STORE_ERR_PARAM;
@@ -284,120 +578,120 @@ mu_pvec_err_t mu_pvec_sorted_insert(mu_pvec_t *v, const void *item,
         return MU_STORE_ERR_PARAM;
     }
 
-    // Find first/last match (cmp==0)
-    size_t first_match = SIZE_MAX, last_match = SIZE_MAX;
-    for (size_t i = 0; i < v->count; ++i) {
-        int c = cmp(&v->item_store[i], &item);
-        if (c == 0) {
-            if (first_match == SIZE_MAX)
-                first_match = i;
-            last_match = i;
-        }
+    // The comparison function receives the addresses of the pointer slots, so
+    // the item store is searched as an array of pointer-sized items with
+    // `&item` as the key.
+    size_t lo = mu_store_search(v->item_store, v->count, sizeof(void *), cmp,
+                                &item);
+    return sorted_insert(v, item, cmp, policy, lo);
+}
+
+mu_pvec_err_t mu_pvec_sorted_insert_hint(mu_pvec_t *v, const void *item,
+                                         mu_pvec_compare_fn cmp,
+                                         mu_pvec_insert_policy_t policy,
+                                         size_t *hint) {
+    if (!v || !cmp || !hint) {
+        return MU_STORE_ERR_PARAM;
     }
 
-    // PARAM check for policies that require item non-NULL?
-    // We allow item==NULL in this generic vector.
+    size_t lo = mu_store_search_from(v->item_store, v->count, sizeof(void *),
+                                     cmp, &item, *hint);
+    *hint = lo;
+    return sorted_insert(v, item, cmp, policy, lo);
+}
+
+// *****************************************************************************
+// Private (static) code - Implementations
+
+static mu_pvec_err_t sorted_insert(mu_pvec_t *v, const void *item,
+                                   mu_pvec_compare_fn cmp,
+                                   mu_pvec_insert_policy_t policy, size_t lo) {
+    // `hi` (end of the run of equal items) is only computed by the policies
+    // that need it.
+    bool found = lo < v->count && cmp(&item, &v->item_store[lo]) == 0;
+    size_t hi;
 
-    // Handle pure-update policies
     switch (policy) {
+    // Handle pure-update policies
     case MU_STORE_UPDATE_FIRST:
-        if (first_match == SIZE_MAX)  {
+        if (!found) {
             return MU_STORE_ERR_NOTFOUND;
         }
-        v->item_store[first_match] = (void *)item;
+        v->item_store[lo] = (void *)item;
         return MU_STORE_ERR_NONE;
 
     case MU_STORE_UPDATE_LAST:
-        if (last_match == SIZE_MAX) {
+        if (!found) {
             return MU_STORE_ERR_NOTFOUND;
         }
-        v->item_store[last_match] = (void *)item;
+        hi = upper_bound_from(v, lo, cmp, &item);
+        v->item_store[hi - 1] = (void *)item;
         return MU_STORE_ERR_NONE;
 
     case MU_STORE_UPDATE_ALL:
-        if (first_match == SIZE_MAX) {
+        if (!found) {
             return MU_STORE_ERR_NOTFOUND;
         }
-        for (size_t i = first_match; i < v->count; ++i) {
-            if (cmp(&v->item_store[i], &item) == 0) {
-                v->item_store[i] = (void *)item;
-            } else {
-                break;
-            }
+        hi = upper_bound_from(v, lo, cmp, &item);
+        for (size_t i = lo; i < hi; ++i) {
+            v->item_store[i] = (void *)item;
         }
         return MU_STORE_ERR_NONE;
 
-    default:
-        break;
-    }
-
     // Handle conditional inserts/updates
-    switch (policy) {
     case MU_STORE_UPSERT_FIRST:
-        if (first_match != SIZE_MAX) {
-            v->item_store[first_match] = (void *)item;
+        if (found) {
+            v->item_store[lo] = (void *)item;
             return MU_STORE_ERR_NONE;
         }
-        break;
+        return sorted_insert_at(v, lo, item);
 
     case MU_STORE_UPSERT_LAST:
-        if (last_match != SIZE_MAX) {
-            v->item_store[last_match] = (void *)item;
+        if (found) {
+            hi = upper_bound_from(v, lo, cmp, &item);
+            v->item_store[hi - 1] = (void *)item;
             return MU_STORE_ERR_NONE;
         }
-        break;
+        return sorted_insert_at(v, lo, item);
 
     case MU_STORE_INSERT_UNIQUE:
-        if (first_match != SIZE_MAX) {
+        if (found) {
             return MU_STORE_ERR_EXISTS;
         }
-        break;
+        return sorted_insert_at(v, lo, item);
 
     case MU_STORE_INSERT_DUPLICATE:
-        if (first_match == SIZE_MAX) {
+        if (!found) {
             return MU_STORE_ERR_NOTFOUND;
         }
         // insert after last match
-        if (v->count >= v->capacity) {
-            return MU_STORE_ERR_FULL;
-        }
-        return mu_pvec_insert(v, last_match + 1, item);
+        return sorted_insert_at(v, upper_bound_from(v, lo, cmp, &item), item);
 
     case MU_STORE_INSERT_FIRST:
-        if (first_match != SIZE_MAX) {
-            return mu_pvec_insert(v, first_match, item);
-        }
-        break;
+        return sorted_insert_at(v, lo, item);
 
+    // Default insertion: after any existing equal items
     case MU_STORE_INSERT_LAST:
-        if (last_match != SIZE_MAX) {
-            return mu_pvec_insert(v, last_match + 1, item);
-        }
-        break;
-
     case MU_STORE_INSERT_ANY:
-        break; // fall through to default insert
-
     default:
-        break;
+        return sorted_insert_at(
+            v, found ? upper_bound_from(v, lo, cmp, &item) : lo, item);
     }
+}
+
+static size_t upper_bound_from(const mu_pvec_t *v, size_t lo,
+                               mu_pvec_compare_fn cmp, const void *key) {
+    return lo + mu_store_search_upper(&v->item_store[lo], v->count - lo,
+                                      sizeof(void *), cmp, key);
+}
 
-    // Default insertion: find first existing > item
+static mu_pvec_err_t sorted_insert_at(mu_pvec_t *v, size_t index,
+                                      const void *item) {
     if (v->count >= v->capacity) {
         return MU_STORE_ERR_FULL;
     }
-    size_t ins = v->count;
-    for (size_t i = 0; i < v->count; ++i) {
-        if (cmp(&v->item_store[i], &item) > 0) {
-            ins = i;
-            break;
-        }
-    }
-    return mu_pvec_insert(v, ins, item);
+    return mu_pvec_insert(v, index, item);
 }
 
-// *****************************************************************************
-// Private (static) code - Implementations
-
 // *****************************************************************************
 // End of file
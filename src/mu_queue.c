@@ -31,6 +31,7 @@
 // Includes
 
 #include "mu_queue.h"
+#include "mu_ring_internal.h"
 #include "mu_store.h" // For error codes
 #include <string.h> // For memcpy
 #include <stdint.h> // For uint8_t
@@ -42,6 +43,36 @@
 // *****************************************************************************
 // Private static function declarations
 
+/**
+ * @brief Return the number of items in the queue.
+ */
+static inline size_t item_count(const mu_queue_t *q);
+
+/**
+ * @brief Return the address of the slot at (possibly free-running) `index`.
+ */
+static inline uint8_t *slot_address(const mu_queue_t *q, size_t index);
+
+/**
+ * @brief Copy `n` items from `src` into the ring starting at `index`.
+ */
+static void copy_in(mu_queue_t *q, size_t index, const uint8_t *src, size_t n);
+
+/**
+ * @brief Copy `n` items out of the ring starting at `index` into `dst`.
+ */
+static void copy_out(const mu_queue_t *q, size_t index, uint8_t *dst,
+                     size_t n);
+
+/**
+ * @brief Account for `n` items added at the tail.
+ */
+static inline void advance_tail(mu_queue_t *q, size_t n);
+
+/**
+ * @brief Account for `n` items removed from the head.
+ */
+static inline void advance_head(mu_queue_t *q, size_t n);
 
 // *****************************************************************************
 // Public function definitions (Generic Queue)
@@ -56,6 +87,7 @@ mu_queue_t *mu_queue_init(mu_queue_t *q, void *backing_store, size_t n_items, si
     q->count = 0;
     q->head = 0; // Head starts at the beginning
     q->tail = 0; // Tail starts at the beginning
+    q->mask = mu_ring_mask(n_items);
     return q;
 }
 
@@ -64,15 +96,15 @@ size_t mu_queue_capacity(const mu_queue_t *q) {
 }
 
 size_t mu_queue_count(const mu_queue_t *q) {
-    return q ? q->count : 0;
+    return q ? item_count(q) : 0;
 }
 
 bool mu_queue_is_empty(const mu_queue_t *q) {
-    return q == NULL || q->count == 0;
+    return q == NULL || item_count(q) == 0;
 }
 
 bool mu_queue_is_full(const mu_queue_t *q) {
-    return q == NULL || q->count >= q->capacity;
+    return q == NULL || item_count(q) >= q->capacity;
 }
 
 mu_queue_err_t mu_queue_clear(mu_queue_t *q) {
@@ -87,17 +119,31 @@ mu_queue_err_t mu_queue_put(mu_queue_t *q, const void *item_in) {
     if (!q || !item_in) return MU_STORE_ERR_PARAM;
     if (mu_queue_is_full(q)) return MU_STORE_ERR_FULL;
 
-    // Calculate the address of the tail slot using byte arithmetic
-    void *tail_slot_addr = (uint8_t *)q->items + q->tail * q->item_size;
-
     // Copy the item data into the tail slot
-    memcpy(tail_slot_addr, item_in, q->item_size);
+    memcpy(slot_address(q, q->tail), item_in, q->item_size);
 
-    // Update tail index (circular)
-    q->tail = (q->tail + 1) % q->capacity;
+    // Update tail index (circular) and count
+    advance_tail(q, 1);
 
-    // Increment count
-    q->count++;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_queue_err_t mu_queue_put_overwrite(mu_queue_t *q, const void *item_in,
+                                      void *evicted_out, bool *evicted) {
+    if (!q || !item_in) return MU_STORE_ERR_PARAM;
+
+    // When full, drop the oldest item so that head moves along with tail
+    bool full = mu_queue_is_full(q);
+    if (full) {
+        if (evicted_out) {
+            memcpy(evicted_out, slot_address(q, q->head), q->item_size);
+        }
+        advance_head(q, 1);
+    }
+    if (evicted) *evicted = full;
+
+    memcpy(slot_address(q, q->tail), item_in, q->item_size);
+    advance_tail(q, 1);
 
     return MU_STORE_ERR_NONE;
 }
@@ -107,19 +153,13 @@ mu_queue_err_t mu_queue_get(mu_queue_t *q, void *item_out) {
     if (mu_queue_is_empty(q)) return MU_STORE_ERR_EMPTY;
     // item_out can be NULL according to mu_queue.h Doxygen
 
-    // Calculate the address of the head slot using byte arithmetic
-    void *head_slot_addr = (uint8_t *)q->items + q->head * q->item_size;
-
     // Copy the item data out if item_out is provided
     if (item_out) {
-        memcpy(item_out, head_slot_addr, q->item_size);
+        memcpy(item_out, slot_address(q, q->head), q->item_size);
     }
 
-    // Update head index (circular)
-    q->head = (q->head + 1) % q->capacity;
-
-    // Decrement count
-    q->count--;
+    // Update head index (circular) and count
+    advance_head(q, 1);
 
     return MU_STORE_ERR_NONE;
 }
@@ -128,20 +168,143 @@ mu_queue_err_t mu_queue_peek(const mu_queue_t *q, void *item_out) {
     if (!q || !item_out) return MU_STORE_ERR_PARAM; // item_out must be non-NULL per Doxygen
     if (mu_queue_is_empty(q)) return MU_STORE_ERR_EMPTY;
 
-    // Calculate the address of the head slot using byte arithmetic
-    const void *head_slot_addr = (const uint8_t *)q->items + q->head * q->item_size;
-
     // Copy the item data out
-    memcpy(item_out, head_slot_addr, q->item_size);
+    memcpy(item_out, slot_address(q, q->head), q->item_size);
 
     // Do NOT update head, tail, or count for peek
 
     return MU_STORE_ERR_NONE;
 }
 
+size_t mu_queue_put_n(mu_queue_t *q, const void *items_in, size_t n) {
+    if (!q || !items_in) return 0;
+
+    size_t space = q->capacity - item_count(q);
+    if (n > space) n = space;
+    copy_in(q, q->tail, (const uint8_t *)items_in, n);
+    advance_tail(q, n);
+    return n;
+}
+
+size_t mu_queue_get_n(mu_queue_t *q, void *items_out, size_t n) {
+    if (!q) return 0;
+
+    size_t count = item_count(q);
+    if (n > count) n = count;
+    if (items_out) {
+        copy_out(q, q->head, (uint8_t *)items_out, n);
+    }
+    advance_head(q, n);
+    return n;
+}
+
+size_t mu_queue_peek_n(const mu_queue_t *q, void *items_out, size_t n) {
+    if (!q || !items_out) return 0;
+
+    size_t count = item_count(q);
+    if (n > count) n = count;
+    copy_out(q, q->head, (uint8_t *)items_out, n);
+    return n;
+}
+
+void *mu_queue_reserve(mu_queue_t *q) {
+    if (!q || mu_queue_is_full(q)) return NULL;
+    return slot_address(q, q->tail);
+}
+
+void *mu_queue_reserve_span(mu_queue_t *q, size_t n, size_t *n_reserved) {
+    if (!n_reserved) return NULL;
+    *n_reserved = 0;
+    if (!q) return NULL;
+
+    // Limited by the free space and by the end of the backing store
+    size_t space = q->capacity - item_count(q);
+    size_t to_end = mu_ring_to_end(q->capacity, q->mask, q->tail);
+    if (n > space) n = space;
+    if (n > to_end) n = to_end;
+    if (n == 0) return NULL;
+
+    *n_reserved = n;
+    return slot_address(q, q->tail);
+}
+
+mu_queue_err_t mu_queue_commit(mu_queue_t *q, size_t n) {
+    if (!q) return MU_STORE_ERR_PARAM;
+    if (n > q->capacity - item_count(q)) return MU_STORE_ERR_FULL;
+
+    advance_tail(q, n);
+    return MU_STORE_ERR_NONE;
+}
+
+void *mu_queue_front(mu_queue_t *q) {
+    if (!q || mu_queue_is_empty(q)) return NULL;
+    return slot_address(q, q->head);
+}
+
+void *mu_queue_read_span(mu_queue_t *q, size_t n, size_t *n_read) {
+    if (!n_read) return NULL;
+    *n_read = 0;
+    if (!q) return NULL;
+
+    // Limited by the item count and by the end of the backing store
+    size_t count = item_count(q);
+    size_t to_end = mu_ring_to_end(q->capacity, q->mask, q->head);
+    if (n > count) n = count;
+    if (n > to_end) n = to_end;
+    if (n == 0) return NULL;
+
+    *n_read = n;
+    return slot_address(q, q->head);
+}
+
+mu_queue_err_t mu_queue_release(mu_queue_t *q, size_t n) {
+    if (!q) return MU_STORE_ERR_PARAM;
+    if (n > item_count(q)) return MU_STORE_ERR_EMPTY;
+
+    advance_head(q, n);
+    return MU_STORE_ERR_NONE;
+}
+
 // *****************************************************************************
 // Private (static) function definitions
 
+static inline size_t item_count(const mu_queue_t *q) {
+    return mu_ring_count(q->mask, q->head, q->tail, q->count);
+}
+
+static inline uint8_t *slot_address(const mu_queue_t *q, size_t index) {
+    return (uint8_t *)q->items + mu_ring_slot(q->mask, index) * q->item_size;
+}
+
+static void copy_in(mu_queue_t *q, size_t index, const uint8_t *src, size_t n) {
+    // At most two runs: up to the end of the store, then from its start.
+    size_t first = mu_ring_to_end(q->capacity, q->mask, index);
+    if (first > n) first = n;
+    memcpy(slot_address(q, index), src, first * q->item_size);
+    memcpy(q->items, src + first * q->item_size, (n - first) * q->item_size);
+}
+
+static void copy_out(const mu_queue_t *q, size_t index, uint8_t *dst,
+                     size_t n) {
+    size_t first = mu_ring_to_end(q->capacity, q->mask, index);
+    if (first > n) first = n;
+    memcpy(dst, slot_address(q, index), first * q->item_size);
+    memcpy(dst + first * q->item_size, q->items, (n - first) * q->item_size);
+}
+
+static inline void advance_tail(mu_queue_t *q, size_t n) {
+    q->tail = mu_ring_advance(q->capacity, q->mask, q->tail, n);
+    if (!q->mask) {
+        q->count += n;
+    }
+}
+
+static inline void advance_head(mu_queue_t *q, size_t n) {
+    q->head = mu_ring_advance(q->capacity, q->mask, q->head, n);
+    if (!q->mask) {
+        q->count -= n;
+    }
+}
 
 // *****************************************************************************
 // End of file
\ No newline at end of file
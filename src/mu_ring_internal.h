@@ -0,0 +1,107 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_ring_internal.h
+ * @brief Private ring-index arithmetic shared by mu_queue, mu_pqueue and
+ * mu_deque.
+ *
+ * Each ring keeps `capacity`, `mask`, `head`, `tail` and `count`.  When the
+ * capacity is a power of two (greater than 1), `mask` is `capacity - 1`:
+ * `head` and `tail` are free-running counters whose low bits select the slot,
+ * and the item count is their difference.  Otherwise `mask` is 0, the indices
+ * stay in [0..capacity) and `count` is kept explicitly.
+ *
+ * Not part of the public API.
+ */
+
+#ifndef MU_RING_INTERNAL_H
+#define MU_RING_INTERNAL_H
+
+// *****************************************************************************
+// Includes
+
+#include <stddef.h> // For size_t
+
+// *****************************************************************************
+// Private inline functions
+
+/**
+ * @brief Return the mask for a ring of `capacity` slots: `capacity - 1` if it
+ * is a power of two greater than 1, else 0.
+ */
+static inline size_t mu_ring_mask(size_t capacity) {
+    return (capacity > 1 && (capacity & (capacity - 1)) == 0) ? capacity - 1
+                                                              : 0;
+}
+
+/**
+ * @brief Return the number of items between `head` and `tail`.
+ */
+static inline size_t mu_ring_count(size_t mask, size_t head, size_t tail,
+                                   size_t count) {
+    return mask ? tail - head : count;
+}
+
+/**
+ * @brief Return the slot [0..capacity) of (possibly free-running) `index`.
+ */
+static inline size_t mu_ring_slot(size_t mask, size_t index) {
+    return mask ? (index & mask) : index;
+}
+
+/**
+ * @brief Return how many slots from (possibly free-running) `index` to the
+ * end of the backing store.
+ */
+static inline size_t mu_ring_to_end(size_t capacity, size_t mask,
+                                    size_t index) {
+    return capacity - mu_ring_slot(mask, index);
+}
+
+/**
+ * @brief Return `index` advanced by `n` slots, where `n <= capacity`.
+ */
+static inline size_t mu_ring_advance(size_t capacity, size_t mask,
+                                     size_t index, size_t n) {
+    if (mask) {
+        return index + n; // Wraps modulo SIZE_MAX + 1, a multiple of capacity
+    }
+    // index < capacity and n <= capacity: one subtraction wraps, no division
+    index += n;
+    return index >= capacity ? index - capacity : index;
+}
+
+/**
+ * @brief Return `index` moved back by `n` slots, where `n <= capacity`.
+ */
+static inline size_t mu_ring_retreat(size_t capacity, size_t mask,
+                                     size_t index, size_t n) {
+    if (mask) {
+        return index - n; // Wraps modulo SIZE_MAX + 1, as mu_ring_advance()
+    }
+    return index >= n ? index - n : index + capacity - n;
+}
+
+#endif // MU_RING_INTERNAL_H
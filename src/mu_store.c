@@ -38,41 +38,117 @@
 // *****************************************************************************
 // Private types and definitions
 
+// Partitions smaller than this are finished with insertion sort.
+#define MU_STORE_INSERTION_THRESHOLD 24
+
+// Partitions larger than this use a pseudo-median of 9 to pick the pivot.
+#define MU_STORE_NINTHER_THRESHOLD 128
+
+// Max items partial_insertion_sort() may move before giving up.
+#define MU_STORE_PARTIAL_INSERTION_LIMIT 8
+
+// Block size used by the generic swap kernel.
+#define MU_STORE_SWAP_BLOCK 32
+
+// Stable sort: natural runs shorter than the computed minimum run (between
+// MU_STORE_MIN_MERGE / 2 and MU_STORE_MIN_MERGE) are extended by insertion.
+#define MU_STORE_MIN_MERGE 32
+
+// Stable sort: consecutive wins by one run before switching to galloping.
+#define MU_STORE_MIN_GALLOP 7
+
+// Stable sort: maximum depth of the pending-run stack (enough for 2^64 items).
+#define MU_STORE_MAX_RUNS 85
+
+// Radix sort: arrays this short are sorted by a keyed insertion sort.
+#define MU_STORE_RADIX_THRESHOLD 32
+
+// Radix sort: bits per digit and resulting number of buckets per pass.
+#define MU_STORE_RADIX_BITS 8
+#define MU_STORE_RADIX_BUCKETS (1 << MU_STORE_RADIX_BITS)
+
+// Batched search: number of unsorted queries searched in lockstep.
+#define MU_STORE_SEARCH_LANES 8
+
+// Batched search: tables at most this many bytes are assumed to be cache
+// resident, where interleaving gains nothing over plain binary searches.
+#define MU_STORE_SEARCH_LANES_MIN_BYTES (256 * 1024)
+
+// Interpolation search: ranges at most this long are finished by bisection.
+#define MU_STORE_INTERP_MIN_RANGE 16
+
+// Key-extracted sort: how many pointers ahead to prefetch during extraction.
+#define MU_STORE_KEY_PREFETCH_DISTANCE 8
+
+// Permutation: items wider than this are moved through a stack buffer of
+// this many bytes at a time.
+#define MU_STORE_PERMUTE_CHUNK 256
+
+#if defined(__GNUC__) || defined(__clang__)
+#define MU_STORE_PREFETCH(addr) __builtin_prefetch((addr), 0, 1)
+#else
+#define MU_STORE_PREFETCH(addr) ((void)(addr))
+#endif
+
+// Field scans: AVX2 kernels, compiled for x86-64 with GCC or Clang and
+// selected at run time.
+#if !defined(MU_STORE_NO_SIMD) && defined(__x86_64__) &&                       \
+    (defined(__GNUC__) || defined(__clang__))
+#define MU_STORE_HAVE_AVX2 1
+#include <immintrin.h>
+#else
+#define MU_STORE_HAVE_AVX2 0
+#endif
+
 // *****************************************************************************
 // Private static function declarations
 
+/**
+ * @brief Signature of a kernel that swaps two items of `size` bytes.
+ *
+ * Fixed-size kernels ignore `size`.
+ */
+typedef void (*swap_fn)(void *a, void *b, size_t size);
+
+/**
+ * @brief Signature of a kernel that copies one item of `size` bytes.
+ *
+ * Fixed-size kernels ignore `size`.  `dst` and `src` must not overlap.
+ */
+typedef void (*copy_fn)(void *dst, const void *src, size_t size);
+
+/**
+ * @brief Select the swap kernel best suited to items of `item_size` bytes.
+ *
+ * Sizes of 1, 2, 4, 8 and 16 bytes get register-sized swaps; everything else
+ * is swapped in fixed-size blocks that the compiler can keep in vector
+ * registers.  Neither path needs a variable length array.
+ */
+static swap_fn select_swap(size_t item_size);
+
+/**
+ * @brief Select the copy kernel best suited to items of `item_size` bytes.
+ */
+static copy_fn select_copy(size_t item_size);
+
 /**
  * @brief Swaps two blocks of memory of a specified size.
  *
- * Used by the heapsort algorithm for sorting arrays of arbitrary items.
+ * Dispatches to the size-specialized kernel on every call.  The sort engine
+ * instead selects a kernel once per sort and calls it through its context.
  *
  * @param a Pointer to the beginning of the first memory block.
  * @param b Pointer to the beginning of the second memory block.
  * @param item_size The size of the memory blocks to swap in bytes.
  */
 static inline void swap_items(void *a, void *b, size_t item_size) {
-#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L // C99 or later
-    // use a variable length array on the stack
-    unsigned char temp[item_size];
-    memcpy(temp, a, item_size);
-    memcpy(a, b, item_size);
-    memcpy(b, temp, item_size);
-#else
-    // byte at a time copy
-    char *pa = (char *)a;
-    char *pb = (char *)b;
-    for (size_t i = 0; i < item_size; i++) {
-        char tmp = pa[i];
-        pa[i] = pb[i];
-        pb[i] = tmp;
-    }
-#endif
+    select_swap(item_size)(a, b, item_size);
 }
 
 /**
  * @brief Swaps two void pointers in memory.
  *
- * Used by the heapsort algorithm for sorting arrays of pointers.
+ * Backs the public mu_store_swap_pointers().
  *
  * @param a Pointer to the first void pointer.
  * @param b Pointer to the second void pointer.
@@ -84,37 +160,317 @@ static inline void swap_pointers(void **a, void **b) {
 }
 
 /**
- * @brief Maintains the max heap property for a subtree rooted at index i (for
- * arbitrary items).
+ * @brief Signature of an internal comparison function that takes a context.
+ */
+typedef int (*compare_arg_fn)(const void *a, const void *b, const void *arg);
+
+/**
+ * @brief Sort context shared by the pattern-defeating quicksort engine.
+ *
+ * Bundles the per-call invariants so the helpers only need to pass a single
+ * pointer around.  Items are compared with `compare` or, when that is NULL,
+ * with `compare_arg` and its context `arg`.
+ */
+typedef struct {
+    size_t item_size;            /**< Size of each item in bytes */
+    mu_store_compare_fn compare; /**< User comparison function, or NULL */
+    compare_arg_fn compare_arg;  /**< Comparison used if `compare` is NULL */
+    const void *arg;             /**< Context passed to `compare_arg` */
+    swap_fn swap;                /**< Swap kernel chosen for item_size */
+    copy_fn copy;                /**< Copy kernel chosen for item_size */
+} sort_ctx_t;
+
+/**
+ * @brief Build a sort context, selecting the swap and copy kernels once for
+ * the whole sort.
+ */
+static inline sort_ctx_t make_sort_ctx(size_t item_size,
+                                       mu_store_compare_fn compare) {
+    sort_ctx_t ctx = {.item_size = item_size,
+                      .compare = compare,
+                      .swap = select_swap(item_size),
+                      .copy = select_copy(item_size)};
+    return ctx;
+}
+
+/**
+ * @brief As make_sort_ctx(), comparing items with `compare_arg(a, b, arg)`.
+ */
+static inline sort_ctx_t make_sort_ctx_arg(size_t item_size,
+                                           compare_arg_fn compare_arg,
+                                           const void *arg) {
+    sort_ctx_t ctx = make_sort_ctx(item_size, NULL);
+    ctx.compare_arg = compare_arg;
+    ctx.arg = arg;
+    return ctx;
+}
+
+/**
+ * @brief Read an index of `index_size` bytes (4 or sizeof(size_t)).
+ */
+static inline size_t load_index(const void *p, size_t index_size) {
+    if (index_size == sizeof(uint32_t)) {
+        uint32_t index;
+        memcpy(&index, p, sizeof(index));
+        return index;
+    }
+    size_t index;
+    memcpy(&index, p, sizeof(index));
+    return index;
+}
+
+/**
+ * @brief Write an index of `index_size` bytes (4 or sizeof(size_t)).
+ */
+static inline void store_index(void *p, size_t index_size, size_t index) {
+    if (index_size == sizeof(uint32_t)) {
+        uint32_t narrow = (uint32_t)index;
+        memcpy(p, &narrow, sizeof(narrow));
+    } else {
+        memcpy(p, &index, sizeof(index));
+    }
+}
+
+/**
+ * @brief Return true if `index_size` is a supported index width and every
+ * index below `item_count` is representable with its top bit clear.
+ */
+static inline bool index_size_ok(size_t index_size, size_t item_count) {
+    if (index_size == sizeof(uint32_t)) {
+        return (uint64_t)item_count <= UINT32_MAX / 2 + 1;
+    }
+    return index_size == sizeof(size_t) && item_count <= SIZE_MAX / 2 + 1;
+}
+
+/**
+ * @brief Context for the stable merge sort.
+ */
+typedef struct {
+    sort_ctx_t sort;      /**< Item size and comparison function */
+    uint8_t *scratch;     /**< Caller-provided scratch buffer, may be NULL */
+    size_t scratch_count; /**< Number of items `scratch` can hold */
+} merge_ctx_t;
+
+/**
+ * @brief A pending run on the stable sort's run stack.
+ */
+typedef struct {
+    size_t start; /**< Index of the first item of the run */
+    size_t len;   /**< Number of items in the run */
+} run_t;
+
+/**
+ * @brief Return floor(log2(n)) for n > 0.
+ */
+static inline int log2_floor(size_t n) {
+    int log = 0;
+    while (n >>= 1) {
+        log++;
+    }
+    return log;
+}
+
+/**
+ * @brief Top-level pdqsort loop for an array of items.
+ *
+ * Sorts the half-open range [begin, end).  Small ranges are finished with
+ * insertion sort, badly unbalanced partitions are shuffled to defeat
+ * adversarial patterns, and once `bad_allowed` reaches zero the remaining
+ * range falls back to heapsort to guarantee O(n log n).
+ *
+ * @param ctx The sort context.
+ * @param begin Address of the first item in the range.
+ * @param end Address one past the last item in the range.
+ * @param bad_allowed Number of unbalanced partitions tolerated before
+ *        switching to heapsort.
+ * @param leftmost true if no item precedes `begin` in the overall array.
+ */
+static void pdqsort_loop(const sort_ctx_t *ctx, uint8_t *begin, uint8_t *end,
+                         int bad_allowed, bool leftmost);
+
+/**
+ * @brief In-place, non-recursive heapsort of the range [begin, end).
+ *
+ * Used as the worst-case fallback of the pdqsort engine.
+ */
+static void heap_sort(const sort_ctx_t *ctx, uint8_t *begin, uint8_t *end);
+
+/**
+ * @brief Introselect: rearrange [begin, end) so that the item at `nth` is in
+ * its sorted position, with no greater item before it and no lesser after.
+ *
+ * @param bad_allowed Number of unbalanced partitions tolerated before the
+ *        remaining range is heapsorted.
+ */
+static void select_loop(const sort_ctx_t *ctx, uint8_t *begin, uint8_t *end,
+                        uint8_t *nth, int bad_allowed);
+
+/**
+ * @brief Copy the `k` smallest of the `n` items at `base` into `out` (which
+ * must hold `k` items, 0 < k <= n), in sorted order.
+ */
+static void topk(const sort_ctx_t *ctx, const uint8_t *base, size_t n,
+                 size_t k, uint8_t *out);
+
+/**
+ * @brief Argsort context: the array being sorted holds indices into `keys`.
+ */
+typedef struct {
+    const uint8_t *keys;         /**< Items the indices refer to */
+    size_t key_size;             /**< Size of each item in `keys` */
+    size_t index_size;           /**< Size of each index: 4 or sizeof(size_t) */
+    mu_store_compare_fn compare; /**< User comparison function on items */
+} argsort_ctx_t;
+
+/**
+ * @brief Compare two indices (`arg` is an argsort_ctx_t) by the items they
+ * refer to, then by the indices themselves.
+ *
+ * Breaking ties by index makes the order total, so the unstable pdqsort
+ * engine yields the stable permutation.
+ */
+static int compare_indices(const void *a, const void *b, const void *arg);
+
+/**
+ * @brief Reorder the `n` items at `base` so that item i becomes the item
+ * previously at perm[i], moving each item once by following cycles.
+ *
+ * `perm` must be a permutation of [0..n).  Its entries are marked in their
+ * top bit while in use and restored before returning.
+ */
+static void permute(uint8_t *base, size_t n, size_t item_size, uint8_t *perm,
+                    size_t index_size);
+
+/**
+ * @brief Stable, natural-run merge sort of `n` items at `base`.
  *
- * Assumes the subtrees rooted at left and right children are already heaps.
- * This function is part of the in-place Heapsort implementation for arbitrary
- * items. It uses item_size to calculate element addresses and swap_items for
- * swapping.
+ * Detects ascending and strictly descending runs, extends short runs with
+ * insertion sort, and merges them under timsort's balance rules.  Merges use
+ * the scratch buffer (with galloping) when the shorter run fits, and fall
+ * back to an in-place rotation merge otherwise.
+ */
+static void stable_sort(const merge_ctx_t *m, uint8_t *base, size_t n);
+
+/**
+ * @brief Merge the adjacent sorted runs [lo, mid) and [mid, hi) stably.
+ */
+static void merge_runs(const merge_ctx_t *m, uint8_t *lo, uint8_t *mid,
+                       uint8_t *hi);
+
+/**
+ * @brief Key extraction parameters for the radix sort.
  *
- * @param base The beginning of the array of items.
- * @param n The current size of the heap (number of elements to consider).
- * @param i The index of the root of the subtree to heapify.
- * @param item_size The size of each item in bytes.
- * @param compare The comparison function. Must not be NULL.
+ * Keys are mapped to unsigned integers whose natural order is the requested
+ * sort order, so every key type shares the same digit passes.
  */
-static void heapify_items(void *base, size_t n, size_t i, size_t item_size,
-                          mu_store_compare_fn compare);
+typedef struct {
+    size_t key_offset; /**< Byte offset of the key within an item */
+    size_t key_width;  /**< Key size in bytes: 1, 2, 4 or 8 */
+    uint64_t sign_bit; /**< Most significant bit of the key */
+    uint64_t flip;     /**< Bits xor'ed into non-negative-float/integer keys */
+    uint64_t invert;   /**< All key bits for descending order, else 0 */
+    uint64_t mask;     /**< All key bits */
+    bool is_float;     /**< Negative keys are inverted rather than flipped */
+} radix_ctx_t;
 
 /**
- * @brief Maintains the max heap property for a subtree rooted at index i (for
- * pointers).
+ * @brief Stable LSD radix sort of `n` items at `base`, ping-ponging through
+ * `scratch` (which must hold `n` items).
+ */
+static void radix_sort(const radix_ctx_t *r, size_t item_size, uint8_t *base,
+                       uint8_t *scratch, size_t n);
+
+/**
+ * @brief Stable insertion sort of `n` items at `base` by radix key.
+ */
+static void radix_insertion_sort(const radix_ctx_t *r, size_t item_size,
+                                 uint8_t *base, size_t n);
+
+/**
+ * @brief Validate a radix key description and fill in `r`.
  *
- * Assumes the subtrees rooted at left and right children are already heaps.
- * This function is part of the in-place Heapsort implementation for pointers.
+ * @return false if the key width or flags are invalid or the key does not
+ * fit within an item of `item_size` bytes.
+ */
+static bool make_radix_ctx(radix_ctx_t *r, size_t item_size,
+                           size_t key_offset, size_t key_width,
+                           mu_store_radix_flags_t flags);
+
+/**
+ * @brief Stably partition the `n` items at `base` by `pred_fn`, returning the
+ * address of the first non-matching item.
+ */
+static uint8_t *stable_partition(const merge_ctx_t *m, uint8_t *base,
+                                 size_t n, mu_store_find_fn pred_fn,
+                                 const void *arg);
+
+/**
+ * @brief Order mu_store_key_pair_t by key.
+ */
+static int compare_key_pairs(const void *a, const void *b);
+
+/**
+ * @brief Lower bound of the bare key `key` among `n` items at `base`,
+ * located by interpolation on the radix keys.
+ */
+static size_t interp_search(const radix_ctx_t *r, size_t item_size,
+                            const uint8_t *base, size_t n,
+                            const uint8_t *key);
+
+/**
+ * @brief An unsorted field scan: items match when their mapped key lies in
+ * [lo, lo + span].
+ */
+typedef struct {
+    radix_ctx_t key; /**< Field location and order-preserving mapping */
+    uint64_t lo;     /**< Mapped lower bound */
+    uint64_t span;   /**< Mapped upper bound minus `lo` */
+    bool empty;      /**< The bounds are reversed: nothing matches */
+} field_scan_t;
+
+/**
+ * @brief Set up a scan for items whose key lies in [*lo, *hi].  Returns
+ * false if the key description is invalid.
+ */
+static bool make_field_scan(field_scan_t *s, size_t item_size,
+                            size_t key_offset, size_t key_width,
+                            mu_store_radix_flags_t flags, const void *lo,
+                            const void *hi);
+
+/**
+ * @brief Scan `n` items at `base`.  Returns the index of the first match (n
+ * if none), or if `count_all` the number of matches.
+ */
+static size_t field_scan(const field_scan_t *s, const uint8_t *base, size_t n,
+                         size_t item_size, bool count_all);
+
+/**
+ * @brief A sorted array as seen by the batched searches.
  *
- * @param arr The array of void pointers representing the heap.
- * @param n The current size of the heap (number of elements to consider).
- * @param i The index of the root of the subtree to heapify.
- * @param compare The comparison function. Must not be NULL.
+ * For pointer arrays (`deref`), the comparison function receives the stored
+ * pointers rather than the addresses of the slots, as in mu_store_psearch().
+ */
+typedef struct {
+    const uint8_t *base;         /**< First element (or pointer slot) */
+    size_t count;                /**< Number of elements */
+    size_t size;                 /**< Element (or slot) size in bytes */
+    mu_store_compare_fn compare; /**< Comparison function */
+    bool deref;                  /**< Elements are pointers to items */
+} search_ctx_t;
+
+/**
+ * @brief Lower bound of `query`, galloping outwards from index `hint`.
+ */
+static inline size_t search_from(const search_ctx_t *s, const void *query,
+                                 size_t hint);
+
+/**
+ * @brief Batched lower-bound searches over `n` queries, `query_size` bytes
+ * apart, starting at `queries`.  Shared by the item and pointer variants.
  */
-static void heapify_pointers(void **arr, size_t n, size_t i,
-                             mu_store_compare_fn compare);
+static inline void search_many(const search_ctx_t *s,
+                               const uint8_t *queries, size_t query_size,
+                               size_t n, size_t *results);
 
 // *****************************************************************************
 // Public function definitions
@@ -167,6 +523,106 @@ size_t mu_store_psearch(const void *const *base, size_t item_count,
     return lo;
 }
 
+size_t mu_store_search_upper(const void *base, size_t item_count,
+                             size_t item_size, mu_store_compare_fn compare_fn,
+                             const void *item) {
+    const char *arr = (const char *)base;
+    size_t lo = 0, hi = item_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const void *mid_ptr = arr + mid * item_size;
+        int c = compare_fn(item, mid_ptr);
+        if (c >= 0) {
+            // new item >= existing → must go after mid
+            lo = mid + 1;
+        } else {
+            // new item < existing → candidate insertion point
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+size_t mu_store_psearch_upper(const void *const *base, size_t item_count,
+                              mu_store_compare_fn compare_fn,
+                              const void *item) {
+    size_t lo = 0, hi = item_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        int c = compare_fn(item, base[mid]);
+        if (c >= 0) {
+            // new item is >= arr[mid] → must insert after mid
+            lo = mid + 1;
+        } else {
+            // new item is < arr[mid] → candidate insertion point
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+size_t mu_store_search_from(const void *base, size_t item_count,
+                            size_t item_size, mu_store_compare_fn compare_fn,
+                            const void *item, size_t hint) {
+    search_ctx_t s = {.base = (const uint8_t *)base,
+                      .count = item_count,
+                      .size = item_size,
+                      .compare = compare_fn,
+                      .deref = false};
+    return search_from(&s, item, hint);
+}
+
+size_t mu_store_psearch_from(const void *const *base, size_t item_count,
+                             mu_store_compare_fn compare_fn, const void *item,
+                             size_t hint) {
+    search_ctx_t s = {.base = (const uint8_t *)base,
+                      .count = item_count,
+                      .size = sizeof(void *),
+                      .compare = compare_fn,
+                      .deref = true};
+    return search_from(&s, item, hint);
+}
+
+mu_store_err_t mu_store_search_many(const void *base, size_t item_count,
+                                    size_t item_size,
+                                    mu_store_compare_fn compare_fn,
+                                    const void *queries, size_t query_count,
+                                    size_t *results) {
+    if ((!base && item_count > 0) || !compare_fn || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+    if (query_count > 0 && (!queries || !results))
+        return MU_STORE_ERR_PARAM;
+
+    search_ctx_t s = {.base = (const uint8_t *)base,
+                      .count = item_count,
+                      .size = item_size,
+                      .compare = compare_fn,
+                      .deref = false};
+    search_many(&s, (const uint8_t *)queries, item_size, query_count,
+                results);
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_psearch_many(const void *const *base,
+                                     size_t item_count,
+                                     mu_store_compare_fn compare_fn,
+                                     const void *const *queries,
+                                     size_t query_count, size_t *results) {
+    if ((!base && item_count > 0) || !compare_fn)
+        return MU_STORE_ERR_PARAM;
+    if (query_count > 0 && (!queries || !results))
+        return MU_STORE_ERR_PARAM;
+
+    search_ctx_t s = {.base = (const uint8_t *)base,
+                      .count = item_count,
+                      .size = sizeof(void *),
+                      .compare = compare_fn,
+                      .deref = true};
+    search_many(&s, (const uint8_t *)queries, sizeof(void *), query_count,
+                results);
+    return MU_STORE_ERR_NONE;
+}
+
 mu_store_err_t mu_store_sort(void *base, size_t item_count, size_t item_size,
                              mu_store_compare_fn compare_fn) {
     if (!base || !compare_fn || item_size == 0)
@@ -174,127 +630,1954 @@ mu_store_err_t mu_store_sort(void *base, size_t item_count, size_t item_size,
     if (item_count <= 1)
         return MU_STORE_ERR_NONE; // Nothing to sort
 
-    // Build max heap
-    // Start from the last non-leaf node and heapify down to the root
-    // The index of the last non-leaf node is (item_count / 2) - 1
-    // Loop uses int for index to safely handle 0 - 1
-    for (int i = item_count / 2 - 1; i >= 0; i--) {
-        heapify_items(base, item_count, (size_t)i, item_size, compare_fn);
-    }
+    sort_ctx_t ctx = make_sort_ctx(item_size, compare_fn);
+    uint8_t *begin = (uint8_t *)base;
+    pdqsort_loop(&ctx, begin, begin + item_count * item_size,
+                 log2_floor(item_count), true);
+    return MU_STORE_ERR_NONE;
+}
 
-    // One by one extract elements from the heap
-    for (size_t i = item_count - 1; i > 0; i--) {
-        // Calculate memory addresses for swapping
-        void *root_addr = (unsigned char *)base + 0 * item_size;
-        void *current_last_addr = (unsigned char *)base + i * item_size;
+mu_store_err_t mu_store_psort(void **base, size_t item_count,
+                              mu_store_compare_fn compare_fn) {
+    if (!base || !compare_fn)
+        return MU_STORE_ERR_PARAM;
+    if (item_count <= 1)
+        return MU_STORE_ERR_NONE; // Nothing to sort
 
-        // Move current root (maximum element of the heap) to the end of the
-        // array
-        swap_items(root_addr, current_last_addr, item_size);
+    // An array of pointers is an array of pointer-sized items: as before, the
+    // comparison function receives the addresses of the two slots.
+    sort_ctx_t ctx = make_sort_ctx(sizeof(void *), compare_fn);
+    uint8_t *begin = (uint8_t *)base;
+    pdqsort_loop(&ctx, begin, begin + item_count * sizeof(void *),
+                 log2_floor(item_count), true);
+    return MU_STORE_ERR_NONE;
+}
 
-        // call max heapify on the reduced heap (size i) starting at the root
-        // (index 0) The recursive call within heapify_items already has the
-        // correct argument order.
-        heapify_items(base, i, 0, item_size, compare_fn);
-    }
+mu_store_err_t mu_store_stable_sort(void *base, size_t item_count,
+                                    size_t item_size,
+                                    mu_store_compare_fn compare_fn,
+                                    void *scratch, size_t scratch_count) {
+    if (!base || !compare_fn || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+    if (item_count <= 1)
+        return MU_STORE_ERR_NONE; // Nothing to sort
 
+    merge_ctx_t m = {.sort = make_sort_ctx(item_size, compare_fn),
+                     .scratch = (uint8_t *)scratch,
+                     .scratch_count = scratch ? scratch_count : 0};
+    stable_sort(&m, (uint8_t *)base, item_count);
     return MU_STORE_ERR_NONE;
 }
-mu_store_err_t mu_store_psort(void **base, size_t item_count,
-                              mu_store_compare_fn compare_fn) {
-    if (!base || !compare_fn)
+
+mu_store_err_t mu_store_stable_psort(void **base, size_t item_count,
+                                     mu_store_compare_fn compare_fn,
+                                     void **scratch, size_t scratch_count) {
+    return mu_store_stable_sort(base, item_count, sizeof(void *), compare_fn,
+                                scratch, scratch_count);
+}
+
+mu_store_err_t mu_store_radix_sort(void *base, size_t item_count,
+                                   size_t item_size, size_t key_offset,
+                                   size_t key_width,
+                                   mu_store_radix_flags_t flags,
+                                   void *scratch) {
+    radix_ctx_t r;
+    if (!base || !scratch ||
+        !make_radix_ctx(&r, item_size, key_offset, key_width, flags))
         return MU_STORE_ERR_PARAM;
     if (item_count <= 1)
         return MU_STORE_ERR_NONE; // Nothing to sort
 
-    // Build max heap
-    // Start from the last non-leaf node and heapify down to the root
-    // The index of the last non-leaf node is (item_count / 2) - 1
-    // Loop uses int for index to safely handle 0 - 1
-    for (int i = item_count / 2 - 1; i >= 0; i--) {
-        heapify_pointers(base, item_count, (size_t)i, compare_fn);
+    if (item_count <= MU_STORE_RADIX_THRESHOLD) {
+        radix_insertion_sort(&r, item_size, (uint8_t *)base, item_count);
+    } else {
+        radix_sort(&r, item_size, (uint8_t *)base, (uint8_t *)scratch,
+                   item_count);
     }
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_psort_by_key(void **base, size_t item_count,
+                                     mu_store_key_fn key_fn,
+                                     mu_store_key_pair_t *scratch,
+                                     size_t scratch_count) {
+    if (!base || !key_fn || !scratch || scratch_count < item_count)
+        return MU_STORE_ERR_PARAM;
+    if (item_count <= 1)
+        return MU_STORE_ERR_NONE; // Nothing to sort
 
-    // One by one extract elements from the heap
-    for (size_t i = item_count - 1; i > 0; i--) {
-        // Move current root (largest element) to end of the unsorted portion
-        // Swap pointer at index 0 with pointer at index i
-        swap_pointers(&base[0], &base[i]);
+    // One pass over the objects, prefetching a few pointers ahead since the
+    // targets are typically scattered.
+    for (size_t i = 0; i < item_count; i++) {
+        if (i + MU_STORE_KEY_PREFETCH_DISTANCE < item_count) {
+            MU_STORE_PREFETCH(base[i + MU_STORE_KEY_PREFETCH_DISTANCE]);
+        }
+        scratch[i].key = key_fn(base[i]);
+        scratch[i].ptr = base[i];
+    }
 
-        // call max heapify on the reduced heap (size i) starting at the root
-        // (index 0)
-        heapify_pointers(base, i, 0, compare_fn);
+    if (scratch_count / 2 >= item_count) {
+        mu_store_radix_sort(scratch, item_count, sizeof(mu_store_key_pair_t),
+                            offsetof(mu_store_key_pair_t, key),
+                            sizeof(uint64_t), MU_STORE_RADIX_UNSIGNED,
+                            scratch + item_count);
+    } else {
+        sort_ctx_t ctx =
+            make_sort_ctx(sizeof(mu_store_key_pair_t), compare_key_pairs);
+        uint8_t *begin = (uint8_t *)scratch;
+        pdqsort_loop(&ctx, begin,
+                     begin + item_count * sizeof(mu_store_key_pair_t),
+                     log2_floor(item_count), true);
     }
 
+    for (size_t i = 0; i < item_count; i++) {
+        base[i] = scratch[i].ptr;
+    }
     return MU_STORE_ERR_NONE;
 }
 
-// *****************************************************************************
-// Private (static) function definitions
+mu_store_err_t mu_store_interp_search(const void *base, size_t item_count,
+                                      size_t item_size, size_t key_offset,
+                                      size_t key_width,
+                                      mu_store_radix_flags_t flags,
+                                      const void *key, size_t *index) {
+    radix_ctx_t r;
+    if ((!base && item_count > 0) || !key || !index ||
+        !make_radix_ctx(&r, item_size, key_offset, key_width, flags))
+        return MU_STORE_ERR_PARAM;
 
-static void heapify_items(void *base, size_t n, size_t i, size_t item_size,
-                          mu_store_compare_fn compare) {
-    size_t largest = i;       // Initialize largest as root
-    size_t left = 2 * i + 1;  // left child index
-    size_t right = 2 * i + 2; // right child index
+    *index = interp_search(&r, item_size, (const uint8_t *)base, item_count,
+                           (const uint8_t *)key);
+    return MU_STORE_ERR_NONE;
+}
 
-    // Use uint8_t* for byte arithmetic
-    uint8_t *byte_base = (uint8_t *)base;
+mu_store_err_t mu_store_find_eq(const void *base, size_t item_count,
+                                size_t item_size, size_t field_offset,
+                                size_t field_width, const void *value,
+                                size_t *index) {
+    field_scan_t s;
+    if ((!base && item_count > 0) || !index ||
+        !make_field_scan(&s, item_size, field_offset, field_width,
+                         MU_STORE_RADIX_UNSIGNED, value, value))
+        return MU_STORE_ERR_PARAM;
 
-    // If left child is larger than root
-    // compare receives pointers to the items: (byte_base + left * item_size)
-    // and (byte_base + largest * item_size)
-    if (left < n && compare(byte_base + left * item_size,
-                            byte_base + largest * item_size) > 0) {
-        largest = left;
+    size_t i = field_scan(&s, (const uint8_t *)base, item_count, item_size,
+                          false);
+    if (i == item_count) {
+        return MU_STORE_ERR_NOTFOUND;
     }
+    *index = i;
+    return MU_STORE_ERR_NONE;
+}
 
-    // If right child is larger than largest so far
-    // compare receives pointers to the items: (byte_base + right * item_size)
-    // and (byte_base + largest * item_size)
-    if (right < n && compare(byte_base + right * item_size,
-                             byte_base + largest * item_size) > 0) {
-        largest = right;
-    }
+mu_store_err_t mu_store_count_eq(const void *base, size_t item_count,
+                                 size_t item_size, size_t field_offset,
+                                 size_t field_width, const void *value,
+                                 size_t *count) {
+    field_scan_t s;
+    if ((!base && item_count > 0) || !count ||
+        !make_field_scan(&s, item_size, field_offset, field_width,
+                         MU_STORE_RADIX_UNSIGNED, value, value))
+        return MU_STORE_ERR_PARAM;
 
-    // If largest is not root
-    if (largest != i) {
-        // Swap the item at i and the item at largest
-        swap_items(byte_base + i * item_size, byte_base + largest * item_size,
-                   item_size);
+    *count = field_scan(&s, (const uint8_t *)base, item_count, item_size,
+                        true);
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_find_range(const void *base, size_t item_count,
+                                   size_t item_size, size_t key_offset,
+                                   size_t key_width,
+                                   mu_store_radix_flags_t flags,
+                                   const void *lo, const void *hi,
+                                   size_t *index) {
+    field_scan_t s;
+    if ((!base && item_count > 0) || !index ||
+        !make_field_scan(&s, item_size, key_offset, key_width, flags, lo, hi))
+        return MU_STORE_ERR_PARAM;
 
-        // Recursively heapify the affected sub-tree
-        heapify_items(base, n, largest, item_size, compare);
+    size_t i = field_scan(&s, (const uint8_t *)base, item_count, item_size,
+                          false);
+    if (i == item_count) {
+        return MU_STORE_ERR_NOTFOUND;
     }
+    *index = i;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_select(void *base, size_t item_count, size_t item_size,
+                               size_t nth, mu_store_compare_fn compare_fn) {
+    if (!base || !compare_fn || item_size == 0 || nth >= item_count)
+        return MU_STORE_ERR_PARAM;
+
+    sort_ctx_t ctx = make_sort_ctx(item_size, compare_fn);
+    uint8_t *begin = (uint8_t *)base;
+    select_loop(&ctx, begin, begin + item_count * item_size,
+                begin + nth * item_size, log2_floor(item_count));
+    return MU_STORE_ERR_NONE;
 }
 
-static void heapify_pointers(void **arr, size_t n, size_t i,
-                             mu_store_compare_fn compare) {
-    size_t largest = i;       // Initialize largest as root
-    size_t left = 2 * i + 1;  // left child index
-    size_t right = 2 * i + 2; // right child index
+mu_store_err_t mu_store_pselect(void **base, size_t item_count, size_t nth,
+                                mu_store_compare_fn compare_fn) {
+    return mu_store_select(base, item_count, sizeof(void *), nth, compare_fn);
+}
 
-    // If left child is larger than root
-    // compare receives pointers to the void* pointers: &arr[left] and
-    // &arr[largest]
-    if (left < n && compare(&arr[left], &arr[largest]) > 0) {
-        largest = left;
+mu_store_err_t mu_store_partial_sort(void *base, size_t item_count,
+                                     size_t item_size, size_t k,
+                                     mu_store_compare_fn compare_fn) {
+    if (!base || !compare_fn || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+    if (k >= item_count) {
+        return mu_store_sort(base, item_count, item_size, compare_fn);
     }
+    if (k == 0)
+        return MU_STORE_ERR_NONE; // Nothing to sort
+
+    // Put the k smallest items in front of base[k], then sort just those.
+    sort_ctx_t ctx = make_sort_ctx(item_size, compare_fn);
+    uint8_t *begin = (uint8_t *)base;
+    uint8_t *kth = begin + k * item_size;
+    select_loop(&ctx, begin, begin + item_count * item_size, kth,
+                log2_floor(item_count));
+    pdqsort_loop(&ctx, begin, kth, log2_floor(k), true);
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_partial_psort(void **base, size_t item_count, size_t k,
+                                      mu_store_compare_fn compare_fn) {
+    return mu_store_partial_sort(base, item_count, sizeof(void *), k,
+                                 compare_fn);
+}
 
-    // If right child is larger than largest so far
-    // compare receives pointers to the void* pointers: &arr[right] and
-    // &arr[largest]
-    if (right < n && compare(&arr[right], &arr[largest]) > 0) {
-        largest = right;
+mu_store_err_t mu_store_topk(const void *base, size_t item_count,
+                             size_t item_size, size_t k,
+                             mu_store_compare_fn compare_fn, void *out) {
+    if (!compare_fn || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+    if (k > item_count) {
+        k = item_count;
     }
+    if (k == 0)
+        return MU_STORE_ERR_NONE; // Nothing to copy
+    if (!base || !out)
+        return MU_STORE_ERR_PARAM;
+
+    sort_ctx_t ctx = make_sort_ctx(item_size, compare_fn);
+    topk(&ctx, (const uint8_t *)base, item_count, k, (uint8_t *)out);
+    return MU_STORE_ERR_NONE;
+}
 
-    // If largest is not root
-    if (largest != i) {
-        // Swap the void* pointers at i and largest
-        swap_pointers(&arr[i], &arr[largest]);
+mu_store_err_t mu_store_ptopk(void *const *base, size_t item_count, size_t k,
+                              mu_store_compare_fn compare_fn, void **out) {
+    return mu_store_topk(base, item_count, sizeof(void *), k, compare_fn, out);
+}
+
+mu_store_err_t mu_store_argsort(const void *base, size_t item_count,
+                                size_t item_size,
+                                mu_store_compare_fn compare_fn, void *indices,
+                                size_t index_size) {
+    if (!base || !compare_fn || !indices || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+    if (!index_size_ok(index_size, item_count))
+        return MU_STORE_ERR_PARAM;
+
+    uint8_t *begin = (uint8_t *)indices;
+    for (size_t i = 0; i < item_count; i++) {
+        store_index(begin + i * index_size, index_size, i);
+    }
+    if (item_count <= 1)
+        return MU_STORE_ERR_NONE; // Nothing to sort
+
+    // Sort the indices, comparing the items they refer to.
+    argsort_ctx_t actx = {.keys = (const uint8_t *)base,
+                          .key_size = item_size,
+                          .index_size = index_size,
+                          .compare = compare_fn};
+    sort_ctx_t ctx = make_sort_ctx_arg(index_size, compare_indices, &actx);
+    pdqsort_loop(&ctx, begin, begin + item_count * index_size,
+                 log2_floor(item_count), true);
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_apply_permutation(void *base, size_t item_count,
+                                          size_t item_size, void *perm,
+                                          size_t index_size) {
+    if (!base || !perm || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+    if (!index_size_ok(index_size, item_count))
+        return MU_STORE_ERR_PARAM;
+
+    // Reject out-of-range entries before writing anything.  This includes
+    // any entry with the top bit set, since item_count <= that bit.
+    uint8_t *p = (uint8_t *)perm;
+    for (size_t i = 0; i < item_count; i++) {
+        if (load_index(p + i * index_size, index_size) >= item_count)
+            return MU_STORE_ERR_PARAM;
+    }
+
+    // Check for repeated entries, using the top bit of entry k to record
+    // that index k has been seen.  The marks are always removed again.
+    size_t mark = (size_t)1 << (8 * index_size - 1);
+    bool valid = true;
+    for (size_t i = 0; i < item_count; i++) {
+        size_t k = load_index(p + i * index_size, index_size) & ~mark;
+        size_t seen = load_index(p + k * index_size, index_size);
+        if (seen & mark) {
+            valid = false;
+            break;
+        }
+        store_index(p + k * index_size, index_size, seen | mark);
+    }
+    for (size_t i = 0; i < item_count; i++) {
+        size_t k = load_index(p + i * index_size, index_size);
+        store_index(p + i * index_size, index_size, k & ~mark);
+    }
+    if (!valid)
+        return MU_STORE_ERR_PARAM;
+
+    permute((uint8_t *)base, item_count, item_size, p, index_size);
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_partition(void *base, size_t item_count,
+                                  size_t item_size, mu_store_find_fn pred_fn,
+                                  const void *arg, size_t *split) {
+    if (!base || !pred_fn || !split || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+
+    swap_fn swap = select_swap(item_size);
+    uint8_t *lo = (uint8_t *)base;
+    uint8_t *hi = lo + item_count * item_size;
+    // Items before `lo` match, items from `hi` on fail; [lo, hi) untested.
+    while (true) {
+        while (lo < hi && pred_fn(lo, arg)) {
+            lo += item_size;
+        }
+        if (lo >= hi) {
+            break;
+        }
+        // base[lo] is known to fail: scan back for a match, stopping short
+        // of `lo` so that it is not tested again.
+        hi -= item_size;
+        while (hi > lo && !pred_fn(hi, arg)) {
+            hi -= item_size;
+        }
+        if (hi == lo) {
+            break;
+        }
+        // base[lo] fails and base[hi] matches: exchange them.
+        swap(lo, hi, item_size);
+        lo += item_size;
+    }
+    *split = (size_t)(lo - (uint8_t *)base) / item_size;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_stable_partition(void *base, size_t item_count,
+                                         size_t item_size,
+                                         mu_store_find_fn pred_fn,
+                                         const void *arg, void *scratch,
+                                         size_t scratch_count, size_t *split) {
+    if (!base || !pred_fn || !split || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+
+    // Only the swap kernel and scratch of the merge context are used.
+    merge_ctx_t m = {.sort = make_sort_ctx(item_size, NULL),
+                     .scratch = (uint8_t *)scratch,
+                     .scratch_count = scratch ? scratch_count : 0};
+    uint8_t *begin = (uint8_t *)base;
+    uint8_t *mid = stable_partition(&m, begin, item_count, pred_fn, arg);
+    *split = (size_t)(mid - begin) / item_size;
+    return MU_STORE_ERR_NONE;
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+/**
+ * @brief Return a pointer to the item `n` items past `p`.
+ */
+static inline uint8_t *item_at(const sort_ctx_t *ctx, uint8_t *p, size_t n) {
+    return p + n * ctx->item_size;
+}
+
+/**
+ * @brief Return true if the item at `a` sorts strictly before the item at `b`.
+ */
+static inline bool item_less(const sort_ctx_t *ctx, const void *a,
+                             const void *b) {
+    if (ctx->compare) {
+        return ctx->compare(a, b) < 0;
+    }
+    return ctx->compare_arg(a, b, ctx->arg) < 0;
+}
+
+/**
+ * @brief Order two items so that *a <= *b.
+ */
+static inline void sort2(const sort_ctx_t *ctx, uint8_t *a, uint8_t *b) {
+    if (item_less(ctx, b, a)) {
+        ctx->swap(a, b, ctx->item_size);
+    }
+}
+
+/**
+ * @brief Order three items so that *a <= *b <= *c.
+ */
+static inline void sort3(const sort_ctx_t *ctx, uint8_t *a, uint8_t *b,
+                         uint8_t *c) {
+    sort2(ctx, a, b);
+    sort2(ctx, b, c);
+    sort2(ctx, a, b);
+}
+
+/**
+ * @brief Insertion sort of [begin, end) using adjacent swaps.
+ */
+static void insertion_sort(const sort_ctx_t *ctx, uint8_t *begin,
+                           uint8_t *end) {
+    size_t size = ctx->item_size;
+    for (uint8_t *cur = begin + size; cur < end; cur += size) {
+        for (uint8_t *sift = cur;
+             sift > begin && item_less(ctx, sift, sift - size); sift -= size) {
+            ctx->swap(sift - size, sift, size);
+        }
+    }
+}
+
+/**
+ * @brief Insertion sort of [begin, end) that assumes the item just before
+ * `begin` is <= every item in the range and so may serve as a sentinel.
+ */
+static void unguarded_insertion_sort(const sort_ctx_t *ctx, uint8_t *begin,
+                                     uint8_t *end) {
+    size_t size = ctx->item_size;
+    for (uint8_t *cur = begin + size; cur < end; cur += size) {
+        for (uint8_t *sift = cur; item_less(ctx, sift, sift - size);
+             sift -= size) {
+            ctx->swap(sift - size, sift, size);
+        }
+    }
+}
+
+/**
+ * @brief Attempt an insertion sort of [begin, end), giving up once more than
+ * MU_STORE_PARTIAL_INSERTION_LIMIT items have been moved.
+ *
+ * @return true if the range is now sorted, false if the attempt was abandoned.
+ */
+static bool partial_insertion_sort(const sort_ctx_t *ctx, uint8_t *begin,
+                                   uint8_t *end) {
+    size_t size = ctx->item_size;
+    size_t moves = 0;
+    if (begin == end) {
+        return true;
+    }
+    for (uint8_t *cur = begin + size; cur < end; cur += size) {
+        uint8_t *sift = cur;
+        while (sift > begin && item_less(ctx, sift, sift - size)) {
+            ctx->swap(sift - size, sift, size);
+            sift -= size;
+        }
+        moves += (size_t)(cur - sift) / size;
+        if (moves > MU_STORE_PARTIAL_INSERTION_LIMIT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Partition [begin, end) around the pivot stored at `begin`.
+ *
+ * Items strictly less than the pivot end up to its left, items greater than
+ * or equal to it to its right.  The pivot itself never moves until the end,
+ * so it can be compared in place without a temporary copy.
+ *
+ * @param already_partitioned Set to true if no swaps were needed.
+ * @return Final address of the pivot.
+ */
+static uint8_t *partition_right(const sort_ctx_t *ctx, uint8_t *begin,
+                                uint8_t *end, bool *already_partitioned) {
+    size_t size = ctx->item_size;
+    uint8_t *pivot = begin;
+    uint8_t *first = begin;
+    uint8_t *last = end;
+
+    // Find the first item >= pivot.  Pivot selection guarantees one exists.
+    do {
+        first += size;
+    } while (item_less(ctx, first, pivot));
+
+    // Find the last item < pivot.  If no item < pivot was found above, guard
+    // against running off the front of the range.
+    if (first - size == begin) {
+        do {
+            last -= size;
+        } while (first < last && !item_less(ctx, last, pivot));
+    } else {
+        do {
+            last -= size;
+        } while (!item_less(ctx, last, pivot));
+    }
+
+    *already_partitioned = first >= last;
+
+    // Swap misplaced pairs; the previous scans left sentinels on both sides.
+    while (first < last) {
+        ctx->swap(first, last, size);
+        do {
+            first += size;
+        } while (item_less(ctx, first, pivot));
+        do {
+            last -= size;
+        } while (!item_less(ctx, last, pivot));
+    }
+
+    uint8_t *pivot_pos = first - size;
+    if (pivot_pos != begin) {
+        ctx->swap(begin, pivot_pos, size);
+    }
+    return pivot_pos;
+}
+
+/**
+ * @brief Partition [begin, end) around the pivot at `begin`, placing items
+ * equal to the pivot on the left.
+ *
+ * Used when the pivot equals the item preceding the range, in which case the
+ * left partition consists solely of equal items and needs no further sorting.
+ *
+ * @return Final address of the pivot.
+ */
+static uint8_t *partition_left(const sort_ctx_t *ctx, uint8_t *begin,
+                               uint8_t *end) {
+    size_t size = ctx->item_size;
+    uint8_t *pivot = begin;
+    uint8_t *first = begin;
+    uint8_t *last = end;
+
+    do {
+        last -= size;
+    } while (item_less(ctx, pivot, last));
+
+    if (last + size == end) {
+        do {
+            first += size;
+        } while (first < last && !item_less(ctx, pivot, first));
+    } else {
+        do {
+            first += size;
+        } while (!item_less(ctx, pivot, first));
+    }
+
+    while (first < last) {
+        ctx->swap(first, last, size);
+        do {
+            last -= size;
+        } while (item_less(ctx, pivot, last));
+        do {
+            first += size;
+        } while (!item_less(ctx, pivot, first));
+    }
+
+    if (last != begin) {
+        ctx->swap(begin, last, size);
+    }
+    return last;
+}
+
+/**
+ * @brief Swap a few items at fixed offsets to break up patterns that led to
+ * an unbalanced partition of `n` items starting at `lo` and ending at `hi`.
+ */
+static void break_patterns(const sort_ctx_t *ctx, uint8_t *lo, uint8_t *hi,
+                           size_t n) {
+    size_t size = ctx->item_size;
+    if (n < MU_STORE_INSERTION_THRESHOLD) {
+        return;
+    }
+    size_t q = n / 4;
+    ctx->swap(lo, item_at(ctx, lo, q), size);
+    ctx->swap(hi - size, hi - q * size, size);
+    if (n > MU_STORE_NINTHER_THRESHOLD) {
+        ctx->swap(lo + size, item_at(ctx, lo, q + 1), size);
+        ctx->swap(lo + 2 * size, item_at(ctx, lo, q + 2), size);
+        ctx->swap(hi - 2 * size, hi - (q + 1) * size, size);
+        ctx->swap(hi - 3 * size, hi - (q + 2) * size, size);
+    }
+}
+
+static void pdqsort_loop(const sort_ctx_t *ctx, uint8_t *begin, uint8_t *end,
+                         int bad_allowed, bool leftmost) {
+    size_t size = ctx->item_size;
+
+    while (true) {
+        size_t n = (size_t)(end - begin) / size;
+
+        if (n < MU_STORE_INSERTION_THRESHOLD) {
+            if (leftmost) {
+                insertion_sort(ctx, begin, end);
+            } else {
+                unguarded_insertion_sort(ctx, begin, end);
+            }
+            return;
+        }
+
+        // Choose a pivot (median of 3, or pseudo-median of 9 for large
+        // ranges) and move it to `begin`.
+        size_t half = n / 2;
+        uint8_t *mid = item_at(ctx, begin, half);
+        if (n > MU_STORE_NINTHER_THRESHOLD) {
+            sort3(ctx, begin, mid, end - size);
+            sort3(ctx, begin + size, mid - size, end - 2 * size);
+            sort3(ctx, begin + 2 * size, mid + size, end - 3 * size);
+            sort3(ctx, mid - size, mid, mid + size);
+            ctx->swap(begin, mid, size);
+        } else {
+            sort3(ctx, mid, begin, end - size);
+        }
+
+        // If the item preceding this range equals the pivot, every item in
+        // the range is >= pivot: gather the equal ones on the left and skip
+        // them entirely.
+        if (!leftmost && !item_less(ctx, begin - size, begin)) {
+            begin = partition_left(ctx, begin, end) + size;
+            continue;
+        }
+
+        bool already_partitioned;
+        uint8_t *pivot_pos =
+            partition_right(ctx, begin, end, &already_partitioned);
+        size_t l_n = (size_t)(pivot_pos - begin) / size;
+        size_t r_n = (size_t)(end - (pivot_pos + size)) / size;
+
+        if (l_n < n / 8 || r_n < n / 8) {
+            // Highly unbalanced: after too many of these, give up on
+            // quicksort and guarantee O(n log n) with heapsort.
+            if (--bad_allowed == 0) {
+                heap_sort(ctx, begin, end);
+                return;
+            }
+            break_patterns(ctx, begin, pivot_pos, l_n);
+            break_patterns(ctx, pivot_pos + size, end, r_n);
+        } else if (already_partitioned &&
+                   partial_insertion_sort(ctx, begin, pivot_pos) &&
+                   partial_insertion_sort(ctx, pivot_pos + size, end)) {
+            // The input looked sorted and a cheap insertion pass confirmed it.
+            return;
+        }
+
+        // Recurse into the smaller side and loop on the larger one so that
+        // the stack depth stays O(log n).
+        if (l_n < r_n) {
+            pdqsort_loop(ctx, begin, pivot_pos, bad_allowed, leftmost);
+            begin = pivot_pos + size;
+            leftmost = false;
+        } else {
+            pdqsort_loop(ctx, pivot_pos + size, end, bad_allowed, false);
+            end = pivot_pos;
+        }
+    }
+}
+
+/**
+ * @brief Restore the max-heap property by sifting the item at `root` down.
+ */
+static void sift_down(const sort_ctx_t *ctx, uint8_t *base, size_t root,
+                      size_t n) {
+    size_t size = ctx->item_size;
+    while (true) {
+        size_t child = 2 * root + 1;
+        if (child >= n) {
+            return;
+        }
+        uint8_t *child_addr = item_at(ctx, base, child);
+        if (child + 1 < n && item_less(ctx, child_addr, child_addr + size)) {
+            child++;
+            child_addr += size;
+        }
+        uint8_t *root_addr = item_at(ctx, base, root);
+        if (!item_less(ctx, root_addr, child_addr)) {
+            return;
+        }
+        ctx->swap(root_addr, child_addr, size);
+        root = child;
+    }
+}
+
+static void heap_sort(const sort_ctx_t *ctx, uint8_t *begin, uint8_t *end) {
+    size_t size = ctx->item_size;
+    size_t n = (size_t)(end - begin) / size;
+
+    // Build a max heap, then repeatedly move the maximum to the end.
+    for (size_t i = n / 2; i-- > 0;) {
+        sift_down(ctx, begin, i, n);
+    }
+    for (size_t i = n - 1; i > 0; i--) {
+        ctx->swap(begin, item_at(ctx, begin, i), size);
+        sift_down(ctx, begin, 0, i);
+    }
+}
+
+static void select_loop(const sort_ctx_t *ctx, uint8_t *begin, uint8_t *end,
+                        uint8_t *nth, int bad_allowed) {
+    size_t size = ctx->item_size;
+    bool leftmost = true;
+
+    while (true) {
+        size_t n = (size_t)(end - begin) / size;
+
+        if (n < MU_STORE_INSERTION_THRESHOLD) {
+            if (leftmost) {
+                insertion_sort(ctx, begin, end);
+            } else {
+                unguarded_insertion_sort(ctx, begin, end);
+            }
+            return;
+        }
+
+        // Pivot selection as in pdqsort_loop().
+        size_t half = n / 2;
+        uint8_t *mid = item_at(ctx, begin, half);
+        if (n > MU_STORE_NINTHER_THRESHOLD) {
+            sort3(ctx, begin, mid, end - size);
+            sort3(ctx, begin + size, mid - size, end - 2 * size);
+            sort3(ctx, begin + 2 * size, mid + size, end - 3 * size);
+            sort3(ctx, mid - size, mid, mid + size);
+            ctx->swap(begin, mid, size);
+        } else {
+            sort3(ctx, mid, begin, end - size);
+        }
+
+        // The item preceding the range is <= all of it.  If it equals the
+        // pivot, gather the items equal to it on the left: if `nth` lands
+        // among them it is already in place.
+        if (!leftmost && !item_less(ctx, begin - size, begin)) {
+            begin = partition_left(ctx, begin, end) + size;
+            if (nth < begin) {
+                return;
+            }
+            continue;
+        }
+
+        bool already_partitioned;
+        uint8_t *pivot_pos =
+            partition_right(ctx, begin, end, &already_partitioned);
+        size_t l_n = (size_t)(pivot_pos - begin) / size;
+        size_t r_n = (size_t)(end - (pivot_pos + size)) / size;
+
+        if (l_n < n / 8 || r_n < n / 8) {
+            if (--bad_allowed == 0) {
+                heap_sort(ctx, begin, end);
+                return;
+            }
+            break_patterns(ctx, begin, pivot_pos, l_n);
+            break_patterns(ctx, pivot_pos + size, end, r_n);
+        }
+
+        // Only the side holding `nth` needs further work.
+        if (nth < pivot_pos) {
+            end = pivot_pos;
+        } else if (nth > pivot_pos) {
+            begin = pivot_pos + size;
+            leftmost = false;
+        } else {
+            return;
+        }
+    }
+}
+
+static void topk(const sort_ctx_t *ctx, const uint8_t *base, size_t n,
+                 size_t k, uint8_t *out) {
+    size_t size = ctx->item_size;
+
+    // Seed a max-heap with the first k items.  Each later item that is less
+    // than the heap's maximum replaces it.
+    memcpy(out, base, k * size);
+    for (size_t i = k / 2; i-- > 0;) {
+        sift_down(ctx, out, i, k);
+    }
+    for (const uint8_t *p = base + k * size, *end = base + n * size; p < end;
+         p += size) {
+        if (item_less(ctx, p, out)) {
+            ctx->copy(out, p, size);
+            sift_down(ctx, out, 0, k);
+        }
+    }
+    pdqsort_loop(ctx, out, out + k * size, log2_floor(k), true);
+}
+
+static int compare_indices(const void *a, const void *b, const void *arg) {
+    const argsort_ctx_t *ctx = (const argsort_ctx_t *)arg;
+    size_t ia = load_index(a, ctx->index_size);
+    size_t ib = load_index(b, ctx->index_size);
+    int c = ctx->compare(ctx->keys + ia * ctx->key_size,
+                         ctx->keys + ib * ctx->key_size);
+    if (c != 0) {
+        return c;
+    }
+    return (ia > ib) - (ia < ib);
+}
+
+static void permute(uint8_t *base, size_t n, size_t item_size, uint8_t *perm,
+                    size_t index_size) {
+    uint8_t buf[MU_STORE_PERMUTE_CHUNK];
+    size_t mark = (size_t)1 << (8 * index_size - 1);
+    size_t chunk =
+        item_size < MU_STORE_PERMUTE_CHUNK ? item_size : MU_STORE_PERMUTE_CHUNK;
+    copy_fn copy = select_copy(chunk);
+
+    for (size_t start = 0; start < n; start++) {
+        size_t next = load_index(perm + start * index_size, index_size);
+        if (next == start || (next & mark)) {
+            continue; // Fixed point, or part of a cycle already done
+        }
+        // Walk the cycle once per chunk of the item, so every byte is moved
+        // exactly once.  The last walk marks the cycle as done.
+        for (size_t offset = 0; offset < item_size; offset += chunk) {
+            size_t width = item_size - offset < chunk ? item_size - offset
+                                                      : chunk;
+            bool last = offset + width == item_size;
+            uint8_t *hole = base + start * item_size + offset;
+            size_t j = start;
+
+            copy(buf, hole, width);
+            while (true) {
+                uint8_t *slot = perm + j * index_size;
+                size_t k = load_index(slot, index_size) & ~mark;
+                if (last) {
+                    store_index(slot, index_size, k | mark);
+                }
+                if (k == start) {
+                    break;
+                }
+                uint8_t *src = base + k * item_size + offset;
+                copy(hole, src, width);
+                hole = src;
+                j = k;
+            }
+            copy(hole, buf, width);
+        }
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        uint8_t *slot = perm + i * index_size;
+        store_index(slot, index_size, load_index(slot, index_size) & ~mark);
+    }
+}
+
+/**
+ * @brief Locate the lower or upper bound of `key` in base[0..n) by galloping.
+ *
+ * Probes at exponentially increasing distances from the front (or the back)
+ * of the range before finishing with a binary search, so the cost is
+ * O(log k) where k is the distance of the answer from the starting end.
+ *
+ * @param upper If true, return the upper bound (first item > key); otherwise
+ *        return the lower bound (first item >= key).
+ * @param from_back If true, start probing from the end of the range.
+ * @return Index in [0..n].
+ */
+static size_t gallop(const sort_ctx_t *ctx, const void *key,
+                     const uint8_t *base, size_t n, bool upper,
+                     bool from_back) {
+    size_t size = ctx->item_size;
+    size_t lo = 0, hi = n;
+
+// True while base[i] belongs before `key` (a prefix of the range).
+#define GALLOP_BEFORE(i)                                                       \
+    (upper ? ctx->compare(key, base + (i) * size) >= 0                         \
+           : ctx->compare(key, base + (i) * size) > 0)
+
+    if (!from_back) {
+        for (size_t step = 1; lo < hi; step <<= 1) {
+            size_t p = lo + step - 1;
+            if (p >= hi) {
+                break;
+            }
+            if (GALLOP_BEFORE(p)) {
+                lo = p + 1;
+            } else {
+                hi = p;
+                break;
+            }
+        }
+    } else {
+        for (size_t step = 1; lo < hi; step <<= 1) {
+            size_t p = (step > hi - lo) ? lo : hi - step;
+            if (GALLOP_BEFORE(p)) {
+                lo = p + 1;
+                break;
+            }
+            hi = p;
+        }
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (GALLOP_BEFORE(mid)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+#undef GALLOP_BEFORE
+    return lo;
+}
+
+/**
+ * @brief Reverse the items in [begin, end) in place.
+ */
+static void reverse_range(const sort_ctx_t *ctx, uint8_t *begin,
+                          uint8_t *end) {
+    size_t size = ctx->item_size;
+    while (begin + size < end) {
+        end -= size;
+        ctx->swap(begin, end, size);
+        begin += size;
+    }
+}
+
+/**
+ * @brief Rotate [first, end) so that the item at `mid` becomes the first.
+ *
+ * Uses the scratch buffer when the shorter side fits, otherwise three
+ * in-place reversals.
+ */
+static void rotate_range(const merge_ctx_t *m, uint8_t *first, uint8_t *mid,
+                         uint8_t *end) {
+    const sort_ctx_t *ctx = &m->sort;
+    size_t size = ctx->item_size;
+    size_t left = (size_t)(mid - first) / size;
+    size_t right = (size_t)(end - mid) / size;
+
+    if (left == 0 || right == 0) {
+        return;
+    }
+    if (left <= right && left <= m->scratch_count) {
+        memcpy(m->scratch, first, left * size);
+        memmove(first, mid, right * size);
+        memcpy(first + right * size, m->scratch, left * size);
+    } else if (right < left && right <= m->scratch_count) {
+        memcpy(m->scratch, mid, right * size);
+        memmove(first + right * size, first, left * size);
+        memcpy(first, m->scratch, right * size);
+    } else {
+        reverse_range(ctx, first, mid);
+        reverse_range(ctx, mid, end);
+        reverse_range(ctx, first, end);
+    }
+}
+
+static uint8_t *stable_partition(const merge_ctx_t *m, uint8_t *base,
+                                 size_t n, mu_store_find_fn pred_fn,
+                                 const void *arg) {
+    size_t size = m->sort.item_size;
+    if (n <= 1) {
+        return (n == 1 && pred_fn(base, arg)) ? base + size : base;
+    }
+    if (n <= m->scratch_count) {
+        // Compact matching items in place and set the others aside.
+        uint8_t *keep = base;
+        uint8_t *aside = m->scratch;
+        for (uint8_t *p = base; p < base + n * size; p += size) {
+            if (pred_fn(p, arg)) {
+                if (keep != p) {
+                    memcpy(keep, p, size);
+                }
+                keep += size;
+            } else {
+                memcpy(aside, p, size);
+                aside += size;
+            }
+        }
+        memcpy(keep, m->scratch, (size_t)(aside - m->scratch));
+        return keep;
+    }
+    // [base, left_split) matches, [left_split, mid) doesn't, and likewise
+    // for the right half: rotate the two middle pieces to join the halves.
+    uint8_t *mid = base + (n / 2) * size;
+    uint8_t *left_split = stable_partition(m, base, n / 2, pred_fn, arg);
+    uint8_t *right_split = stable_partition(m, mid, n - n / 2, pred_fn, arg);
+    rotate_range(m, left_split, mid, right_split);
+    return left_split + (right_split - mid);
+}
+
+/**
+ * @brief Merge adjacent sorted runs A=[lo, mid) and B=[mid, hi) when A fits in
+ * the scratch buffer, working front to back.
+ */
+static void merge_lo(const merge_ctx_t *m, uint8_t *lo, uint8_t *mid,
+                     uint8_t *hi) {
+    const sort_ctx_t *ctx = &m->sort;
+    size_t size = ctx->item_size;
+    size_t len_a = (size_t)(mid - lo) / size;
+    uint8_t *a = m->scratch;
+    uint8_t *a_end = a + len_a * size;
+    uint8_t *b = mid;
+    uint8_t *dest = lo;
+    size_t a_wins = 0, b_wins = 0;
+
+    memcpy(a, lo, len_a * size);
+
+    while (a < a_end && b < hi) {
+        if (item_less(ctx, b, a)) {
+            ctx->copy(dest, b, size);
+            dest += size;
+            b += size;
+            b_wins++;
+            a_wins = 0;
+        } else {
+            ctx->copy(dest, a, size);
+            dest += size;
+            a += size;
+            a_wins++;
+            b_wins = 0;
+        }
+
+        if (a_wins >= MU_STORE_MIN_GALLOP && a < a_end && b < hi) {
+            // A keeps winning: copy every remaining A item <= *b in one go.
+            size_t k = gallop(ctx, b, a, (size_t)(a_end - a) / size, true,
+                              false);
+            memcpy(dest, a, k * size);
+            dest += k * size;
+            a += k * size;
+            a_wins = 0;
+        } else if (b_wins >= MU_STORE_MIN_GALLOP && a < a_end && b < hi) {
+            // B keeps winning: move every remaining B item < *a in one go.
+            size_t k = gallop(ctx, a, b, (size_t)(hi - b) / size, false,
+                              false);
+            memmove(dest, b, k * size);
+            dest += k * size;
+            b += k * size;
+            b_wins = 0;
+        }
+    }
+    // Any remaining B items are already in place.
+    memcpy(dest, a, (size_t)(a_end - a));
+}
+
+/**
+ * @brief Merge adjacent sorted runs A=[lo, mid) and B=[mid, hi) when B fits in
+ * the scratch buffer, working back to front.
+ */
+static void merge_hi(const merge_ctx_t *m, uint8_t *lo, uint8_t *mid,
+                     uint8_t *hi) {
+    const sort_ctx_t *ctx = &m->sort;
+    size_t size = ctx->item_size;
+    size_t len_b = (size_t)(hi - mid) / size;
+    uint8_t *b_begin = m->scratch;
+    uint8_t *b = b_begin + len_b * size; // one past the last unmerged B item
+    uint8_t *a = mid;                    // one past the last unmerged A item
+    uint8_t *dest = hi;
+    size_t a_wins = 0, b_wins = 0;
+
+    memcpy(b_begin, mid, len_b * size);
+
+    while (a > lo && b > b_begin) {
+        if (item_less(ctx, b - size, a - size)) {
+            a -= size;
+            dest -= size;
+            ctx->copy(dest, a, size);
+            a_wins++;
+            b_wins = 0;
+        } else {
+            b -= size;
+            dest -= size;
+            ctx->copy(dest, b, size);
+            b_wins++;
+            a_wins = 0;
+        }
+
+        if (a_wins >= MU_STORE_MIN_GALLOP && a > lo && b > b_begin) {
+            // A keeps winning: move every remaining A item > b[-1] in one go.
+            size_t n = (size_t)(a - lo) / size;
+            size_t k = n - gallop(ctx, b - size, lo, n, true, true);
+            a -= k * size;
+            dest -= k * size;
+            memmove(dest, a, k * size);
+            a_wins = 0;
+        } else if (b_wins >= MU_STORE_MIN_GALLOP && a > lo && b > b_begin) {
+            // B keeps winning: copy every remaining B item >= a[-1] in one go.
+            size_t n = (size_t)(b - b_begin) / size;
+            size_t k = n - gallop(ctx, a - size, b_begin, n, false, true);
+            b -= k * size;
+            dest -= k * size;
+            memcpy(dest, b, k * size);
+            b_wins = 0;
+        }
+    }
+    // Any remaining A items are already in place.
+    memcpy(lo, b_begin, (size_t)(b - b_begin));
+}
+
+static void merge_runs(const merge_ctx_t *m, uint8_t *lo, uint8_t *mid,
+                       uint8_t *hi) {
+    const sort_ctx_t *ctx = &m->sort;
+    size_t size = ctx->item_size;
+
+    while (lo < mid && mid < hi) {
+        // Items of A that are <= B[0] are already in their final place, as
+        // are items of B that are >= A[last].
+        lo += size * gallop(ctx, mid, lo, (size_t)(mid - lo) / size, true,
+                            false);
+        if (lo == mid) {
+            return;
+        }
+        hi = mid + size * gallop(ctx, mid - size, mid,
+                                 (size_t)(hi - mid) / size, false, true);
+        if (hi == mid) {
+            return;
+        }
+
+        size_t len_a = (size_t)(mid - lo) / size;
+        size_t len_b = (size_t)(hi - mid) / size;
+        if (len_a <= len_b && len_a <= m->scratch_count) {
+            merge_lo(m, lo, mid, hi);
+            return;
+        }
+        if (len_b <= m->scratch_count) {
+            merge_hi(m, lo, mid, hi);
+            return;
+        }
+        if (len_a == 1 && len_b == 1) {
+            // Trimming guarantees the pair is out of order.
+            ctx->swap(lo, mid, size);
+            return;
+        }
+
+        // Neither run fits in scratch: split the longer run in half, find
+        // the matching cut in the other run, rotate the middle pieces into
+        // place and merge the two halves independently.
+        uint8_t *cut_a, *cut_b;
+        if (len_a > len_b) {
+            cut_a = item_at(ctx, lo, len_a / 2);
+            cut_b = mid + size * gallop(ctx, cut_a, mid, len_b, false, false);
+        } else {
+            cut_b = item_at(ctx, mid, len_b / 2);
+            cut_a = lo + size * gallop(ctx, cut_b, lo, len_a, true, false);
+        }
+        rotate_range(m, cut_a, mid, cut_b);
+        uint8_t *new_mid = cut_a + (cut_b - mid);
+
+        // Recurse into the smaller half, loop on the larger one.
+        if (new_mid - lo < hi - new_mid) {
+            merge_runs(m, lo, cut_a, new_mid);
+            lo = new_mid;
+            mid = cut_b;
+        } else {
+            merge_runs(m, new_mid, cut_b, hi);
+            hi = new_mid;
+            mid = cut_a;
+        }
+    }
+}
+
+/**
+ * @brief Compute the minimum run length for a sort of `n` items.
+ *
+ * Chosen as in timsort so that n / min_run is close to, but not above, a
+ * power of two, which keeps the final merges balanced.
+ */
+static size_t compute_min_run(size_t n) {
+    size_t r = 0;
+    while (n >= MU_STORE_MIN_MERGE) {
+        r |= n & 1;
+        n >>= 1;
+    }
+    return n + r;
+}
+
+/**
+ * @brief Return the length of the natural run starting at `begin`, reversing
+ * it in place if it is strictly descending.
+ */
+static size_t count_run_and_make_ascending(const sort_ctx_t *ctx,
+                                           uint8_t *begin, uint8_t *end) {
+    size_t size = ctx->item_size;
+    uint8_t *run_end = begin + size;
+
+    if (run_end == end) {
+        return 1;
+    }
+    if (item_less(ctx, run_end, begin)) {
+        // Strictly descending: equal items never appear, so reversing the
+        // run preserves stability.
+        while (run_end + size < end && item_less(ctx, run_end + size, run_end)) {
+            run_end += size;
+        }
+        run_end += size;
+        reverse_range(ctx, begin, run_end);
+    } else {
+        while (run_end + size < end &&
+               !item_less(ctx, run_end + size, run_end)) {
+            run_end += size;
+        }
+        run_end += size;
+    }
+    return (size_t)(run_end - begin) / size;
+}
+
+/**
+ * @brief Extend the sorted prefix [begin, begin + sorted) to [begin, end) with
+ * a stable insertion sort.
+ */
+static void extend_run(const sort_ctx_t *ctx, uint8_t *begin, size_t sorted,
+                       uint8_t *end) {
+    size_t size = ctx->item_size;
+    for (uint8_t *cur = item_at(ctx, begin, sorted); cur < end; cur += size) {
+        for (uint8_t *sift = cur;
+             sift > begin && item_less(ctx, sift, sift - size); sift -= size) {
+            ctx->swap(sift - size, sift, size);
+        }
+    }
+}
+
+/**
+ * @brief Merge runs `i` and `i + 1` of the run stack.
+ */
+static void merge_at(const merge_ctx_t *m, uint8_t *base, run_t *runs,
+                     size_t *n_runs, size_t i) {
+    size_t size = m->sort.item_size;
+    uint8_t *lo = base + runs[i].start * size;
+    uint8_t *mid = base + runs[i + 1].start * size;
+    uint8_t *hi = mid + runs[i + 1].len * size;
+
+    runs[i].len += runs[i + 1].len;
+    if (i + 2 < *n_runs) {
+        runs[i + 1] = runs[i + 2];
+    }
+    (*n_runs)--;
+    merge_runs(m, lo, mid, hi);
+}
+
+static void stable_sort(const merge_ctx_t *m, uint8_t *base, size_t n) {
+    const sort_ctx_t *ctx = &m->sort;
+    size_t size = ctx->item_size;
+    run_t runs[MU_STORE_MAX_RUNS];
+    size_t n_runs = 0;
+    size_t min_run = compute_min_run(n);
+    size_t pos = 0;
+
+    while (pos < n) {
+        uint8_t *run_begin = base + pos * size;
+        size_t remaining = n - pos;
+        size_t len = count_run_and_make_ascending(ctx, run_begin,
+                                                  base + n * size);
+        if (len < min_run) {
+            size_t forced = remaining < min_run ? remaining : min_run;
+            extend_run(ctx, run_begin, len, item_at(ctx, run_begin, forced));
+            len = forced;
+        }
+        runs[n_runs].start = pos;
+        runs[n_runs].len = len;
+        n_runs++;
+        pos += len;
+
+        // Restore the run-length invariants so the stack stays O(log n)
+        // deep and merges remain balanced.
+        while (n_runs > 1) {
+            size_t i = n_runs - 2;
+            if ((i > 0 && runs[i - 1].len <= runs[i].len + runs[i + 1].len) ||
+                (i > 1 && runs[i - 2].len <= runs[i - 1].len + runs[i].len)) {
+                if (runs[i - 1].len < runs[i + 1].len) {
+                    i--;
+                }
+            } else if (runs[i].len > runs[i + 1].len) {
+                break;
+            }
+            merge_at(m, base, runs, &n_runs, i);
+        }
+    }
+
+    // Collapse whatever remains on the stack.
+    while (n_runs > 1) {
+        size_t i = n_runs - 2;
+        if (i > 0 && runs[i - 1].len < runs[i + 1].len) {
+            i--;
+        }
+        merge_at(m, base, runs, &n_runs, i);
+    }
+}
+
+/**
+ * @brief Load the key of `item` and map it to an order-preserving unsigned
+ * integer.
+ */
+static inline uint64_t radix_key(const radix_ctx_t *r, const uint8_t *item) {
+    const uint8_t *p = item + r->key_offset;
+    uint64_t k;
+    switch (r->key_width) {
+    case 1:
+        k = *p;
+        break;
+    case 2: {
+        uint16_t k16;
+        memcpy(&k16, p, sizeof(k16));
+        k = k16;
+    } break;
+    case 4: {
+        uint32_t k32;
+        memcpy(&k32, p, sizeof(k32));
+        k = k32;
+    } break;
+    default:
+        memcpy(&k, p, sizeof(k));
+        break;
+    }
+    // Signed: flip the sign bit.  Float: flip the sign bit of positive keys,
+    // invert all bits of negative ones so larger magnitudes sort first.
+    if (r->is_float && (k & r->sign_bit)) {
+        k = ~k;
+    } else {
+        k ^= r->flip;
+    }
+    return (k ^ r->invert) & r->mask;
+}
+
+static void radix_sort(const radix_ctx_t *r, size_t item_size, uint8_t *base,
+                       uint8_t *scratch, size_t n) {
+    // One digit's histogram at a time keeps the stack use to 256 counters,
+    // at the cost of one extra read of the keys per pass.
+    size_t count[MU_STORE_RADIX_BUCKETS];
+    size_t passes = r->key_width;
+    copy_fn copy = select_copy(item_size);
+
+    uint8_t *src = base;
+    uint8_t *dst = scratch;
+    for (size_t pass = 0; pass < passes; pass++) {
+        unsigned shift = (unsigned)(pass * MU_STORE_RADIX_BITS);
+
+        memset(count, 0, sizeof(count));
+        for (uint8_t *item = src, *end = src + n * item_size; item < end;
+             item += item_size) {
+            count[(radix_key(r, item) >> shift) &
+                  (MU_STORE_RADIX_BUCKETS - 1)]++;
+        }
+
+        // If every item has the same digit this pass would not move anything.
+        size_t first_digit =
+            (radix_key(r, src) >> shift) & (MU_STORE_RADIX_BUCKETS - 1);
+        if (count[first_digit] == n) {
+            continue;
+        }
+
+        // Turn the counts into starting offsets, then scatter stably.
+        size_t offset = 0;
+        for (size_t digit = 0; digit < MU_STORE_RADIX_BUCKETS; digit++) {
+            size_t c = count[digit];
+            count[digit] = offset;
+            offset += c;
+        }
+        for (uint8_t *item = src, *end = src + n * item_size; item < end;
+             item += item_size) {
+            size_t digit =
+                (radix_key(r, item) >> shift) & (MU_STORE_RADIX_BUCKETS - 1);
+            copy(dst + count[digit]++ * item_size, item, item_size);
+        }
+
+        uint8_t *tmp = src;
+        src = dst;
+        dst = tmp;
+    }
+
+    // An odd number of passes leaves the result in the scratch buffer.
+    if (src != base) {
+        memcpy(base, src, n * item_size);
+    }
+}
+
+static void radix_insertion_sort(const radix_ctx_t *r, size_t item_size,
+                                 uint8_t *base, size_t n) {
+    swap_fn swap = select_swap(item_size);
+    for (size_t i = 1; i < n; i++) {
+        uint8_t *cur = base + i * item_size;
+        uint64_t key = radix_key(r, cur);
+        for (uint8_t *sift = cur;
+             sift > base && key < radix_key(r, sift - item_size);
+             sift -= item_size) {
+            swap(sift - item_size, sift, item_size);
+        }
+    }
+}
+
+static bool make_radix_ctx(radix_ctx_t *r, size_t item_size,
+                           size_t key_offset, size_t key_width,
+                           mu_store_radix_flags_t flags) {
+    if (item_size == 0)
+        return false;
+    if (key_width != 1 && key_width != 2 && key_width != 4 && key_width != 8)
+        return false;
+    if (key_offset > item_size || key_width > item_size - key_offset)
+        return false;
+
+    unsigned key_type = flags & ~(unsigned)MU_STORE_RADIX_DESCENDING;
+    if (key_type > MU_STORE_RADIX_FLOAT)
+        return false;
+    if (key_type == MU_STORE_RADIX_FLOAT && key_width < 4)
+        return false;
+
+    r->key_offset = key_offset;
+    r->key_width = key_width;
+    r->mask =
+        key_width == 8 ? UINT64_MAX : (UINT64_C(1) << (8 * key_width)) - 1;
+    r->sign_bit = UINT64_C(1) << (8 * key_width - 1);
+    r->flip = key_type == MU_STORE_RADIX_UNSIGNED ? 0 : r->sign_bit;
+    r->invert = (flags & MU_STORE_RADIX_DESCENDING) ? r->mask : 0;
+    r->is_float = key_type == MU_STORE_RADIX_FLOAT;
+    return true;
+}
+
+static bool make_field_scan(field_scan_t *s, size_t item_size,
+                            size_t key_offset, size_t key_width,
+                            mu_store_radix_flags_t flags, const void *lo,
+                            const void *hi) {
+    flags = (mu_store_radix_flags_t)(flags & ~MU_STORE_RADIX_DESCENDING);
+    if (!lo || !hi ||
+        !make_radix_ctx(&s->key, item_size, key_offset, key_width, flags))
+        return false;
+
+    // Map the bare bounds exactly as the keys embedded in the items.
+    radix_ctx_t bare = s->key;
+    bare.key_offset = 0;
+    uint64_t lo_key = radix_key(&bare, (const uint8_t *)lo);
+    uint64_t hi_key = radix_key(&bare, (const uint8_t *)hi);
+    s->lo = lo_key;
+    s->span = hi_key - lo_key;
+    s->empty = hi_key < lo_key;
+    return true;
+}
+
+/**
+ * @brief Portable scan of items [i, n) with the key width fixed at compile
+ * time once inlined.
+ */
+static inline size_t field_scan_width(const field_scan_t *s,
+                                      const uint8_t *base, size_t i, size_t n,
+                                      size_t item_size, bool count_all,
+                                      size_t key_width) {
+    radix_ctx_t key = s->key;
+    key.key_width = key_width;
+    size_t matches = 0;
+    for (const uint8_t *p = base + i * item_size; i < n; i++, p += item_size) {
+        bool match = radix_key(&key, p) - s->lo <= s->span;
+        if (count_all) {
+            matches += match;
+        } else if (match) {
+            return i;
+        }
+    }
+    return count_all ? matches : n;
+}
+
+/**
+ * @brief Portable scan of items [i, n); see field_scan().
+ */
+static size_t field_scan_scalar(const field_scan_t *s, const uint8_t *base,
+                                size_t i, size_t n, size_t item_size,
+                                bool count_all) {
+    switch (s->key.key_width) {
+    case 1:
+        return field_scan_width(s, base, i, n, item_size, count_all, 1);
+    case 2:
+        return field_scan_width(s, base, i, n, item_size, count_all, 2);
+    case 4:
+        return field_scan_width(s, base, i, n, item_size, count_all, 4);
+    default:
+        return field_scan_width(s, base, i, n, item_size, count_all, 8);
+    }
+}
+
+#if MU_STORE_HAVE_AVX2
+
+/**
+ * @brief AVX2 scan of 4-byte keys, eight items per step.  Requires
+ * `7 * item_size` to fit in an int32_t gather offset.
+ */
+__attribute__((target("avx2"))) static size_t
+field_scan_avx2_32(const field_scan_t *s, const uint8_t *base, size_t n,
+                   size_t item_size, bool count_all) {
+    const int stride = (int)item_size;
+    const __m256i offsets =
+        _mm256_setr_epi32(0, stride, 2 * stride, 3 * stride, 4 * stride,
+                          5 * stride, 6 * stride, 7 * stride);
+    const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+    const __m256i flip = _mm256_set1_epi32((int32_t)(uint32_t)s->key.flip);
+    const __m256i lo = _mm256_set1_epi32((int32_t)(uint32_t)s->lo);
+    // Unsigned d <= span, as a signed comparison with both sign bits flipped.
+    const __m256i span =
+        _mm256_xor_si256(_mm256_set1_epi32((int32_t)(uint32_t)s->span), sign);
+    const bool packed = item_size == 4;
+    const uint8_t *p = base + s->key.key_offset;
+    size_t matches = 0;
+    size_t i = 0;
+
+    for (; i + 8 <= n; i += 8, p += 8 * item_size) {
+        __m256i k = packed ? _mm256_loadu_si256((const __m256i *)p)
+                           : _mm256_i32gather_epi32((const int *)p, offsets, 1);
+        if (s->key.is_float) {
+            // Invert negative keys, flip the sign bit of the others.
+            k = _mm256_xor_si256(
+                k, _mm256_or_si256(_mm256_srai_epi32(k, 31), sign));
+        } else {
+            k = _mm256_xor_si256(k, flip);
+        }
+        __m256i d = _mm256_xor_si256(_mm256_sub_epi32(k, lo), sign);
+        unsigned miss = (unsigned)_mm256_movemask_ps(
+            _mm256_castsi256_ps(_mm256_cmpgt_epi32(d, span)));
+        unsigned hit = ~miss & 0xffu;
+        if (count_all) {
+            matches += (size_t)__builtin_popcount(hit);
+        } else if (hit) {
+            return i + (size_t)__builtin_ctz(hit);
+        }
+    }
+    size_t tail = field_scan_scalar(s, base, i, n, item_size, count_all);
+    return count_all ? matches + tail : tail;
+}
+
+/**
+ * @brief AVX2 scan of 8-byte keys, four items per step.
+ */
+__attribute__((target("avx2"))) static size_t
+field_scan_avx2_64(const field_scan_t *s, const uint8_t *base, size_t n,
+                   size_t item_size, bool count_all) {
+    const long long stride = (long long)item_size;
+    const __m256i offsets =
+        _mm256_setr_epi64x(0, stride, 2 * stride, 3 * stride);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    const __m256i flip = _mm256_set1_epi64x((long long)s->key.flip);
+    const __m256i lo = _mm256_set1_epi64x((long long)s->lo);
+    const __m256i span =
+        _mm256_xor_si256(_mm256_set1_epi64x((long long)s->span), sign);
+    const bool packed = item_size == 8;
+    const uint8_t *p = base + s->key.key_offset;
+    size_t matches = 0;
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4, p += 4 * item_size) {
+        __m256i k =
+            packed ? _mm256_loadu_si256((const __m256i *)p)
+                   : _mm256_i64gather_epi64((const long long *)p, offsets, 1);
+        if (s->key.is_float) {
+            k = _mm256_xor_si256(
+                k, _mm256_or_si256(_mm256_cmpgt_epi64(zero, k), sign));
+        } else {
+            k = _mm256_xor_si256(k, flip);
+        }
+        __m256i d = _mm256_xor_si256(_mm256_sub_epi64(k, lo), sign);
+        unsigned miss = (unsigned)_mm256_movemask_pd(
+            _mm256_castsi256_pd(_mm256_cmpgt_epi64(d, span)));
+        unsigned hit = ~miss & 0xfu;
+        if (count_all) {
+            matches += (size_t)__builtin_popcount(hit);
+        } else if (hit) {
+            return i + (size_t)__builtin_ctz(hit);
+        }
+    }
+    size_t tail = field_scan_scalar(s, base, i, n, item_size, count_all);
+    return count_all ? matches + tail : tail;
+}
+
+#endif // MU_STORE_HAVE_AVX2
+
+static size_t field_scan(const field_scan_t *s, const uint8_t *base, size_t n,
+                         size_t item_size, bool count_all) {
+    if (s->empty) {
+        return count_all ? 0 : n;
+    }
+#if MU_STORE_HAVE_AVX2
+    if (__builtin_cpu_supports("avx2")) {
+        if (s->key.key_width == 4 && item_size <= INT32_MAX / 8) {
+            return field_scan_avx2_32(s, base, n, item_size, count_all);
+        }
+        if (s->key.key_width == 8) {
+            return field_scan_avx2_64(s, base, n, item_size, count_all);
+        }
+    }
+#endif
+    return field_scan_scalar(s, base, 0, n, item_size, count_all);
+}
+
+static int compare_key_pairs(const void *a, const void *b) {
+    uint64_t ka = ((const mu_store_key_pair_t *)a)->key;
+    uint64_t kb = ((const mu_store_key_pair_t *)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+static size_t interp_search(const radix_ctx_t *r, size_t item_size,
+                            const uint8_t *base, size_t n,
+                            const uint8_t *key) {
+    // Map the bare key exactly as the keys embedded in the items.
+    radix_ctx_t bare = *r;
+    bare.key_offset = 0;
+    uint64_t target = radix_key(&bare, key);
+
+    // Invariant: the answer lies in [lo, hi].
+    size_t lo = 0, hi = n;
+    while (hi - lo > MU_STORE_INTERP_MIN_RANGE) {
+        uint64_t k_lo = radix_key(r, base + lo * item_size);
+        if (target <= k_lo) {
+            return lo;
+        }
+        uint64_t k_hi = radix_key(r, base + (hi - 1) * item_size);
+        if (target > k_hi) {
+            return hi;
+        }
+        // k_lo < target <= k_hi: estimate the position linearly.
+        size_t span = hi - 1 - lo;
+        size_t probe = lo + (size_t)((double)(target - k_lo) /
+                                     (double)(k_hi - k_lo) * (double)span);
+        if (probe > hi - 1) {
+            probe = hi - 1; // rounding
+        }
+        size_t before = hi - lo;
+        if (radix_key(r, base + probe * item_size) < target) {
+            lo = probe + 1;
+        } else {
+            hi = probe;
+        }
+        // A poor estimate (skewed keys) is followed by one bisection, which
+        // bounds the worst case at about twice the binary search's probes.
+        if (hi - lo > before / 2) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (radix_key(r, base + mid * item_size) < target) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (radix_key(r, base + mid * item_size) < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief Return the operand the comparison function expects for element `i`.
+ */
+static inline const void *search_elem(const search_ctx_t *s, size_t i) {
+    const uint8_t *slot = s->base + i * s->size;
+    return s->deref ? *(const void *const *)slot : (const void *)slot;
+}
+
+/**
+ * @brief Return the operand the comparison function expects for a query.
+ */
+static inline const void *search_query(const search_ctx_t *s,
+                                       const uint8_t *query) {
+    return s->deref ? *(const void *const *)query : (const void *)query;
+}
+
+/**
+ * @brief Plain binary search for the lower bound of `query`.
+ */
+static inline size_t lower_bound(const search_ctx_t *s, const void *query) {
+    size_t lo = 0, hi = s->count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (s->compare(query, search_elem(s, mid)) > 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief Lower bound of `query` in [from, count), galloping forward from
+ * `from`.  The caller guarantees the lower bound is not before `from`.
+ */
+static inline size_t gallop_lower_bound(const search_ctx_t *s,
+                                        const void *query, size_t from) {
+    size_t n = s->count;
+    if (from >= n || s->compare(query, search_elem(s, from)) <= 0) {
+        return from;
+    }
+    // base[from] < query.  Double the step until base[from + step] >= query
+    // (or the end is reached), then binary search the last interval.
+    size_t lo = from + 1; // first index not yet known to be < query
+    size_t step = 1;
+    size_t hi;
+    while (true) {
+        size_t probe = from + step;
+        if (probe >= n) {
+            hi = n;
+            break;
+        }
+        if (s->compare(query, search_elem(s, probe)) <= 0) {
+            hi = probe;
+            break;
+        }
+        lo = probe + 1;
+        step *= 2;
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (s->compare(query, search_elem(s, mid)) > 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static inline size_t search_from(const search_ctx_t *s, const void *query,
+                                 size_t hint) {
+    size_t n = s->count;
+    if (hint > n) {
+        hint = n;
+    }
+    if (hint < n && s->compare(query, search_elem(s, hint)) > 0) {
+        return gallop_lower_bound(s, query, hint + 1);
+    }
+    // base[hint] >= query (or hint is the end): gallop backwards, doubling
+    // the step until an element < query bounds the answer from below.
+    size_t hi = hint; // every element from hi on is >= query
+    size_t lo = 0;
+    size_t step = 1;
+    while (step <= hi) {
+        size_t probe = hi - step;
+        if (s->compare(query, search_elem(s, probe)) > 0) {
+            lo = probe + 1;
+            break;
+        }
+        hi = probe;
+        step *= 2;
+    }
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (s->compare(query, search_elem(s, mid)) > 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/**
+ * @brief Resolve up to MU_STORE_SEARCH_LANES queries with binary searches
+ * run in lockstep.
+ *
+ * Every lane halves its range on each step regardless of the comparison
+ * outcome, so all lanes take the same number of steps, and each lane's next
+ * probe is prefetched while the other lanes compare.
+ */
+static inline void search_lanes(const search_ctx_t *s,
+                                const uint8_t *queries, size_t query_size,
+                                size_t lanes, size_t *results) {
+    const void *q[MU_STORE_SEARCH_LANES];
+    size_t lo[MU_STORE_SEARCH_LANES];
+    size_t len = s->count;
+
+    for (size_t i = 0; i < lanes; i++) {
+        q[i] = search_query(s, queries + i * query_size);
+        lo[i] = 0;
+    }
+    // Invariant: each lane's answer lies in [lo, lo + len].
+    while (len > 1) {
+        size_t half = len / 2;
+        size_t next_half = (len - half) / 2;
+        for (size_t i = 0; i < lanes; i++) {
+            if (s->compare(q[i], search_elem(s, lo[i] + half - 1)) > 0) {
+                lo[i] += half;
+            }
+            if (next_half > 0) {
+                MU_STORE_PREFETCH(s->base + (lo[i] + next_half - 1) * s->size);
+            }
+        }
+        len -= half;
+    }
+    for (size_t i = 0; i < lanes; i++) {
+        size_t r = lo[i];
+        if (len == 1 && s->compare(q[i], search_elem(s, r)) > 0) {
+            r++;
+        }
+        results[i] = r;
+    }
+}
+
+static inline void search_many(const search_ctx_t *s,
+                               const uint8_t *queries, size_t query_size,
+                               size_t n, size_t *results) {
+    size_t i = 0;
+
+    // Merge-style walk for as long as the queries are ascending.
+    size_t from = 0;
+    for (; i < n; i++) {
+        const uint8_t *query = queries + i * query_size;
+        if (i > 0 && s->compare(search_query(s, query - query_size),
+                                search_query(s, query)) > 0) {
+            break;
+        }
+        from = gallop_lower_bound(s, search_query(s, query), from);
+        results[i] = from;
+    }
+
+    // Out-of-order remainder: independent searches, interleaved when the
+    // table is large enough for their cache misses to dominate.
+    if (s->count * s->size <= MU_STORE_SEARCH_LANES_MIN_BYTES) {
+        for (; i < n; i++) {
+            results[i] =
+                lower_bound(s, search_query(s, queries + i * query_size));
+        }
+        return;
+    }
+    for (; i < n; i += MU_STORE_SEARCH_LANES) {
+        size_t lanes = n - i < MU_STORE_SEARCH_LANES ? n - i
+                                                     : MU_STORE_SEARCH_LANES;
+        search_lanes(s, queries + i * query_size, query_size, lanes,
+                     results + i);
+    }
+}
+
+static void swap_1(void *a, void *b, size_t size) {
+    (void)size;
+    uint8_t t = *(uint8_t *)a;
+    *(uint8_t *)a = *(uint8_t *)b;
+    *(uint8_t *)b = t;
+}
+
+// memcpy to and from a fixed-size local compiles to a single unaligned load
+// or store, so these kernels need no alignment guarantees.
+static void swap_2(void *a, void *b, size_t size) {
+    (void)size;
+    uint16_t ta, tb;
+    memcpy(&ta, a, sizeof(ta));
+    memcpy(&tb, b, sizeof(tb));
+    memcpy(a, &tb, sizeof(tb));
+    memcpy(b, &ta, sizeof(ta));
+}
+
+static void swap_4(void *a, void *b, size_t size) {
+    (void)size;
+    uint32_t ta, tb;
+    memcpy(&ta, a, sizeof(ta));
+    memcpy(&tb, b, sizeof(tb));
+    memcpy(a, &tb, sizeof(tb));
+    memcpy(b, &ta, sizeof(ta));
+}
+
+static void swap_8(void *a, void *b, size_t size) {
+    (void)size;
+    uint64_t ta, tb;
+    memcpy(&ta, a, sizeof(ta));
+    memcpy(&tb, b, sizeof(tb));
+    memcpy(a, &tb, sizeof(tb));
+    memcpy(b, &ta, sizeof(ta));
+}
+
+static void swap_16(void *a, void *b, size_t size) {
+    (void)size;
+    uint64_t ta[2], tb[2];
+    memcpy(ta, a, sizeof(ta));
+    memcpy(tb, b, sizeof(tb));
+    memcpy(a, tb, sizeof(tb));
+    memcpy(b, ta, sizeof(ta));
+}
+
+/**
+ * @brief Swap arbitrary-sized items in fixed-size blocks.
+ *
+ * The 32-byte block loop is lowered to vector loads and stores by the
+ * compiler; the tail is finished a word and then a byte at a time.
+ */
+static void swap_blocks(void *a, void *b, size_t size) {
+    uint8_t *pa = (uint8_t *)a;
+    uint8_t *pb = (uint8_t *)b;
+
+    while (size >= MU_STORE_SWAP_BLOCK) {
+        uint8_t ta[MU_STORE_SWAP_BLOCK], tb[MU_STORE_SWAP_BLOCK];
+        memcpy(ta, pa, sizeof(ta));
+        memcpy(tb, pb, sizeof(tb));
+        memcpy(pa, tb, sizeof(tb));
+        memcpy(pb, ta, sizeof(ta));
+        pa += MU_STORE_SWAP_BLOCK;
+        pb += MU_STORE_SWAP_BLOCK;
+        size -= MU_STORE_SWAP_BLOCK;
+    }
+    while (size >= sizeof(uint64_t)) {
+        swap_8(pa, pb, sizeof(uint64_t));
+        pa += sizeof(uint64_t);
+        pb += sizeof(uint64_t);
+        size -= sizeof(uint64_t);
+    }
+    while (size > 0) {
+        swap_1(pa++, pb++, 1);
+        size--;
+    }
+}
+
+static void copy_1(void *dst, const void *src, size_t size) {
+    (void)size;
+    *(uint8_t *)dst = *(const uint8_t *)src;
+}
+
+static void copy_2(void *dst, const void *src, size_t size) {
+    (void)size;
+    memcpy(dst, src, sizeof(uint16_t));
+}
+
+static void copy_4(void *dst, const void *src, size_t size) {
+    (void)size;
+    memcpy(dst, src, sizeof(uint32_t));
+}
+
+static void copy_8(void *dst, const void *src, size_t size) {
+    (void)size;
+    memcpy(dst, src, sizeof(uint64_t));
+}
+
+static void copy_16(void *dst, const void *src, size_t size) {
+    (void)size;
+    memcpy(dst, src, 2 * sizeof(uint64_t));
+}
+
+static void copy_any(void *dst, const void *src, size_t size) {
+    memcpy(dst, src, size);
+}
+
+static swap_fn select_swap(size_t item_size) {
+    switch (item_size) {
+    case 1:
+        return swap_1;
+    case 2:
+        return swap_2;
+    case 4:
+        return swap_4;
+    case 8:
+        return swap_8;
+    case 16:
+        return swap_16;
+    default:
+        return swap_blocks;
+    }
+}
 
-        // Recursively heapify the affected sub-tree
-        heapify_pointers(arr, n, largest, compare);
+static copy_fn select_copy(size_t item_size) {
+    switch (item_size) {
+    case 1:
+        return copy_1;
+    case 2:
+        return copy_2;
+    case 4:
+        return copy_4;
+    case 8:
+        return copy_8;
+    case 16:
+        return copy_16;
+    default:
+        return copy_any;
     }
 }
 
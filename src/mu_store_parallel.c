@@ -0,0 +1,335 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_store_parallel.c
+ * @brief Implementation of the multithreaded merge sort.
+ *
+ * The sort runs in phases, each executed by the same number of workers:
+ *   1. SORT:  worker i sorts chunk i of the array with mu_store_sort().
+ *   2. MERGE: adjacent pairs of sorted runs are merged from `src` into
+ *             `dst`.  Worker i produces output positions [n*i/T, n*(i+1)/T)
+ *             of whichever merges overlap that slice, locating its inputs by
+ *             a binary search over the merge path ("co-rank").  Repeated
+ *             until a single run remains, swapping `src` and `dst`.
+ *   3. COPY:  if the result ended up in the scratch buffer, copy it back.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store_parallel.h"
+#include "mu_store.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h> // For uint8_t
+#include <string.h> // For memcpy
+
+// *****************************************************************************
+// Private types and definitions
+
+typedef enum {
+    PHASE_SORT,  /**< Sort each chunk in place */
+    PHASE_MERGE, /**< Merge pairs of runs from src to dst */
+    PHASE_COPY,  /**< Copy the result from scratch back to base */
+} psort_phase_t;
+
+/**
+ * @brief State shared by all workers of one parallel sort.
+ */
+typedef struct {
+    uint8_t *base;                /**< Array being sorted */
+    uint8_t *scratch;             /**< Caller's scratch buffer */
+    size_t count;                 /**< Number of items */
+    size_t item_size;             /**< Size of each item in bytes */
+    mu_store_compare_fn compare;  /**< Comparison function */
+    size_t n_workers;             /**< Workers per phase */
+    psort_phase_t phase;          /**< Current phase */
+    const uint8_t *src;           /**< Merge input */
+    uint8_t *dst;                 /**< Merge output */
+    size_t n_runs;                /**< Number of sorted runs in src */
+    size_t runs[MU_STORE_PARALLEL_MAX_THREADS + 1]; /**< Run boundaries */
+} psort_job_t;
+
+/**
+ * @brief Argument passed to each worker thread.
+ */
+typedef struct {
+    psort_job_t *job; /**< Shared job state */
+    size_t index;     /**< Worker number, 0..n_workers-1 */
+} psort_worker_t;
+
+// *****************************************************************************
+// Private static function declarations
+
+/**
+ * @brief Run the job's current phase on all workers and wait for them.
+ */
+static void run_phase(psort_job_t *job);
+
+/**
+ * @brief Thread entry point: perform worker `index`'s share of the phase.
+ */
+static void *worker_main(void *arg);
+
+/**
+ * @brief Produce output positions [k_begin, k_end) of the merge of the
+ * sorted runs a[0..la) and b[0..lb) into out.
+ */
+static void merge_slice(const psort_job_t *job, const uint8_t *a, size_t la,
+                        const uint8_t *b, size_t lb, uint8_t *out,
+                        size_t k_begin, size_t k_end);
+
+// *****************************************************************************
+// Public function definitions
+
+mu_store_err_t mu_store_parallel_sort(void *base, size_t item_count,
+                                      size_t item_size,
+                                      mu_store_compare_fn compare_fn,
+                                      void *scratch, size_t n_threads) {
+    if (!base || !compare_fn || !scratch || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+
+    size_t n_workers = n_threads;
+    if (n_workers > MU_STORE_PARALLEL_MAX_THREADS) {
+        n_workers = MU_STORE_PARALLEL_MAX_THREADS;
+    }
+    if (n_workers > item_count / MU_STORE_PARALLEL_MIN_CHUNK) {
+        n_workers = item_count / MU_STORE_PARALLEL_MIN_CHUNK;
+    }
+    if (n_workers <= 1) {
+        // Too small to be worth the threads.
+        return mu_store_sort(base, item_count, item_size, compare_fn);
+    }
+
+    psort_job_t job = {.base = (uint8_t *)base,
+                       .scratch = (uint8_t *)scratch,
+                       .count = item_count,
+                       .item_size = item_size,
+                       .compare = compare_fn,
+                       .n_workers = n_workers,
+                       .n_runs = n_workers};
+    for (size_t i = 0; i <= n_workers; i++) {
+        job.runs[i] = item_count * i / n_workers;
+    }
+
+    job.phase = PHASE_SORT;
+    run_phase(&job);
+
+    job.phase = PHASE_MERGE;
+    job.src = job.base;
+    job.dst = job.scratch;
+    while (job.n_runs > 1) {
+        run_phase(&job);
+        // Each pair of runs (and an unpaired last run) is now one run.
+        size_t merged = (job.n_runs + 1) / 2;
+        for (size_t i = 0; i < merged; i++) {
+            job.runs[i] = job.runs[2 * i];
+        }
+        job.runs[merged] = item_count;
+        job.n_runs = merged;
+        uint8_t *tmp = (uint8_t *)job.src;
+        job.src = job.dst;
+        job.dst = tmp;
+    }
+
+    if (job.src != job.base) {
+        job.phase = PHASE_COPY;
+        run_phase(&job);
+    }
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_parallel_psort(void **base, size_t item_count,
+                                       mu_store_compare_fn compare_fn,
+                                       void **scratch, size_t n_threads) {
+    return mu_store_parallel_sort(base, item_count, sizeof(void *),
+                                  compare_fn, scratch, n_threads);
+}
+
+mu_vec_err_t mu_vec_parallel_sort(mu_vec_t *v, mu_vec_compare_fn compare_fn,
+                                  void *scratch, size_t n_threads) {
+    if (!v || !compare_fn) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (v->count < 2) {
+        return MU_STORE_ERR_NONE; // Nothing to sort
+    }
+
+    return mu_store_parallel_sort(v->item_store, v->count, v->item_size,
+                                  compare_fn, scratch, n_threads);
+}
+
+mu_pvec_err_t mu_pvec_parallel_sort(mu_pvec_t *v,
+                                    mu_pvec_compare_fn compare_fn,
+                                    void **scratch, size_t n_threads) {
+    if (!v || !compare_fn) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (v->count < 2) {
+        return MU_STORE_ERR_NONE; // Nothing to sort
+    }
+
+    return mu_store_parallel_psort(v->item_store, v->count, compare_fn,
+                                   scratch, n_threads);
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static void run_phase(psort_job_t *job) {
+    pthread_t threads[MU_STORE_PARALLEL_MAX_THREADS];
+    bool started[MU_STORE_PARALLEL_MAX_THREADS];
+    psort_worker_t workers[MU_STORE_PARALLEL_MAX_THREADS];
+
+    for (size_t i = 0; i < job->n_workers; i++) {
+        workers[i].job = job;
+        workers[i].index = i;
+    }
+    for (size_t i = 1; i < job->n_workers; i++) {
+        started[i] =
+            pthread_create(&threads[i], NULL, worker_main, &workers[i]) == 0;
+    }
+
+    // The calling thread is worker 0, and also picks up the share of any
+    // worker whose thread could not be created.
+    worker_main(&workers[0]);
+    for (size_t i = 1; i < job->n_workers; i++) {
+        if (started[i]) {
+            pthread_join(threads[i], NULL);
+        } else {
+            worker_main(&workers[i]);
+        }
+    }
+}
+
+static void *worker_main(void *arg) {
+    const psort_worker_t *w = (const psort_worker_t *)arg;
+    const psort_job_t *job = w->job;
+    size_t size = job->item_size;
+    size_t slice_begin = job->count * w->index / job->n_workers;
+    size_t slice_end = job->count * (w->index + 1) / job->n_workers;
+
+    switch (job->phase) {
+    case PHASE_SORT: {
+        size_t lo = job->runs[w->index];
+        size_t hi = job->runs[w->index + 1];
+        mu_store_sort(job->base + lo * size, hi - lo, size, job->compare);
+    } break;
+
+    case PHASE_MERGE:
+        for (size_t r = 0; r < job->n_runs; r += 2) {
+            size_t lo = job->runs[r];
+            size_t mid = job->runs[r + 1];
+            size_t hi = r + 2 <= job->n_runs ? job->runs[r + 2] : mid;
+            if (hi <= slice_begin || lo >= slice_end) {
+                continue; // No overlap with this worker's slice
+            }
+            size_t k_begin = (slice_begin > lo ? slice_begin : lo) - lo;
+            size_t k_end = (slice_end < hi ? slice_end : hi) - lo;
+            merge_slice(job, job->src + lo * size, mid - lo,
+                        job->src + mid * size, hi - mid,
+                        job->dst + lo * size, k_begin, k_end);
+        }
+        break;
+
+    case PHASE_COPY:
+        memcpy(job->base + slice_begin * size,
+               job->scratch + slice_begin * size,
+               (slice_end - slice_begin) * size);
+        break;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Copy one item, with fixed-size copies for the common item sizes.
+ */
+static inline void copy_item(uint8_t *dst, const uint8_t *src, size_t size) {
+    switch (size) {
+    case 4:
+        memcpy(dst, src, 4);
+        break;
+    case 8:
+        memcpy(dst, src, 8);
+        break;
+    case 16:
+        memcpy(dst, src, 16);
+        break;
+    default:
+        memcpy(dst, src, size);
+        break;
+    }
+}
+
+/**
+ * @brief Return how many items of `a` precede output position `k` in the
+ * merge of a[0..la) and b[0..lb), where ties are taken from `a` first.
+ */
+static size_t co_rank(const psort_job_t *job, const uint8_t *a, size_t la,
+                      const uint8_t *b, size_t lb, size_t k) {
+    size_t size = job->item_size;
+    size_t lo = k > lb ? k - lb : 0;
+    size_t hi = k < la ? k : la;
+    while (lo < hi) {
+        size_t i = lo + (hi - lo) / 2;
+        size_t j = k - i; // >= 1 since i < hi <= k
+        if (job->compare(a + i * size, b + (j - 1) * size) <= 0) {
+            lo = i + 1; // a[i] is output before b[j-1]: take more of a
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+static void merge_slice(const psort_job_t *job, const uint8_t *a, size_t la,
+                        const uint8_t *b, size_t lb, uint8_t *out,
+                        size_t k_begin, size_t k_end) {
+    size_t size = job->item_size;
+    size_t i = co_rank(job, a, la, b, lb, k_begin);
+    size_t i_end = co_rank(job, a, la, b, lb, k_end);
+    size_t j = k_begin - i;
+    size_t j_end = k_end - i_end;
+    const uint8_t *pa = a + i * size, *ea = a + i_end * size;
+    const uint8_t *pb = b + j * size, *eb = b + j_end * size;
+    out += k_begin * size;
+
+    while (pa < ea && pb < eb) {
+        if (job->compare(pb, pa) < 0) {
+            copy_item(out, pb, size);
+            pb += size;
+        } else {
+            copy_item(out, pa, size);
+            pa += size;
+        }
+        out += size;
+    }
+    memcpy(out, pa, (size_t)(ea - pa));
+    out += ea - pa;
+    memcpy(out, pb, (size_t)(eb - pb));
+}
+
+// *****************************************************************************
+// End of file
@@ -0,0 +1,569 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file mu_store_set.c
+ * @brief Implementation of merge and set algebra over sorted arrays.
+ *
+ * All four binary operations share one merge loop (set_merge()), which
+ * differs only in which items each operation keeps.  The loop counts how
+ * many times in a row each input supplied the smaller item; after
+ * MU_STORE_SET_MIN_GALLOP wins it stops stepping one item at a time and
+ * gallops ahead to the end of the winning run, which it then copies as a
+ * block.
+ *
+ * The integer fast paths run a branch-free loop while both inputs and the
+ * output have room, then hand whatever remains (tails, or a result that
+ * overflowed `out`) to set_merge() with a built-in comparison function.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store_set.h"
+#include <stdbool.h>
+#include <stdint.h> // For uint8_t
+#include <string.h> // For memcpy
+
+// *****************************************************************************
+// Private types and definitions
+
+// Consecutive wins by one input before the merge starts galloping.
+#define MU_STORE_SET_MIN_GALLOP 7
+
+// The integer fast paths use the galloping merge when one input is more
+// than this many times longer than the other.
+#define MU_STORE_SET_SKEW_RATIO 32
+
+typedef enum {
+    SET_MERGE,        /**< Every item of both inputs */
+    SET_UNION,        /**< max(m, n) copies of each item */
+    SET_INTERSECTION, /**< min(m, n) copies of each item */
+    SET_DIFFERENCE,   /**< max(m - n, 0) copies of each item */
+} set_op_t;
+
+/**
+ * @brief State of one set operation.
+ */
+typedef struct {
+    size_t size;                 /**< Item size in bytes */
+    mu_store_compare_fn compare; /**< Comparison function */
+    uint8_t *out;                /**< Output buffer */
+    size_t capacity;             /**< Items `out` can hold */
+    size_t count;                /**< Items written so far */
+} set_ctx_t;
+
+// *****************************************************************************
+// Private static function declarations
+
+/**
+ * @brief Validate arguments and run `op` over a[0..a_count), b[0..b_count).
+ */
+static mu_store_err_t set_op(set_op_t op, const void *a, size_t a_count,
+                             const void *b, size_t b_count, size_t item_size,
+                             mu_store_compare_fn compare_fn, void *out,
+                             size_t out_capacity, size_t *out_count);
+
+/**
+ * @brief The galloping merge loop shared by all operations.
+ *
+ * @return false if the output overflowed.
+ */
+static bool set_merge(set_ctx_t *s, set_op_t op, const uint8_t *a, size_t na,
+                      const uint8_t *b, size_t nb);
+
+/**
+ * @brief Run `op` on two mu_vec_t into a third.
+ */
+static mu_vec_err_t vec_set_op(set_op_t op, const mu_vec_t *a,
+                               const mu_vec_t *b, mu_vec_compare_fn compare_fn,
+                               mu_vec_t *out);
+
+/**
+ * @brief Run `op` on two mu_pvec_t into a third.
+ */
+static mu_pvec_err_t pvec_set_op(set_op_t op, const mu_pvec_t *a,
+                                 const mu_pvec_t *b,
+                                 mu_pvec_compare_fn compare_fn,
+                                 mu_pvec_t *out);
+
+// *****************************************************************************
+// Public function definitions
+
+mu_store_err_t mu_store_merge(const void *a, size_t a_count, const void *b,
+                              size_t b_count, size_t item_size,
+                              mu_store_compare_fn compare_fn, void *out,
+                              size_t out_capacity, size_t *out_count) {
+    return set_op(SET_MERGE, a, a_count, b, b_count, item_size, compare_fn,
+                  out, out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_set_union(const void *a, size_t a_count,
+                                  const void *b, size_t b_count,
+                                  size_t item_size,
+                                  mu_store_compare_fn compare_fn, void *out,
+                                  size_t out_capacity, size_t *out_count) {
+    return set_op(SET_UNION, a, a_count, b, b_count, item_size, compare_fn,
+                  out, out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_set_intersection(const void *a, size_t a_count,
+                                         const void *b, size_t b_count,
+                                         size_t item_size,
+                                         mu_store_compare_fn compare_fn,
+                                         void *out, size_t out_capacity,
+                                         size_t *out_count) {
+    return set_op(SET_INTERSECTION, a, a_count, b, b_count, item_size,
+                  compare_fn, out, out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_set_difference(const void *a, size_t a_count,
+                                       const void *b, size_t b_count,
+                                       size_t item_size,
+                                       mu_store_compare_fn compare_fn,
+                                       void *out, size_t out_capacity,
+                                       size_t *out_count) {
+    return set_op(SET_DIFFERENCE, a, a_count, b, b_count, item_size,
+                  compare_fn, out, out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_unique(void *base, size_t item_count,
+                               size_t item_size,
+                               mu_store_compare_fn compare_fn,
+                               size_t *out_count) {
+    if (!compare_fn || !out_count || item_size == 0 ||
+        (item_count > 0 && !base))
+        return MU_STORE_ERR_PARAM;
+    if (item_count == 0) {
+        *out_count = 0;
+        return MU_STORE_ERR_NONE;
+    }
+
+    uint8_t *items = (uint8_t *)base;
+    uint8_t *kept = items; // Last item kept
+    for (uint8_t *p = items + item_size, *end = items + item_count * item_size;
+         p < end; p += item_size) {
+        if (compare_fn(kept, p) != 0) {
+            kept += item_size;
+            if (kept != p) {
+                memcpy(kept, p, item_size);
+            }
+        }
+    }
+    *out_count = (size_t)(kept - items) / item_size + 1;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_store_err_t mu_store_pmerge(void *const *a, size_t a_count, void *const *b,
+                               size_t b_count, mu_store_compare_fn compare_fn,
+                               void **out, size_t out_capacity,
+                               size_t *out_count) {
+    return set_op(SET_MERGE, a, a_count, b, b_count, sizeof(void *),
+                  compare_fn, out, out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_pset_union(void *const *a, size_t a_count,
+                                   void *const *b, size_t b_count,
+                                   mu_store_compare_fn compare_fn, void **out,
+                                   size_t out_capacity, size_t *out_count) {
+    return set_op(SET_UNION, a, a_count, b, b_count, sizeof(void *),
+                  compare_fn, out, out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_pset_intersection(void *const *a, size_t a_count,
+                                          void *const *b, size_t b_count,
+                                          mu_store_compare_fn compare_fn,
+                                          void **out, size_t out_capacity,
+                                          size_t *out_count) {
+    return set_op(SET_INTERSECTION, a, a_count, b, b_count, sizeof(void *),
+                  compare_fn, out, out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_pset_difference(void *const *a, size_t a_count,
+                                        void *const *b, size_t b_count,
+                                        mu_store_compare_fn compare_fn,
+                                        void **out, size_t out_capacity,
+                                        size_t *out_count) {
+    return set_op(SET_DIFFERENCE, a, a_count, b, b_count, sizeof(void *),
+                  compare_fn, out, out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_punique(void **base, size_t item_count,
+                                mu_store_compare_fn compare_fn,
+                                size_t *out_count) {
+    return mu_store_unique(base, item_count, sizeof(void *), compare_fn,
+                           out_count);
+}
+
+/**
+ * @brief Define the comparison function and branch-free set operation for
+ * arrays of unsigned integer type `T`, suffixed `SUFFIX`.
+ */
+#define MU_STORE_SET_DEFINE_TYPED(SUFFIX, T)                                   \
+    static int compare_##SUFFIX(const void *a, const void *b) {                \
+        T x = *(const T *)a;                                                   \
+        T y = *(const T *)b;                                                   \
+        return (x > y) - (x < y);                                              \
+    }                                                                          \
+                                                                               \
+    static mu_store_err_t set_op_##SUFFIX(set_op_t op, const T *a, size_t na,  \
+                                          const T *b, size_t nb, T *out,       \
+                                          size_t cap, size_t *out_count) {     \
+        if (!out_count || (na > 0 && !a) || (nb > 0 && !b) ||                  \
+            (cap > 0 && !out))                                                 \
+            return MU_STORE_ERR_PARAM;                                         \
+        size_t i = 0, j = 0, k = 0;                                            \
+        size_t shorter = na < nb ? na : nb;                                    \
+        size_t longer = na < nb ? nb : na;                                     \
+        if (shorter > longer / MU_STORE_SET_SKEW_RATIO) {                      \
+            switch (op) {                                                      \
+            case SET_MERGE:                                                    \
+                while (i < na && j < nb && k < cap) {                          \
+                    T x = a[i], y = b[j];                                      \
+                    bool take_b = y < x;                                       \
+                    out[k++] = take_b ? y : x;                                 \
+                    i += !take_b;                                              \
+                    j += take_b;                                               \
+                }                                                              \
+                break;                                                         \
+            case SET_UNION:                                                    \
+                while (i < na && j < nb && k < cap) {                          \
+                    T x = a[i], y = b[j];                                      \
+                    out[k++] = x <= y ? x : y;                                 \
+                    i += x <= y;                                               \
+                    j += y <= x;                                               \
+                }                                                              \
+                break;                                                         \
+            case SET_INTERSECTION:                                             \
+                while (i < na && j < nb && k < cap) {                          \
+                    T x = a[i], y = b[j];                                      \
+                    out[k] = x;                                                \
+                    k += x == y;                                               \
+                    i += x <= y;                                               \
+                    j += y <= x;                                               \
+                }                                                              \
+                break;                                                         \
+            case SET_DIFFERENCE:                                               \
+                while (i < na && j < nb && k < cap) {                          \
+                    T x = a[i], y = b[j];                                      \
+                    out[k] = x;                                                \
+                    k += x < y;                                                \
+                    i += x <= y;                                               \
+                    j += y <= x;                                               \
+                }                                                              \
+                break;                                                         \
+            }                                                                  \
+        }                                                                      \
+        /* Tails, skewed inputs and overflow go through the general loop. */   \
+        set_ctx_t s = {.size = sizeof(T),                                      \
+                       .compare = compare_##SUFFIX,                            \
+                       .out = (uint8_t *)(out + k),                            \
+                       .capacity = cap - k,                                    \
+                       .count = 0};                                            \
+        bool fits = set_merge(&s, op, (const uint8_t *)(a + i), na - i,        \
+                              (const uint8_t *)(b + j), nb - j);               \
+        *out_count = k + s.count;                                              \
+        return fits ? MU_STORE_ERR_NONE : MU_STORE_ERR_FULL;                   \
+    }
+
+MU_STORE_SET_DEFINE_TYPED(u32, uint32_t)
+MU_STORE_SET_DEFINE_TYPED(u64, uint64_t)
+
+mu_store_err_t mu_store_merge_u32(const uint32_t *a, size_t a_count,
+                                  const uint32_t *b, size_t b_count,
+                                  uint32_t *out, size_t out_capacity,
+                                  size_t *out_count) {
+    return set_op_u32(SET_MERGE, a, a_count, b, b_count, out, out_capacity,
+                      out_count);
+}
+
+mu_store_err_t mu_store_set_union_u32(const uint32_t *a, size_t a_count,
+                                      const uint32_t *b, size_t b_count,
+                                      uint32_t *out, size_t out_capacity,
+                                      size_t *out_count) {
+    return set_op_u32(SET_UNION, a, a_count, b, b_count, out, out_capacity,
+                      out_count);
+}
+
+mu_store_err_t mu_store_set_intersection_u32(const uint32_t *a, size_t a_count,
+                                             const uint32_t *b, size_t b_count,
+                                             uint32_t *out, size_t out_capacity,
+                                             size_t *out_count) {
+    return set_op_u32(SET_INTERSECTION, a, a_count, b, b_count, out,
+                      out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_set_difference_u32(const uint32_t *a, size_t a_count,
+                                           const uint32_t *b, size_t b_count,
+                                           uint32_t *out, size_t out_capacity,
+                                           size_t *out_count) {
+    return set_op_u32(SET_DIFFERENCE, a, a_count, b, b_count, out,
+                      out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_merge_u64(const uint64_t *a, size_t a_count,
+                                  const uint64_t *b, size_t b_count,
+                                  uint64_t *out, size_t out_capacity,
+                                  size_t *out_count) {
+    return set_op_u64(SET_MERGE, a, a_count, b, b_count, out, out_capacity,
+                      out_count);
+}
+
+mu_store_err_t mu_store_set_union_u64(const uint64_t *a, size_t a_count,
+                                      const uint64_t *b, size_t b_count,
+                                      uint64_t *out, size_t out_capacity,
+                                      size_t *out_count) {
+    return set_op_u64(SET_UNION, a, a_count, b, b_count, out, out_capacity,
+                      out_count);
+}
+
+mu_store_err_t mu_store_set_intersection_u64(const uint64_t *a, size_t a_count,
+                                             const uint64_t *b, size_t b_count,
+                                             uint64_t *out, size_t out_capacity,
+                                             size_t *out_count) {
+    return set_op_u64(SET_INTERSECTION, a, a_count, b, b_count, out,
+                      out_capacity, out_count);
+}
+
+mu_store_err_t mu_store_set_difference_u64(const uint64_t *a, size_t a_count,
+                                           const uint64_t *b, size_t b_count,
+                                           uint64_t *out, size_t out_capacity,
+                                           size_t *out_count) {
+    return set_op_u64(SET_DIFFERENCE, a, a_count, b, b_count, out,
+                      out_capacity, out_count);
+}
+
+mu_vec_err_t mu_vec_merge(const mu_vec_t *a, const mu_vec_t *b,
+                          mu_vec_compare_fn compare_fn, mu_vec_t *out) {
+    return vec_set_op(SET_MERGE, a, b, compare_fn, out);
+}
+
+mu_vec_err_t mu_vec_set_union(const mu_vec_t *a, const mu_vec_t *b,
+                              mu_vec_compare_fn compare_fn, mu_vec_t *out) {
+    return vec_set_op(SET_UNION, a, b, compare_fn, out);
+}
+
+mu_vec_err_t mu_vec_set_intersection(const mu_vec_t *a, const mu_vec_t *b,
+                                     mu_vec_compare_fn compare_fn,
+                                     mu_vec_t *out) {
+    return vec_set_op(SET_INTERSECTION, a, b, compare_fn, out);
+}
+
+mu_vec_err_t mu_vec_set_difference(const mu_vec_t *a, const mu_vec_t *b,
+                                   mu_vec_compare_fn compare_fn,
+                                   mu_vec_t *out) {
+    return vec_set_op(SET_DIFFERENCE, a, b, compare_fn, out);
+}
+
+mu_vec_err_t mu_vec_unique(mu_vec_t *v, mu_vec_compare_fn compare_fn) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_unique(v->item_store, v->count, v->item_size, compare_fn,
+                           &v->count);
+}
+
+mu_pvec_err_t mu_pvec_merge(const mu_pvec_t *a, const mu_pvec_t *b,
+                            mu_pvec_compare_fn compare_fn, mu_pvec_t *out) {
+    return pvec_set_op(SET_MERGE, a, b, compare_fn, out);
+}
+
+mu_pvec_err_t mu_pvec_set_union(const mu_pvec_t *a, const mu_pvec_t *b,
+                                mu_pvec_compare_fn compare_fn,
+                                mu_pvec_t *out) {
+    return pvec_set_op(SET_UNION, a, b, compare_fn, out);
+}
+
+mu_pvec_err_t mu_pvec_set_intersection(const mu_pvec_t *a, const mu_pvec_t *b,
+                                       mu_pvec_compare_fn compare_fn,
+                                       mu_pvec_t *out) {
+    return pvec_set_op(SET_INTERSECTION, a, b, compare_fn, out);
+}
+
+mu_pvec_err_t mu_pvec_set_difference(const mu_pvec_t *a, const mu_pvec_t *b,
+                                     mu_pvec_compare_fn compare_fn,
+                                     mu_pvec_t *out) {
+    return pvec_set_op(SET_DIFFERENCE, a, b, compare_fn, out);
+}
+
+mu_pvec_err_t mu_pvec_unique(mu_pvec_t *v, mu_pvec_compare_fn compare_fn) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_punique(v->item_store, v->count, compare_fn, &v->count);
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static mu_store_err_t set_op(set_op_t op, const void *a, size_t a_count,
+                             const void *b, size_t b_count, size_t item_size,
+                             mu_store_compare_fn compare_fn, void *out,
+                             size_t out_capacity, size_t *out_count) {
+    if (!compare_fn || !out_count || item_size == 0)
+        return MU_STORE_ERR_PARAM;
+    if ((a_count > 0 && !a) || (b_count > 0 && !b) ||
+        (out_capacity > 0 && !out))
+        return MU_STORE_ERR_PARAM;
+
+    set_ctx_t s = {.size = item_size,
+                   .compare = compare_fn,
+                   .out = (uint8_t *)out,
+                   .capacity = out_capacity,
+                   .count = 0};
+    bool fits = set_merge(&s, op, (const uint8_t *)a, a_count,
+                          (const uint8_t *)b, b_count);
+    *out_count = s.count;
+    return fits ? MU_STORE_ERR_NONE : MU_STORE_ERR_FULL;
+}
+
+/**
+ * @brief Append `n` items from `src` to the output, as many as fit.
+ *
+ * @return false if some did not fit.
+ */
+static inline bool emit(set_ctx_t *s, const uint8_t *src, size_t n) {
+    size_t room = s->capacity - s->count;
+    size_t take = n < room ? n : room;
+    if (take > 0) {
+        memcpy(s->out + s->count * s->size, src, take * s->size);
+        s->count += take;
+    }
+    return take == n;
+}
+
+/**
+ * @brief Return the first index in (lo, n] whose item is not less than
+ * `key`, given that base[lo] is less than `key`.
+ *
+ * Probes lo + 1, lo + 3, lo + 7, ... and then binary searches the last gap,
+ * so the cost is O(log d) for an answer d items past `lo`.
+ */
+static size_t gallop_lower(const set_ctx_t *s, const uint8_t *base, size_t lo,
+                           size_t n, const void *key) {
+    size_t below = lo; // base[below] < key
+    size_t offset = 1;
+    while (lo + offset < n &&
+           s->compare(base + (lo + offset) * s->size, key) < 0) {
+        below = lo + offset;
+        if (offset > (n - lo) / 2) {
+            offset = n - lo; // Next probe would be past the end
+            break;
+        }
+        offset = offset * 2 + 1;
+    }
+    size_t hi = lo + offset < n ? lo + offset : n;
+    size_t first = below + 1;
+    while (first < hi) {
+        size_t mid = first + (hi - first) / 2;
+        if (s->compare(base + mid * s->size, key) < 0) {
+            first = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return first;
+}
+
+static bool set_merge(set_ctx_t *s, set_op_t op, const uint8_t *a, size_t na,
+                      const uint8_t *b, size_t nb) {
+    size_t size = s->size;
+    bool keep_a = op != SET_INTERSECTION; // Keep items only in a
+    bool keep_b = op == SET_MERGE || op == SET_UNION; // Keep items only in b
+    size_t i = 0, j = 0;
+    int a_wins = 0, b_wins = 0;
+
+    while (i < na && j < nb) {
+        const uint8_t *pa = a + i * size;
+        const uint8_t *pb = b + j * size;
+        int c = s->compare(pa, pb);
+        if (c < 0) {
+            // a[i..k) precede b[j].
+            size_t k = ++a_wins >= MU_STORE_SET_MIN_GALLOP
+                           ? gallop_lower(s, a, i, na, pb)
+                           : i + 1;
+            b_wins = 0;
+            if (keep_a && !emit(s, pa, k - i)) {
+                return false;
+            }
+            i = k;
+        } else if (c > 0) {
+            // b[j..k) precede a[i].
+            size_t k = ++b_wins >= MU_STORE_SET_MIN_GALLOP
+                           ? gallop_lower(s, b, j, nb, pa)
+                           : j + 1;
+            a_wins = 0;
+            if (keep_b && !emit(s, pb, k - j)) {
+                return false;
+            }
+            j = k;
+        } else {
+            a_wins = b_wins = 0;
+            if (op != SET_DIFFERENCE && !emit(s, pa, 1)) {
+                return false;
+            }
+            i++;
+            if (op != SET_MERGE) {
+                j++; // The match consumes one item of b
+            }
+        }
+    }
+    if (keep_a && !emit(s, a + i * size, na - i)) {
+        return false;
+    }
+    return !keep_b || emit(s, b + j * size, nb - j);
+}
+
+static mu_vec_err_t vec_set_op(set_op_t op, const mu_vec_t *a,
+                               const mu_vec_t *b, mu_vec_compare_fn compare_fn,
+                               mu_vec_t *out) {
+    if (!a || !b || !out || out == a || out == b) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (a->item_size != out->item_size || b->item_size != out->item_size) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return set_op(op, a->item_store, a->count, b->item_store, b->count,
+                  out->item_size, compare_fn, out->item_store, out->capacity,
+                  &out->count);
+}
+
+static mu_pvec_err_t pvec_set_op(set_op_t op, const mu_pvec_t *a,
+                                 const mu_pvec_t *b,
+                                 mu_pvec_compare_fn compare_fn,
+                                 mu_pvec_t *out) {
+    if (!a || !b || !out || out == a || out == b) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return set_op(op, a->item_store, a->count, b->item_store, b->count,
+                  sizeof(void *), compare_fn, out->item_store, out->capacity,
+                  &out->count);
+}
+
+// *****************************************************************************
+// End of file
@@ -56,6 +56,28 @@ static inline void *get_item_address(const mu_vec_t *v, size_t index) {
     return (uint8_t *)v->item_store + index * v->item_size;
 }
 
+/**
+ * @brief Find the end of the run of items equal to `item` that starts at `lo`.
+ *
+ * Only searches [lo..count), since `lo` is already known to be the lower
+ * bound of `item`.
+ */
+static size_t upper_bound_from(const mu_vec_t *v, size_t lo,
+                               mu_vec_compare_fn cmp, const void *item);
+
+/**
+ * @brief Apply a sorted-insert policy, given the lower bound `lo` of `item`.
+ */
+static mu_vec_err_t sorted_insert(mu_vec_t *v, const void *item,
+                                  mu_vec_compare_fn cmp,
+                                  mu_vec_insert_policy_t policy, size_t lo);
+
+/**
+ * @brief Insert `item` at `index` after checking for a full vector.
+ */
+static mu_vec_err_t sorted_insert_at(mu_vec_t *v, size_t index,
+                                     const void *item);
+
 // *****************************************************************************
 // Public function definitions
 
@@ -111,6 +133,35 @@ mu_vec_err_t mu_vec_ref(const mu_vec_t *v, size_t index, void *item_out) {
     return MU_STORE_ERR_NONE;
 }
 
+void *mu_vec_at(const mu_vec_t *v, size_t index) {
+    if (!v || index >= v->count) {
+        return NULL;
+    }
+    return get_item_address(v, index);
+}
+
+void *mu_vec_data(const mu_vec_t *v) { return v ? v->item_store : NULL; }
+
+void *mu_vec_emplace_back(mu_vec_t *v) {
+    if (!v || v->count >= v->capacity) {
+        return NULL;
+    }
+    return get_item_address(v, v->count++);
+}
+
+void *mu_vec_emplace_at(mu_vec_t *v, size_t index) {
+    if (!v || v->count >= v->capacity || index > v->count) {
+        return NULL;
+    }
+
+    void *slot = get_item_address(v, index);
+    // Move existing elements to the right to open the gap
+    memmove((uint8_t *)slot + v->item_size, slot,
+            (v->count - index) * v->item_size);
+    v->count++;
+    return slot;
+}
+
 mu_vec_err_t mu_vec_insert(mu_vec_t *v, size_t index, const void *item) {
     if (!v || !item) {
         return MU_STORE_ERR_PARAM;
@@ -178,6 +229,51 @@ mu_vec_err_t mu_vec_delete(mu_vec_t *v, size_t index, void *item_out) {
     return MU_STORE_ERR_NONE;
 }
 
+mu_vec_err_t mu_vec_swap_remove(mu_vec_t *v, size_t index, void *item_out) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (index >= v->count) {
+        return MU_STORE_ERR_INDEX;
+    }
+
+    void *hole = get_item_address(v, index);
+    if (item_out) {
+        memcpy(item_out, hole, v->item_size);
+    }
+    v->count--;
+    if (index < v->count) {
+        memcpy(hole, get_item_address(v, v->count), v->item_size);
+    }
+    return MU_STORE_ERR_NONE;
+}
+
+mu_vec_err_t mu_vec_swap_remove_indices(mu_vec_t *v, const size_t *indices,
+                                        size_t n, void *items_out) {
+    if (!v || (!indices && n > 0)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    for (size_t j = 0; j < n; j++) {
+        if (indices[j] >= v->count || (j > 0 && indices[j] <= indices[j - 1])) {
+            return MU_STORE_ERR_INDEX;
+        }
+    }
+
+    // Highest index first: the last item is never one still to be removed.
+    for (size_t j = n; j-- > 0;) {
+        void *hole = get_item_address(v, indices[j]);
+        if (items_out) {
+            memcpy((uint8_t *)items_out + j * v->item_size, hole,
+                   v->item_size);
+        }
+        v->count--;
+        if (indices[j] < v->count) {
+            memcpy(hole, get_item_address(v, v->count), v->item_size);
+        }
+    }
+    return MU_STORE_ERR_NONE;
+}
+
 mu_vec_err_t mu_vec_replace(mu_vec_t *v, size_t index, const void *item_in) {
     if (!v || !item_in) {
         return MU_STORE_ERR_PARAM;
@@ -261,13 +357,88 @@ mu_vec_err_t mu_vec_peek(const mu_vec_t *v, void *item_out) {
     return mu_vec_ref((mu_vec_t *)v, count - 1, item_out);
 }
 
+mu_vec_err_t mu_vec_push_n(mu_vec_t *v, const void *items, size_t n) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+    return mu_vec_replace_range(v, v->count, 0, items, n);
+}
+
+mu_vec_err_t mu_vec_insert_range(mu_vec_t *v, size_t index, const void *items,
+                                 size_t n) {
+    return mu_vec_replace_range(v, index, 0, items, n);
+}
+
+mu_vec_err_t mu_vec_delete_range(mu_vec_t *v, size_t index, size_t n,
+                                 void *items_out) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (items_out) {
+        mu_vec_err_t err = mu_vec_copy_out_range(v, index, n, items_out);
+        if (err != MU_STORE_ERR_NONE) {
+            return err;
+        }
+    }
+    return mu_vec_replace_range(v, index, n, NULL, 0);
+}
+
+mu_vec_err_t mu_vec_replace_range(mu_vec_t *v, size_t index, size_t n_old,
+                                  const void *items, size_t n_new) {
+    if (!v || (!items && n_new > 0)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (index > v->count || n_old > v->count - index) {
+        return MU_STORE_ERR_INDEX;
+    }
+    if (n_new > n_old && n_new - n_old > v->capacity - v->count) {
+        return MU_STORE_ERR_FULL;
+    }
+
+    uint8_t *at = get_item_address(v, index);
+    size_t tail = v->count - index - n_old;
+    // Move the tail once, directly to its final position
+    if (n_new != n_old && tail > 0) {
+        memmove(at + n_new * v->item_size, at + n_old * v->item_size,
+                tail * v->item_size);
+    }
+    if (n_new > 0) {
+        memcpy(at, items, n_new * v->item_size);
+    }
+    v->count = v->count - n_old + n_new;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_vec_err_t mu_vec_copy_out_range(const mu_vec_t *v, size_t index, size_t n,
+                                   void *items_out) {
+    if (!v || (!items_out && n > 0)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (index > v->count || n > v->count - index) {
+        return MU_STORE_ERR_INDEX;
+    }
+    if (n > 0) {
+        memcpy(items_out, get_item_address(v, index), n * v->item_size);
+    }
+    return MU_STORE_ERR_NONE;
+}
+
 mu_vec_err_t mu_vec_find(const mu_vec_t *v, mu_vec_find_fn find_fn,
                          const void *arg, size_t *index_out) {
+    return mu_vec_find_from(v, 0, find_fn, arg, index_out);
+}
+
+mu_vec_err_t mu_vec_find_from(const mu_vec_t *v, size_t start,
+                              mu_vec_find_fn find_fn, const void *arg,
+                              size_t *index_out) {
     if (!v || !find_fn || !index_out) {
         return MU_STORE_ERR_PARAM;
     }
+    if (start > v->count) {
+        return MU_STORE_ERR_INDEX;
+    }
 
-    for (size_t i = 0; i < v->count; ++i) {
+    for (size_t i = start; i < v->count; ++i) {
         void *item_address = get_item_address(v, i);
         if (!item_address)
             return MU_STORE_ERR_INTERNAL; // Should not happen
@@ -280,6 +451,61 @@ mu_vec_err_t mu_vec_find(const mu_vec_t *v, mu_vec_find_fn find_fn,
     return MU_STORE_ERR_NOTFOUND;
 }
 
+mu_vec_err_t mu_vec_find_all(const mu_vec_t *v, mu_vec_find_fn find_fn,
+                             const void *arg, size_t *indices,
+                             size_t max_indices, size_t *n_found) {
+    return mu_vec_find_all_from(v, 0, find_fn, arg, indices, max_indices,
+                                n_found);
+}
+
+mu_vec_err_t mu_vec_find_all_from(const mu_vec_t *v, size_t start,
+                                  mu_vec_find_fn find_fn, const void *arg,
+                                  size_t *indices, size_t max_indices,
+                                  size_t *n_found) {
+    if (!v || !find_fn || !n_found || (!indices && max_indices > 0)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (start > v->count) {
+        return MU_STORE_ERR_INDEX;
+    }
+
+    size_t found = 0;
+    uint8_t *item = get_item_address(v, start);
+    for (size_t i = start; i < v->count; ++i, item += v->item_size) {
+        if (find_fn(item, arg)) {
+            if (found == max_indices) {
+                *n_found = found;
+                return MU_STORE_ERR_FULL;
+            }
+            indices[found++] = i;
+        }
+    }
+    *n_found = found;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_vec_err_t mu_vec_find_all_vec(const mu_vec_t *v, mu_vec_find_fn find_fn,
+                                 const void *arg, mu_vec_t *out) {
+    if (!v || !find_fn || !out || out->item_size != sizeof(size_t)) {
+        return MU_STORE_ERR_PARAM;
+    }
+    // The indices must not be written over the items being searched.
+    uintptr_t items = (uintptr_t)v->item_store;
+    uintptr_t slots = (uintptr_t)out->item_store;
+    if (slots < items + v->count * v->item_size &&
+        items < slots + out->capacity * sizeof(size_t)) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    // Fill the free tail of `out` directly, then account for it.
+    size_t n_found;
+    mu_vec_err_t err =
+        mu_vec_find_all(v, find_fn, arg, (size_t *)out->item_store + out->count,
+                        out->capacity - out->count, &n_found);
+    out->count += n_found;
+    return err;
+}
+
 mu_vec_err_t mu_vec_rfind(const mu_vec_t *v, mu_vec_find_fn find_fn,
                           const void *arg, size_t *index_out) {
     if (!v || !find_fn || !index_out) {
@@ -301,6 +527,68 @@ mu_vec_err_t mu_vec_rfind(const mu_vec_t *v, mu_vec_find_fn find_fn,
     return MU_STORE_ERR_NOTFOUND;
 }
 
+mu_vec_err_t mu_vec_retain(mu_vec_t *v, mu_vec_find_fn keep_fn,
+                           const void *arg) {
+    if (!v || !keep_fn) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    // Move each run of kept elements [run, i) down to `kept` in one memmove
+    // when the run ends.  keep_fn is called exactly once per element.
+    size_t kept = 0;
+    size_t run = 0;
+    for (size_t i = 0; i <= v->count; i++) {
+        if (i < v->count && keep_fn(get_item_address(v, i), arg)) {
+            continue; // Extend the current run
+        }
+        if (i > run) {
+            if (run != kept) {
+                memmove(get_item_address(v, kept), get_item_address(v, run),
+                        (i - run) * v->item_size);
+            }
+            kept += i - run;
+        }
+        run = i + 1;
+    }
+    v->count = kept;
+    return MU_STORE_ERR_NONE;
+}
+
+mu_vec_err_t mu_vec_find_eq(const mu_vec_t *v, size_t field_offset,
+                            size_t field_width, const void *value,
+                            size_t *index_out) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_find_eq(v->item_store, v->count, v->item_size,
+                            field_offset, field_width, value, index_out);
+}
+
+mu_vec_err_t mu_vec_count_eq(const mu_vec_t *v, size_t field_offset,
+                             size_t field_width, const void *value,
+                             size_t *count_out) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_count_eq(v->item_store, v->count, v->item_size,
+                             field_offset, field_width, value, count_out);
+}
+
+mu_vec_err_t mu_vec_find_range(const mu_vec_t *v, size_t key_offset,
+                               size_t key_width, mu_store_radix_flags_t flags,
+                               const void *lo, const void *hi,
+                               size_t *index_out) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_find_range(v->item_store, v->count, v->item_size,
+                               key_offset, key_width, flags, lo, hi,
+                               index_out);
+}
+
 mu_vec_err_t mu_vec_sort(mu_vec_t *v, mu_vec_compare_fn compare_fn) {
     if (!v || !compare_fn) {
         return MU_STORE_ERR_PARAM;
@@ -319,6 +607,110 @@ mu_vec_err_t mu_vec_sort(mu_vec_t *v, mu_vec_compare_fn compare_fn) {
     return store_err;
 }
 
+mu_vec_err_t mu_vec_stable_sort(mu_vec_t *v, mu_vec_compare_fn compare_fn,
+                                void *scratch, size_t scratch_count) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    // mu_store validates every argument before its empty-input shortcut.
+    return mu_store_stable_sort(v->item_store, v->count, v->item_size,
+                                compare_fn, scratch, scratch_count);
+}
+
+mu_vec_err_t mu_vec_radix_sort(mu_vec_t *v, size_t key_offset,
+                               size_t key_width, mu_store_radix_flags_t flags,
+                               void *scratch) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    // mu_store validates every argument before its empty-input shortcut.
+    return mu_store_radix_sort(v->item_store, v->count, v->item_size,
+                               key_offset, key_width, flags, scratch);
+}
+
+mu_vec_err_t mu_vec_select(mu_vec_t *v, size_t nth,
+                           mu_vec_compare_fn compare_fn) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_select(v->item_store, v->count, v->item_size, nth,
+                           compare_fn);
+}
+
+mu_vec_err_t mu_vec_partial_sort(mu_vec_t *v, size_t k,
+                                 mu_vec_compare_fn compare_fn) {
+    if (!v || !compare_fn) {
+        return MU_STORE_ERR_PARAM;
+    }
+    if (v->count < 2) {
+        return MU_STORE_ERR_NONE; // Nothing to sort
+    }
+
+    return mu_store_partial_sort(v->item_store, v->count, v->item_size, k,
+                                 compare_fn);
+}
+
+mu_vec_err_t mu_vec_topk(const mu_vec_t *v, size_t k,
+                         mu_vec_compare_fn compare_fn, void *out,
+                         size_t *n_out) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    mu_store_err_t err = mu_store_topk(v->item_store, v->count, v->item_size,
+                                       k, compare_fn, out);
+    if (err == MU_STORE_ERR_NONE && n_out) {
+        *n_out = k < v->count ? k : v->count;
+    }
+    return err;
+}
+
+mu_vec_err_t mu_vec_argsort(const mu_vec_t *v, mu_vec_compare_fn compare_fn,
+                            void *indices, size_t index_size) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_argsort(v->item_store, v->count, v->item_size, compare_fn,
+                            indices, index_size);
+}
+
+mu_vec_err_t mu_vec_apply_permutation(mu_vec_t *v, void *perm,
+                                      size_t index_size) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_apply_permutation(v->item_store, v->count, v->item_size,
+                                      perm, index_size);
+}
+
+mu_vec_err_t mu_vec_partition(mu_vec_t *v, mu_vec_find_fn pred_fn,
+                              const void *arg, size_t *split) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    return mu_store_partition(v->item_store, v->count, v->item_size, pred_fn,
+                              arg, split);
+}
+
+mu_vec_err_t mu_vec_stable_partition(mu_vec_t *v, mu_vec_find_fn pred_fn,
+                                     const void *arg, void *scratch,
+                                     size_t scratch_count, size_t *split) {
+    if (!v) {
+        return MU_STORE_ERR_PARAM;
+    }
+
+    // mu_store validates every argument before its empty-input shortcut.
+    return mu_store_stable_partition(v->item_store, v->count, v->item_size,
+                                     pred_fn, arg, scratch, scratch_count,
+                                     split);
+}
+
 mu_vec_err_t mu_vec_reverse(mu_vec_t *v) {
     if (!v) {
         return MU_STORE_ERR_PARAM;
@@ -344,149 +736,122 @@ mu_vec_err_t mu_vec_reverse(mu_vec_t *v) {
     return MU_STORE_ERR_NONE;
 }
 
-/**
- * @brief Inserts or updates an element in a sorted mu_vec according to policy.
- *
- * Performs a single linear scan to locate any existing “equal” elements (cmp ==
- * 0), then:
- *   - For update‐only policies (MU_STORE_UPDATE_*), replaces matching slots.
- *   - For upsert policies (MU_STORE_UPSERT_*), updates if found, otherwise
- * falls through to a normal insert.
- *   - For conditional‐insert policies (MU_STORE_INSERT_UNIQUE, _DUPLICATE,
- *     _FIRST, _LAST), enforces the policy or returns an error.
- *   - For MU_STORE_INSERT_ANY (or any other policy not handled above), or once
- *     upsert/update conditions are exhausted, does a “default” sorted insert:
- *       finds the first element > item and inserts before it, or appends if
- *       none are greater.
- *
- * @param v      Pointer to the mu_vec to operate on.  Must not be NULL.
- * @param item   Pointer to the new element to insert or use for comparisons.
- *               Must not be NULL.
- * @param cmp    Comparison function with signature
- *               `int cmp(const void *a, const void *b)`, returning
- *               <0 if a<b, 0 if a==b, >0 if a>b.  Both pointers point to
- * elements of size `v->item_size`.
- * @param policy One of the mu_store_insert_policy_t values describing how to
- *               update or insert when matches occur.
- * @return MU_STORE_ERR_NONE on success; otherwise:
- *         - MU_STORE_ERR_PARAM    if `v` or `cmp` is NULL,
- *         - MU_STORE_ERR_NOTFOUND if an update policy found no match,
- *         - MU_STORE_ERR_EXISTS   if MU_STORE_INSERT_UNIQUE found a match,
- *         - MU_STORE_ERR_FULL     if an insert was required but the vector is
- * full,
- *         - or any error returned by mu_vec_insert / mu_vec_replace.
- */
 mu_vec_err_t mu_vec_sorted_insert(mu_vec_t *v, const void *item,
                                   mu_vec_compare_fn cmp,
                                   mu_vec_insert_policy_t policy) {
-    if (v == NULL || cmp == NULL) {
+    if (v == NULL || item == NULL || cmp == NULL) {
         return MU_STORE_ERR_PARAM;
     }
 
-    size_t first_match = SIZE_MAX, last_match = SIZE_MAX;
-    // 1) Linear scan to record the first and last equal-element indices.
-    for (size_t i = 0; i < v->count; ++i) {
-        const void *elem = (const char *)v->item_store + i * v->item_size;
-        int c = cmp(elem, item);
-        if (c == 0) {
-            if (first_match == SIZE_MAX) {
-                first_match = i;
-            }
-            last_match = i;
-        }
+    // 1) Binary search for the first element >= item.
+    size_t lo =
+        mu_store_search(v->item_store, v->count, v->item_size, cmp, item);
+    return sorted_insert(v, item, cmp, policy, lo);
+}
+
+mu_vec_err_t mu_vec_sorted_insert_hint(mu_vec_t *v, const void *item,
+                                       mu_vec_compare_fn cmp,
+                                       mu_vec_insert_policy_t policy,
+                                       size_t *hint) {
+    if (v == NULL || item == NULL || cmp == NULL || hint == NULL) {
+        return MU_STORE_ERR_PARAM;
     }
 
-    // 2) Handle pure‐update policies.
+    // 1) Gallop from the hint for the first element >= item.
+    size_t lo = mu_store_search_from(v->item_store, v->count, v->item_size,
+                                     cmp, item, *hint);
+    *hint = lo;
+    return sorted_insert(v, item, cmp, policy, lo);
+}
+
+// *****************************************************************************
+// Private (static) function definitions
+
+static mu_vec_err_t sorted_insert(mu_vec_t *v, const void *item,
+                                  mu_vec_compare_fn cmp,
+                                  mu_vec_insert_policy_t policy, size_t lo) {
+    // Note whether `lo` is an exact match.  The end of the matching run
+    // (`hi`) is only computed by the policies that need it.
+    bool found = lo < v->count && cmp(item, get_item_address(v, lo)) == 0;
+    size_t hi;
+
     switch (policy) {
+    // 2) Pure-update policies.
     case MU_STORE_UPDATE_FIRST:
-        if (first_match == SIZE_MAX) {
+        if (!found) {
             return MU_STORE_ERR_NOTFOUND;
         }
-        return mu_vec_replace(v, first_match, item);
+        return mu_vec_replace(v, lo, item);
 
     case MU_STORE_UPDATE_LAST:
-        if (last_match == SIZE_MAX) {
+        if (!found) {
             return MU_STORE_ERR_NOTFOUND;
         }
-        return mu_vec_replace(v, last_match, item);
+        hi = upper_bound_from(v, lo, cmp, item);
+        return mu_vec_replace(v, hi - 1, item);
 
     case MU_STORE_UPDATE_ALL:
-        if (first_match == SIZE_MAX) {
+        if (!found) {
             return MU_STORE_ERR_NOTFOUND;
         }
-        for (size_t i = first_match; i < v->count; ++i) {
-            const void *e = (const char *)v->item_store + i * v->item_size;
-            if (cmp(e, item) == 0) {
-                mu_vec_replace(v, i, item);
-            } else {
-                break;
-            }
+        hi = upper_bound_from(v, lo, cmp, item);
+        for (size_t i = lo; i < hi; ++i) {
+            memcpy(get_item_address(v, i), item, v->item_size);
         }
         return MU_STORE_ERR_NONE;
 
-    default:
-        break;
-    }
-
-    // 3) Handle conditional‐insert/update policies.
-    switch (policy) {
+    // 3) Conditional insert/update policies.
     case MU_STORE_UPSERT_FIRST:
-        if (first_match != SIZE_MAX) {
-            return mu_vec_replace(v, first_match, item);
+        if (found) {
+            return mu_vec_replace(v, lo, item);
         }
-        break;
+        return sorted_insert_at(v, lo, item);
+
     case MU_STORE_UPSERT_LAST:
-        if (last_match != SIZE_MAX) {
-            return mu_vec_replace(v, last_match, item);
+        if (found) {
+            hi = upper_bound_from(v, lo, cmp, item);
+            return mu_vec_replace(v, hi - 1, item);
         }
-        break;
+        return sorted_insert_at(v, lo, item);
+
     case MU_STORE_INSERT_UNIQUE:
-        if (first_match != SIZE_MAX) {
+        if (found) {
             return MU_STORE_ERR_EXISTS;
         }
-        break;
+        return sorted_insert_at(v, lo, item);
+
     case MU_STORE_INSERT_DUPLICATE:
-        if (first_match == SIZE_MAX) {
+        if (!found) {
             return MU_STORE_ERR_NOTFOUND;
         }
-        if (v->count >= v->capacity) {
-            return MU_STORE_ERR_FULL;
-        }
-        return mu_vec_insert(v, last_match + 1, item);
+        return sorted_insert_at(v, upper_bound_from(v, lo, cmp, item), item);
+
     case MU_STORE_INSERT_FIRST:
-        if (first_match != SIZE_MAX) {
-            return mu_vec_insert(v, first_match, item);
-        }
-        break;
+        return sorted_insert_at(v, lo, item);
+
+    // 4) Default sorted insertion: insert after any equal elements.
     case MU_STORE_INSERT_LAST:
-        if (last_match != SIZE_MAX) {
-            return mu_vec_insert(v, last_match + 1, item);
-        }
-        break;
     case MU_STORE_INSERT_ANY:
-        break; // fall through to default sorted‐insert below
     default:
-        break;
+        return sorted_insert_at(v, found ? upper_bound_from(v, lo, cmp, item)
+                                         : lo,
+                                item);
     }
+}
 
-    // 4) Default sorted insertion: insert before the first element > item,
-    //    or append if none are greater.
+static size_t upper_bound_from(const mu_vec_t *v, size_t lo,
+                               mu_vec_compare_fn cmp, const void *item) {
+    return lo + mu_store_search_upper(get_item_address(v, lo), v->count - lo,
+                                      v->item_size, cmp, item);
+}
+
+static mu_vec_err_t sorted_insert_at(mu_vec_t *v, size_t index,
+                                     const void *item) {
     if (v->count >= v->capacity) {
         return MU_STORE_ERR_FULL;
     }
-    size_t ins = v->count;
-    for (size_t i = 0; i < v->count; ++i) {
-        const void *elem = (const char *)v->item_store + i * v->item_size;
-        if (cmp(elem, item) > 0) {
-            ins = i;
-            break;
-        }
-    }
-    return mu_vec_insert(v, ins, item);
+    return mu_vec_insert(v, index, item);
 }
 
-// *****************************************************************************
-// Private (static) function definitions
-
 // *****************************************************************************
 // End of file
\ No newline at end of file
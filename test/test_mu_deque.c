@@ -0,0 +1,428 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_deque.c
+ * @brief Unit tests for the mu_deque module.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "unity.h"
+#include "mu_deque.h"
+#include "mu_store.h" // For error codes
+#include <stdbool.h> // For bool
+#include <stdint.h> // For SIZE_MAX
+#include <string.h> // For memset
+
+// *****************************************************************************
+// Private types and definitions
+
+// A non-power-of-two capacity (wrap by compare) and a power of two (masked)
+#define WRAP_CAPACITY 5
+#define MASKED_CAPACITY 8
+
+static int wrap_storage[WRAP_CAPACITY];
+static int masked_storage[MASKED_CAPACITY];
+static mu_deque_t wrap_deque;
+static mu_deque_t masked_deque;
+static mu_deque_t *deques[] = {&wrap_deque, &masked_deque};
+
+#define N_DEQUES (sizeof(deques) / sizeof(deques[0]))
+
+// *****************************************************************************
+// Unity Test Setup and Teardown
+
+void setUp(void) {
+    memset(wrap_storage, 0, sizeof(wrap_storage));
+    memset(masked_storage, 0, sizeof(masked_storage));
+    mu_deque_init(&wrap_deque, wrap_storage, WRAP_CAPACITY, sizeof(int));
+    mu_deque_init(&masked_deque, masked_storage, MASKED_CAPACITY, sizeof(int));
+}
+
+void tearDown(void) {}
+
+// Helper: check that the deque holds exactly `expected[0..n)`, front first
+static void assert_contents(const mu_deque_t *d, const int *expected,
+                            size_t n) {
+    TEST_ASSERT_EQUAL(n, mu_deque_count(d));
+    for (size_t i = 0; i < n; ++i) {
+        const int *slot = mu_deque_at(d, i);
+        TEST_ASSERT_NOT_NULL(slot);
+        TEST_ASSERT_EQUAL(expected[i], *slot);
+    }
+    TEST_ASSERT_NULL(mu_deque_at(d, n));
+}
+
+// *****************************************************************************
+// Test Cases
+
+void test_mu_deque_init(void) {
+    mu_deque_t d;
+    int store[6];
+
+    TEST_ASSERT_EQUAL_PTR(&d, mu_deque_init(&d, store, 6, sizeof(int)));
+    TEST_ASSERT_EQUAL_PTR(store, d.items);
+    TEST_ASSERT_EQUAL(6, mu_deque_capacity(&d));
+    TEST_ASSERT_EQUAL(0, mu_deque_count(&d));
+    TEST_ASSERT_TRUE(mu_deque_is_empty(&d));
+    TEST_ASSERT_FALSE(mu_deque_is_full(&d));
+    TEST_ASSERT_EQUAL(0, d.mask);
+    TEST_ASSERT_EQUAL(MASKED_CAPACITY - 1, masked_deque.mask);
+
+    TEST_ASSERT_NULL(mu_deque_init(NULL, store, 6, sizeof(int)));
+    TEST_ASSERT_NULL(mu_deque_init(&d, NULL, 6, sizeof(int)));
+    TEST_ASSERT_NULL(mu_deque_init(&d, store, 0, sizeof(int)));
+    TEST_ASSERT_NULL(mu_deque_init(&d, store, 6, 0));
+
+    TEST_ASSERT_EQUAL(0, mu_deque_capacity(NULL));
+    TEST_ASSERT_EQUAL(0, mu_deque_count(NULL));
+    TEST_ASSERT_TRUE(mu_deque_is_empty(NULL));
+    TEST_ASSERT_TRUE(mu_deque_is_full(NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_deque_clear(NULL));
+}
+
+void test_mu_deque_push_and_pop_both_ends(void) {
+    for (size_t k = 0; k < N_DEQUES; ++k) {
+        mu_deque_t *d = deques[k];
+        int value;
+
+        // 2 1 0 | 10 11
+        for (int i = 0; i < 3; ++i) {
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_push_front(d, &i));
+        }
+        for (int i = 10; i < 12; ++i) {
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_push_back(d, &i));
+        }
+        const int expected[] = {2, 1, 0, 10, 11};
+        assert_contents(d, expected, 5);
+        TEST_ASSERT_EQUAL(2, *(int *)mu_deque_front(d));
+        TEST_ASSERT_EQUAL(11, *(int *)mu_deque_back(d));
+
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_pop_back(d, &value));
+        TEST_ASSERT_EQUAL(11, value);
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_pop_front(d, &value));
+        TEST_ASSERT_EQUAL(2, value);
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_pop_front(d, NULL));
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_pop_back(d, NULL));
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_pop_back(d, &value));
+        TEST_ASSERT_EQUAL(0, value);
+
+        TEST_ASSERT_TRUE(mu_deque_is_empty(d));
+        TEST_ASSERT_NULL(mu_deque_front(d));
+        TEST_ASSERT_NULL(mu_deque_back(d));
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY, mu_deque_pop_front(d, &value));
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY, mu_deque_pop_back(d, &value));
+    }
+}
+
+void test_mu_deque_full(void) {
+    for (size_t k = 0; k < N_DEQUES; ++k) {
+        mu_deque_t *d = deques[k];
+        size_t cap = mu_deque_capacity(d);
+        int value = 7;
+
+        for (size_t i = 0; i < cap; ++i) {
+            mu_deque_err_t err = (i & 1) ? mu_deque_push_front(d, &value)
+                                         : mu_deque_push_back(d, &value);
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, err);
+        }
+        TEST_ASSERT_TRUE(mu_deque_is_full(d));
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_deque_push_back(d, &value));
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_deque_push_front(d, &value));
+        TEST_ASSERT_EQUAL(cap, mu_deque_count(d));
+
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_clear(d));
+        TEST_ASSERT_TRUE(mu_deque_is_empty(d));
+    }
+}
+
+void test_mu_deque_matches_model(void) {
+    // Random operations at both ends against a plain array model
+    for (size_t k = 0; k < N_DEQUES; ++k) {
+        mu_deque_t *d = deques[k];
+        size_t cap = mu_deque_capacity(d);
+        int model[MASKED_CAPACITY];
+        size_t n = 0;
+        int next = 0, value;
+        uint32_t seed = 12345;
+
+        for (int step = 0; step < 2000; ++step) {
+            seed = seed * 1103515245u + 12345u;
+            switch ((seed >> 16) % 4) {
+            case 0:
+                if (n < cap) {
+                    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                                      mu_deque_push_back(d, &next));
+                    model[n++] = next++;
+                }
+                break;
+            case 1:
+                if (n < cap) {
+                    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                                      mu_deque_push_front(d, &next));
+                    memmove(&model[1], &model[0], n * sizeof(int));
+                    model[0] = next++;
+                    n++;
+                }
+                break;
+            case 2:
+                if (n > 0) {
+                    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                                      mu_deque_pop_front(d, &value));
+                    TEST_ASSERT_EQUAL(model[0], value);
+                    memmove(&model[0], &model[1], --n * sizeof(int));
+                }
+                break;
+            default:
+                if (n > 0) {
+                    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                                      mu_deque_pop_back(d, &value));
+                    TEST_ASSERT_EQUAL(model[--n], value);
+                }
+                break;
+            }
+            assert_contents(d, model, n);
+        }
+    }
+}
+
+void test_mu_deque_masked_counter_overflow(void) {
+    int value;
+    masked_deque.head = masked_deque.tail = 2; // Pushing front goes below 0
+
+    for (int i = 0; i < 4; ++i) {
+        mu_deque_push_front(&masked_deque, &i);
+    }
+    TEST_ASSERT_EQUAL(SIZE_MAX - 1, masked_deque.head); // Wrapped
+    for (int i = 4; i < MASKED_CAPACITY; ++i) {
+        mu_deque_push_back(&masked_deque, &i);
+    }
+    const int expected[] = {3, 2, 1, 0, 4, 5, 6, 7};
+    assert_contents(&masked_deque, expected, MASKED_CAPACITY);
+    TEST_ASSERT_TRUE(mu_deque_is_full(&masked_deque));
+
+    for (int i = 7; i >= 0; --i) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_deque_pop_back(&masked_deque, &value));
+        TEST_ASSERT_EQUAL(expected[i], value);
+    }
+    TEST_ASSERT_TRUE(mu_deque_is_empty(&masked_deque));
+}
+
+void test_mu_deque_at_modifies_in_place(void) {
+    for (int i = 0; i < 4; ++i) {
+        mu_deque_push_back(&wrap_deque, &i);
+    }
+    *(int *)mu_deque_at(&wrap_deque, 2) = 42;
+    const int expected[] = {0, 1, 42, 3};
+    assert_contents(&wrap_deque, expected, 4);
+
+    TEST_ASSERT_NULL(mu_deque_at(NULL, 0));
+    TEST_ASSERT_NULL(mu_deque_at(&wrap_deque, 4));
+}
+
+void test_mu_deque_batched(void) {
+    int in[10], out[10];
+    for (int i = 0; i < 10; ++i) in[i] = i;
+
+    for (size_t k = 0; k < N_DEQUES; ++k) {
+        mu_deque_t *d = deques[k];
+        size_t cap = mu_deque_capacity(d);
+
+        // Start at every offset so that batches are split by the wrap
+        for (size_t offset = 0; offset < cap; ++offset) {
+            mu_deque_clear(d);
+            mu_deque_push_back_n(d, in, offset);
+            mu_deque_pop_front_n(d, NULL, offset);
+
+            // Back then front: in[2..4) in[0..2) -> [0 1 2 3]
+            TEST_ASSERT_EQUAL(2, mu_deque_push_back_n(d, &in[2], 2));
+            TEST_ASSERT_EQUAL(2, mu_deque_push_front_n(d, in, 2));
+            assert_contents(d, in, 4);
+
+            // Fill: only the leading items of the batch go in
+            TEST_ASSERT_EQUAL(cap - 4, mu_deque_push_back_n(d, &in[4], 10));
+            assert_contents(d, in, cap);
+            TEST_ASSERT_EQUAL(0, mu_deque_push_front_n(d, in, 1));
+
+            // Pop from the back in front-to-back order
+            TEST_ASSERT_EQUAL(3, mu_deque_pop_back_n(d, out, 3));
+            TEST_ASSERT_EQUAL_INT_ARRAY(&in[cap - 3], out, 3);
+            TEST_ASSERT_EQUAL(2, mu_deque_pop_front_n(d, out, 2));
+            TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 2);
+            TEST_ASSERT_EQUAL(cap - 5, mu_deque_pop_back_n(d, out, 10));
+            for (size_t i = 0; i < cap - 5; ++i) {
+                TEST_ASSERT_EQUAL(in[2 + i], out[i]);
+            }
+            TEST_ASSERT_TRUE(mu_deque_is_empty(d));
+            TEST_ASSERT_EQUAL(0, mu_deque_pop_front_n(d, out, 1));
+        }
+    }
+
+    TEST_ASSERT_EQUAL(0, mu_deque_push_back_n(NULL, in, 1));
+    TEST_ASSERT_EQUAL(0, mu_deque_push_front_n(&wrap_deque, NULL, 1));
+    TEST_ASSERT_EQUAL(0, mu_deque_pop_front_n(NULL, out, 1));
+    TEST_ASSERT_EQUAL(0, mu_deque_pop_back_n(NULL, out, 1));
+}
+
+void test_mu_deque_reserve_commit(void) {
+    size_t n;
+    int *span;
+
+    // Back: head and tail at slot 3 of 5, so the span stops at the end
+    wrap_deque.head = wrap_deque.tail = 3;
+    span = mu_deque_reserve_back_span(&wrap_deque, 10, &n);
+    TEST_ASSERT_EQUAL_PTR(&wrap_storage[3], span);
+    TEST_ASSERT_EQUAL(2, n);
+    span[0] = 10;
+    span[1] = 11;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_commit_back(&wrap_deque, 2));
+    span = mu_deque_reserve_back(&wrap_deque);
+    TEST_ASSERT_EQUAL_PTR(&wrap_storage[0], span);
+    *span = 12;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_deque_commit_back(&wrap_deque, 1));
+
+    // Front: the span ends just before the front item at slot 3
+    span = mu_deque_reserve_front_span(&wrap_deque, 10, &n);
+    TEST_ASSERT_EQUAL_PTR(&wrap_storage[1], span);
+    TEST_ASSERT_EQUAL(2, n);
+    span[0] = 8;
+    span[1] = 9;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_deque_commit_front(&wrap_deque, 2));
+    const int expected[] = {8, 9, 10, 11, 12};
+    assert_contents(&wrap_deque, expected, 5);
+
+    TEST_ASSERT_NULL(mu_deque_reserve_back(&wrap_deque));
+    TEST_ASSERT_NULL(mu_deque_reserve_front(&wrap_deque));
+    TEST_ASSERT_NULL(mu_deque_reserve_front_span(&wrap_deque, 1, &n));
+    TEST_ASSERT_EQUAL(0, n);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_deque_commit_back(&wrap_deque, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_deque_commit_front(&wrap_deque, 1));
+
+    // Front at slot 0: the free slot before it is the last one
+    span = mu_deque_reserve_front(&masked_deque);
+    TEST_ASSERT_EQUAL_PTR(&masked_storage[MASKED_CAPACITY - 1], span);
+    span = mu_deque_reserve_front_span(&masked_deque, 3, &n);
+    TEST_ASSERT_EQUAL_PTR(&masked_storage[MASKED_CAPACITY - 3], span);
+    TEST_ASSERT_EQUAL(3, n);
+    span[0] = 1;
+    span[1] = 2;
+    span[2] = 3;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_deque_commit_front(&masked_deque, 3));
+    const int expected_masked[] = {1, 2, 3};
+    assert_contents(&masked_deque, expected_masked, 3);
+
+    TEST_ASSERT_NULL(mu_deque_reserve_back(NULL));
+    TEST_ASSERT_NULL(mu_deque_reserve_back_span(&wrap_deque, 1, NULL));
+    TEST_ASSERT_NULL(mu_deque_reserve_front_span(NULL, 1, &n));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_deque_commit_back(NULL, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_deque_commit_front(NULL, 1));
+}
+
+void test_mu_deque_read_span_release(void) {
+    size_t n;
+    const int *span;
+
+    TEST_ASSERT_NULL(mu_deque_read_span(&wrap_deque, 1, &n));
+    TEST_ASSERT_EQUAL(0, n);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY,
+                      mu_deque_release_front(&wrap_deque, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY,
+                      mu_deque_release_back(&wrap_deque, 1));
+
+    // [0 1 2 3 4] with the front at slot 3
+    const int in[] = {0, 1, 2, 3, 4};
+    wrap_deque.head = wrap_deque.tail = 3;
+    mu_deque_push_back_n(&wrap_deque, in, 5);
+
+    span = mu_deque_read_span(&wrap_deque, 10, &n);
+    TEST_ASSERT_EQUAL_PTR(&wrap_storage[3], span);
+    TEST_ASSERT_EQUAL(2, n);
+    TEST_ASSERT_EQUAL_INT_ARRAY(in, span, 2);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_deque_release_front(&wrap_deque, n));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_deque_release_back(&wrap_deque, 1));
+    assert_contents(&wrap_deque, &in[2], 2);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY,
+                      mu_deque_release_back(&wrap_deque, 3));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_deque_release_back(&wrap_deque, 2));
+    TEST_ASSERT_TRUE(mu_deque_is_empty(&wrap_deque));
+
+    TEST_ASSERT_NULL(mu_deque_read_span(NULL, 1, &n));
+    TEST_ASSERT_NULL(mu_deque_read_span(&wrap_deque, 1, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_deque_release_front(NULL, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_deque_release_back(NULL, 1));
+}
+
+void test_mu_deque_sliding_window(void) {
+    // Sliding-window maximum: the deque holds indices of candidate maxima
+    static const int samples[] = {4, 2, 12, 3, 8, 6, 1, 5, 7, 0};
+    static const int expected[] = {12, 12, 12, 8, 8, 6, 7, 7};
+    const size_t window = 3;
+    size_t idx;
+
+    for (size_t i = 0; i < sizeof(samples) / sizeof(samples[0]); ++i) {
+        while (!mu_deque_is_empty(&masked_deque) &&
+               samples[*(int *)mu_deque_back(&masked_deque)] <= samples[i]) {
+            mu_deque_pop_back(&masked_deque, NULL);
+        }
+        int index = (int)i;
+        mu_deque_push_back(&masked_deque, &index);
+        if ((size_t)*(int *)mu_deque_front(&masked_deque) + window <= i) {
+            mu_deque_pop_front(&masked_deque, NULL);
+        }
+        if (i + 1 >= window) {
+            idx = (size_t)*(int *)mu_deque_front(&masked_deque);
+            TEST_ASSERT_EQUAL(expected[i + 1 - window], samples[idx]);
+        }
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_mu_deque_init);
+    RUN_TEST(test_mu_deque_push_and_pop_both_ends);
+    RUN_TEST(test_mu_deque_full);
+    RUN_TEST(test_mu_deque_matches_model);
+    RUN_TEST(test_mu_deque_masked_counter_overflow);
+    RUN_TEST(test_mu_deque_at_modifies_in_place);
+    RUN_TEST(test_mu_deque_batched);
+    RUN_TEST(test_mu_deque_reserve_commit);
+    RUN_TEST(test_mu_deque_read_span_release);
+    RUN_TEST(test_mu_deque_sliding_window);
+
+    return UNITY_END();
+}
+
+// *****************************************************************************
+// End of file
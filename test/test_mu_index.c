@@ -0,0 +1,190 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_index.c
+ * @brief Unit tests for the mu_index Eytzinger search accelerator.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_index.h"
+#include "mu_pvec.h"
+#include "mu_store.h"
+#include "mu_vec.h"
+#include "unity.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define CAP 300
+
+typedef struct {
+    int value; /**< Sort key */
+    char id;   /**< Distinct tag */
+} test_item_t;
+
+// *****************************************************************************
+// storage
+
+static test_item_t items[CAP];
+static test_item_t index_items[CAP];
+static void *ptrs[CAP];
+static void *index_ptrs[CAP];
+
+static mu_vec_t v;
+static mu_pvec_t pv;
+static mu_index_t ix;
+
+// *****************************************************************************
+// helper functions
+
+static int cmp_by_value(const void *a, const void *b) {
+    const test_item_t *ia = (const test_item_t *)a;
+    const test_item_t *ib = (const test_item_t *)b;
+    return (ia->value > ib->value) - (ia->value < ib->value);
+}
+
+// Slot comparator, as used by mu_pvec: b is the address of a pointer slot.
+static int cmp_slot_by_value(const void *a, const void *b) {
+    return cmp_by_value(*(void *const *)a, *(void *const *)b);
+}
+
+// Fill `items` with `n` sorted values (with runs of duplicates).
+static void fill_sorted(size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        items[i].value = (int)(i / 3) * 2;
+        items[i].id = (char)('a' + i % 26);
+        ptrs[i] = &items[i];
+    }
+}
+
+// *****************************************************************************
+// Unity Test Setup and Teardown
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// *****************************************************************************
+// Test Cases
+
+void test_mu_index_init(void) {
+    TEST_ASSERT_NULL(mu_index_init(NULL, index_items, CAP, sizeof(test_item_t)));
+    TEST_ASSERT_NULL(mu_index_init(&ix, NULL, CAP, sizeof(test_item_t)));
+    TEST_ASSERT_NULL(mu_index_init(&ix, index_items, 0, sizeof(test_item_t)));
+    TEST_ASSERT_NULL(mu_index_init(&ix, index_items, CAP, 0));
+    TEST_ASSERT_EQUAL_PTR(
+        &ix, mu_index_init(&ix, index_items, CAP, sizeof(test_item_t)));
+    TEST_ASSERT_EQUAL_size_t(0, mu_index_count(&ix));
+    TEST_ASSERT_EQUAL_size_t(0, mu_index_count(NULL));
+}
+
+void test_mu_index_build_errors(void) {
+    mu_index_init(&ix, index_items, 4, sizeof(test_item_t));
+    fill_sorted(5);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_index_build(NULL, items, 3));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_index_build(&ix, NULL, 3));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_index_build(&ix, items, 5));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_index_build(&ix, items, 4));
+    TEST_ASSERT_EQUAL_size_t(4, mu_index_count(&ix));
+
+    // Item size must match the source vector.
+    mu_vec_init(&v, items, CAP, sizeof(int));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_index_build_vec(&ix, &v));
+    mu_pvec_init(&pv, ptrs, CAP);
+    mu_index_init(&ix, index_items, 4, sizeof(void *) + 1);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_index_build_pvec(&ix, &pv));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_index_build_pvec(&ix, NULL));
+}
+
+void test_mu_index_empty(void) {
+    mu_index_init(&ix, index_items, CAP, sizeof(test_item_t));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_index_build(&ix, NULL, 0));
+    test_item_t key = {5, 0};
+    TEST_ASSERT_EQUAL_size_t(0, mu_index_search(&ix, cmp_by_value, &key));
+}
+
+/**
+ * @brief For every size up to CAP, searching the index for every key in and
+ * around the array gives the same result as mu_store_search().
+ */
+void test_mu_index_search_matches_mu_store_search(void) {
+    mu_index_init(&ix, index_items, CAP, sizeof(test_item_t));
+    for (size_t n = 1; n <= CAP; ++n) {
+        fill_sorted(n);
+        mu_vec_init(&v, items, CAP, sizeof(test_item_t));
+        v.count = n;
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_index_build_vec(&ix, &v));
+        int max_value = items[n - 1].value;
+        for (int k = -1; k <= max_value + 1; ++k) {
+            test_item_t key = {k, 0};
+            TEST_ASSERT_EQUAL_size_t(
+                mu_store_search(items, n, sizeof(test_item_t), cmp_by_value,
+                                &key),
+                mu_index_search(&ix, cmp_by_value, &key));
+        }
+    }
+}
+
+/**
+ * @brief An index built from a mu_pvec supports both slot comparators (as
+ * mu_store_search) and pointer comparators (as mu_store_psearch).
+ */
+void test_mu_index_pvec(void) {
+    size_t n = 100;
+    fill_sorted(n);
+    mu_pvec_init(&pv, ptrs, CAP);
+    pv.count = n;
+    mu_index_init(&ix, index_ptrs, CAP, sizeof(void *));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_index_build_pvec(&ix, &pv));
+
+    for (int k = -1; k <= items[n - 1].value + 1; ++k) {
+        test_item_t key = {k, 0};
+        const void *key_ptr = &key;
+        TEST_ASSERT_EQUAL_size_t(
+            mu_store_search(ptrs, n, sizeof(void *), cmp_slot_by_value,
+                            &key_ptr),
+            mu_index_search(&ix, cmp_slot_by_value, &key_ptr));
+        TEST_ASSERT_EQUAL_size_t(
+            mu_store_psearch((const void *const *)ptrs, n, cmp_by_value, &key),
+            mu_index_psearch(&ix, cmp_by_value, &key));
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_mu_index_init);
+    RUN_TEST(test_mu_index_build_errors);
+    RUN_TEST(test_mu_index_empty);
+    RUN_TEST(test_mu_index_search_matches_mu_store_search);
+    RUN_TEST(test_mu_index_pvec);
+    return UNITY_END();
+}
+
+// *****************************************************************************
+// End of file
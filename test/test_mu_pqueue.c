@@ -274,6 +274,49 @@ void test_mu_pqueue_put(void) {
     TEST_ASSERT_EQUAL_PTR(NULL, test_pqueue.items[0]); // Verify NULL pointer was placed
 }
 
+void test_mu_pqueue_put_overwrite(void) {
+    void *evicted_ptr = p_item1;
+    void *retrieved_ptr;
+    bool evicted = true;
+
+    for (uintptr_t i = 1; i <= TEST_PQUEUE_CAPACITY; ++i) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_pqueue_put_overwrite(&test_pqueue, (void *)i,
+                                                  &evicted_ptr, &evicted));
+        TEST_ASSERT_FALSE(evicted);
+    }
+    TEST_ASSERT_EQUAL_PTR(p_item1, evicted_ptr);
+
+    // NULL is a valid item, so eviction is reported through the flag
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pqueue_put_overwrite(&test_pqueue, NULL,
+                                              &evicted_ptr, &evicted));
+    TEST_ASSERT_TRUE(evicted);
+    TEST_ASSERT_EQUAL_PTR((void *)1, evicted_ptr);
+    TEST_ASSERT_EQUAL(TEST_PQUEUE_CAPACITY, mu_pqueue_count(&test_pqueue));
+
+    for (uintptr_t i = 2; i <= TEST_PQUEUE_CAPACITY; ++i) {
+        mu_pqueue_get(&test_pqueue, &retrieved_ptr);
+        TEST_ASSERT_EQUAL_PTR((void *)i, retrieved_ptr);
+    }
+    mu_pqueue_get(&test_pqueue, &retrieved_ptr);
+    TEST_ASSERT_NULL(retrieved_ptr);
+
+    // Masked mode
+    mu_pqueue_t q;
+    void *store[4];
+    mu_pqueue_init(&q, store, 4);
+    for (uintptr_t i = 1; i <= 9; ++i) {
+        mu_pqueue_put_overwrite(&q, (void *)i, &evicted_ptr, NULL);
+    }
+    TEST_ASSERT_EQUAL_PTR((void *)5, evicted_ptr);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pqueue_peek(&q, &retrieved_ptr));
+    TEST_ASSERT_EQUAL_PTR((void *)6, retrieved_ptr);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pqueue_put_overwrite(NULL, p_item1, NULL, NULL));
+}
+
 /**
  * @brief Test mu_pqueue_get function.
  */
@@ -388,6 +431,108 @@ void test_mu_pqueue_peek(void) {
     TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, err);
 }
 
+/**
+ * @brief A power-of-two capacity runs head and tail freely, masked to a slot.
+ */
+void test_mu_pqueue_masked_mode(void) {
+    mu_pqueue_t q;
+    void *store[4];
+    void *retrieved_ptr;
+    uintptr_t next_in = 1, next_out = 1;
+
+    TEST_ASSERT_NOT_NULL(mu_pqueue_init(&q, store, 4));
+    TEST_ASSERT_EQUAL(3, q.mask);
+    TEST_ASSERT_EQUAL(0, test_pqueue.mask); // Capacity 7 is not masked
+
+    // FIFO order through many wraps, and across counter overflow
+    q.head = q.tail = SIZE_MAX - 5;
+    for (int round = 0; round < 6; ++round) {
+        while (!mu_pqueue_is_full(&q)) {
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_pqueue_put(&q, (void *)next_in++));
+        }
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_pqueue_put(&q, NULL));
+        for (int i = 0; i < 3; ++i) {
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_pqueue_get(&q, &retrieved_ptr));
+            TEST_ASSERT_EQUAL_PTR((void *)next_out++, retrieved_ptr);
+        }
+        TEST_ASSERT_EQUAL(1, mu_pqueue_count(&q));
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pqueue_peek(&q, &retrieved_ptr));
+    TEST_ASSERT_EQUAL_PTR((void *)next_out, retrieved_ptr);
+    TEST_ASSERT_TRUE(q.head < 20); // Wrapped past SIZE_MAX
+}
+
+/**
+ * @brief Other capacities wrap head and tail back into [0..capacity).
+ */
+void test_mu_pqueue_wrap_non_power_of_two(void) {
+    void *retrieved_ptr;
+    uintptr_t expected = 0;
+    for (uintptr_t i = 0; i < 40; ++i) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_pqueue_put(&test_pqueue, (void *)i));
+        if (i % 3 != 0) {
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_pqueue_get(&test_pqueue, &retrieved_ptr));
+            TEST_ASSERT_EQUAL_PTR((void *)expected++, retrieved_ptr);
+        }
+        if (mu_pqueue_is_full(&test_pqueue)) {
+            while (!mu_pqueue_is_empty(&test_pqueue)) {
+                mu_pqueue_get(&test_pqueue, &retrieved_ptr);
+                TEST_ASSERT_EQUAL_PTR((void *)expected++, retrieved_ptr);
+            }
+        }
+        TEST_ASSERT_TRUE(test_pqueue.head < TEST_PQUEUE_CAPACITY);
+        TEST_ASSERT_TRUE(test_pqueue.tail < TEST_PQUEUE_CAPACITY);
+        TEST_ASSERT_EQUAL(i + 1 - expected, mu_pqueue_count(&test_pqueue));
+    }
+}
+
+void test_mu_pqueue_put_get_peek_n(void) {
+    mu_pqueue_t masked;
+    void *masked_store[4];
+    void *in[10], *out[10];
+    for (uintptr_t i = 0; i < 10; ++i) in[i] = (void *)(i + 1);
+
+    // Masked (4) and non-masked (7) capacities, starting at every offset so
+    // that each batch is split by the wrap at some point.
+    mu_pqueue_init(&masked, masked_store, 4);
+    mu_pqueue_t *queues[] = {&masked, &test_pqueue};
+
+    for (int k = 0; k < 2; ++k) {
+        mu_pqueue_t *q = queues[k];
+        size_t cap = mu_pqueue_capacity(q);
+        for (size_t offset = 0; offset < cap; ++offset) {
+            mu_pqueue_clear(q);
+            TEST_ASSERT_EQUAL(offset, mu_pqueue_put_n(q, in, offset));
+            TEST_ASSERT_EQUAL(offset, mu_pqueue_get_n(q, NULL, offset));
+
+            TEST_ASSERT_EQUAL(cap, mu_pqueue_put_n(q, in, 10));
+            TEST_ASSERT_TRUE(mu_pqueue_is_full(q));
+            TEST_ASSERT_EQUAL(0, mu_pqueue_put_n(q, in, 1));
+
+            TEST_ASSERT_EQUAL(cap, mu_pqueue_peek_n(q, out, 10));
+            TEST_ASSERT_EQUAL_PTR_ARRAY(in, out, cap);
+            TEST_ASSERT_EQUAL(cap, mu_pqueue_count(q));
+
+            TEST_ASSERT_EQUAL(3, mu_pqueue_get_n(q, out, 3));
+            TEST_ASSERT_EQUAL_PTR_ARRAY(in, out, 3);
+            TEST_ASSERT_EQUAL(cap - 3, mu_pqueue_get_n(q, out, 10));
+            TEST_ASSERT_EQUAL_PTR_ARRAY(&in[3], out, cap - 3);
+            TEST_ASSERT_TRUE(mu_pqueue_is_empty(q));
+            TEST_ASSERT_EQUAL(0, mu_pqueue_get_n(q, out, 1));
+        }
+    }
+
+    TEST_ASSERT_EQUAL(0, mu_pqueue_put_n(NULL, in, 1));
+    TEST_ASSERT_EQUAL(0, mu_pqueue_put_n(&masked, NULL, 1));
+    TEST_ASSERT_EQUAL(0, mu_pqueue_get_n(NULL, out, 1));
+    TEST_ASSERT_EQUAL(0, mu_pqueue_peek_n(NULL, out, 1));
+    TEST_ASSERT_EQUAL(0, mu_pqueue_peek_n(&masked, NULL, 1));
+}
+
 
 // *****************************************************************************
 // Main Test Runner
@@ -404,8 +549,12 @@ int main(void) {
     RUN_TEST(test_mu_pqueue_is_full);
     RUN_TEST(test_mu_pqueue_clear);
     RUN_TEST(test_mu_pqueue_put);
+    RUN_TEST(test_mu_pqueue_put_overwrite);
     RUN_TEST(test_mu_pqueue_get);
     RUN_TEST(test_mu_pqueue_peek);
+    RUN_TEST(test_mu_pqueue_masked_mode);
+    RUN_TEST(test_mu_pqueue_wrap_non_power_of_two);
+    RUN_TEST(test_mu_pqueue_put_get_peek_n);
 
 
     return UNITY_END();
@@ -183,6 +183,47 @@ void test_mu_pvec_insert_delete(void) {
     TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, err);
 }
 
+void test_mu_pvec_range_operations(void) {
+    void *store[CAP];
+    mu_pvec_t v;
+    mu_pvec_init(&v, store, CAP);
+    int n[6] = {0, 1, 2, 3, 4, 5};
+    void *lo[] = {&n[0], &n[1], &n[2]};
+    void *hi[] = {&n[3], &n[4], &n[5]};
+    void *many[CAP] = {0};
+    void *out[CAP];
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_push_n(&v, lo, 3));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_insert_range(&v, 1, hi, 3));
+    /* v = [0, 3, 4, 5, 1, 2] */
+    TEST_ASSERT_EQUAL_size_t(6, mu_pvec_count(&v));
+    TEST_ASSERT_EQUAL_PTR(&n[3], store[1]);
+    TEST_ASSERT_EQUAL_PTR(&n[1], store[4]);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_pvec_push_n(&v, many, 5));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_pvec_insert_range(&v, 0, many, 5));
+    TEST_ASSERT_EQUAL_size_t(6, mu_pvec_count(&v));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_copy_out_range(&v, 1, 2, out));
+    TEST_ASSERT_EQUAL_PTR(&n[3], out[0]);
+    TEST_ASSERT_EQUAL_PTR(&n[4], out[1]);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_delete_range(&v, 0, 3, out));
+    TEST_ASSERT_EQUAL_PTR(&n[4], out[2]);
+    /* v = [5, 1, 2] */
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_replace_range(&v, 1, 2, lo, 1));
+    /* v = [5, 0] */
+    TEST_ASSERT_EQUAL_size_t(2, mu_pvec_count(&v));
+    TEST_ASSERT_EQUAL_PTR(&n[5], store[0]);
+    TEST_ASSERT_EQUAL_PTR(&n[0], store[1]);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX, mu_pvec_delete_range(&v, 1, 2, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX, mu_pvec_insert_range(&v, 3, lo, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_pvec_push_n(&v, NULL, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_copy_out_range(NULL, 0, 0, out));
+}
+
 void test_mu_pvec_replace_swap(void) {
     void *storage[3];
     mu_pvec_t v;
@@ -469,6 +510,48 @@ void test_mu_pvec_upsert_first_and_last(void) {
     TEST_ASSERT_EQUAL_INT(33, out->id);
 }
 
+void test_mu_pvec_sorted_insert_hint(void) {
+    void *storage[CAP];
+    mu_pvec_t v;
+    mu_pvec_init(&v, storage, CAP);
+    size_t hint = 0;
+
+    item_t A = {.value = 1, .id = 11};
+    item_t B = {.value = 2, .id = 22};
+    item_t C = {.value = 3, .id = 33};
+    item_t B2 = {.value = 2, .id = 23};
+    /* ascending appends, then a duplicate behind the hint */
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_sorted_insert_hint(&v, &A, cmp_item,
+                                                 MU_STORE_INSERT_ANY, &hint));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_sorted_insert_hint(&v, &B, cmp_item,
+                                                 MU_STORE_INSERT_ANY, &hint));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_sorted_insert_hint(&v, &C, cmp_item,
+                                                 MU_STORE_INSERT_ANY, &hint));
+    TEST_ASSERT_EQUAL_size_t(2, hint);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_sorted_insert_hint(&v, &B2, cmp_item,
+                                                 MU_STORE_INSERT_LAST, &hint));
+    TEST_ASSERT_EQUAL_size_t(1, hint);
+
+    /* v = [A, B, B2, C] */
+    item_t *out;
+    mu_pvec_ref(&v, 2, (void **)&out);
+    TEST_ASSERT_EQUAL_INT(23, out->id);
+    mu_pvec_ref(&v, 3, (void **)&out);
+    TEST_ASSERT_EQUAL_INT(33, out->id);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_EXISTS,
+                      mu_pvec_sorted_insert_hint(&v, &C, cmp_item,
+                                                 MU_STORE_INSERT_UNIQUE,
+                                                 &hint));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_sorted_insert_hint(&v, &C, cmp_item,
+                                                 MU_STORE_INSERT_ANY, NULL));
+}
+
 // *****************************************************************************
 // Edge cases
 
@@ -571,6 +654,44 @@ void test_mu_pvec_delete_with_null_outptr(void) {
     TEST_ASSERT_EQUAL_size_t(0, mu_pvec_count(&v));
 }
 
+//----------------------------------------------------------------------------//
+// mu_pvec_swap_remove and mu_pvec_swap_remove_indices
+
+void test_mu_pvec_swap_remove(void) {
+    int vals[6] = {0, 1, 2, 3, 4, 5};
+    void *store[6];
+    void *out[6];
+    mu_pvec_t v;
+    mu_pvec_init(&v, store, 6);
+    for (size_t i = 0; i < 6; ++i) {
+        mu_pvec_push(&v, &vals[i]);
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_swap_remove(&v, 1, &out[0]));
+    TEST_ASSERT_EQUAL_PTR(&vals[1], out[0]);
+    TEST_ASSERT_EQUAL_size_t(5, mu_pvec_count(&v));
+    TEST_ASSERT_EQUAL_PTR(&vals[5], store[1]);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_swap_remove(&v, 4, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX, mu_pvec_swap_remove(&v, 4, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_pvec_swap_remove(NULL, 0, NULL));
+
+    // store is now {0, 5, 2, 3}
+    const size_t bad[] = {2, 2};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX,
+                      mu_pvec_swap_remove_indices(&v, bad, 2, NULL));
+    TEST_ASSERT_EQUAL_size_t(4, mu_pvec_count(&v));
+    const size_t indices[] = {0, 3};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_swap_remove_indices(&v, indices, 2, out));
+    TEST_ASSERT_EQUAL_PTR(&vals[0], out[0]);
+    TEST_ASSERT_EQUAL_PTR(&vals[3], out[1]);
+    TEST_ASSERT_EQUAL_size_t(2, mu_pvec_count(&v));
+    TEST_ASSERT_EQUAL_PTR(&vals[2], store[0]);
+    TEST_ASSERT_EQUAL_PTR(&vals[5], store[1]);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_swap_remove_indices(&v, NULL, 1, NULL));
+}
+
 //----------------------------------------------------------------------------//
 // mu_pvec_push: NULL v and FULL
 
@@ -640,6 +761,163 @@ void test_mu_pvec_rfind_param_and_notfound(void) {
                       mu_pvec_rfind(&v, always_false, NULL, &idx));
 }
 
+//----------------------------------------------------------------------------//
+// mu_pvec_find_from / mu_pvec_find_all
+
+static bool is_even_int(const void *item, const void *arg) {
+    (void)arg;
+    return (*(const int *)item & 1) == 0;
+}
+
+void test_mu_pvec_find_from_and_find_all(void) {
+    int vals[] = {1, 2, 3, 4, 5, 6};
+    void *store[6];
+    mu_pvec_t v;
+    mu_pvec_init(&v, store, 6);
+    for (size_t i = 0; i < 6; ++i) {
+        mu_pvec_push(&v, &vals[i]);
+    }
+    size_t idx, n_found;
+    size_t indices[6];
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_find_from(&v, 2, is_even_int, NULL, &idx));
+    TEST_ASSERT_EQUAL_size_t(3, idx);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND,
+                      mu_pvec_find_from(&v, 6, is_even_int, NULL, &idx));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX,
+                      mu_pvec_find_from(&v, 7, is_even_int, NULL, &idx));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_find_all(&v, is_even_int, NULL, indices, 6,
+                                       &n_found));
+    TEST_ASSERT_EQUAL_size_t(3, n_found);
+    TEST_ASSERT_EQUAL_size_t(1, indices[0]);
+    TEST_ASSERT_EQUAL_size_t(3, indices[1]);
+    TEST_ASSERT_EQUAL_size_t(5, indices[2]);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_pvec_find_all(&v, is_even_int, NULL, indices, 1,
+                                       &n_found));
+    TEST_ASSERT_EQUAL_size_t(1, n_found);
+
+    // Resume one past the last index written until the search completes
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_pvec_find_all_from(&v, indices[0] + 1, is_even_int,
+                                            NULL, indices + 1, 1, &n_found));
+    TEST_ASSERT_EQUAL_size_t(3, indices[1]);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_find_all_from(&v, indices[1] + 1, is_even_int,
+                                            NULL, indices + 2, 1, &n_found));
+    TEST_ASSERT_EQUAL_size_t(1, n_found);
+    TEST_ASSERT_EQUAL_size_t(5, indices[2]);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX,
+                      mu_pvec_find_all_from(&v, 7, is_even_int, NULL, indices,
+                                            6, &n_found));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_find_all(&v, NULL, NULL, indices, 6, &n_found));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_find_all(&v, is_even_int, NULL, indices, 6,
+                                       NULL));
+
+    // Appending into a mu_vec of size_t
+    size_t index_store[4];
+    mu_vec_t out;
+    mu_vec_init(&out, index_store, 4, sizeof(size_t));
+    size_t first = 7;
+    mu_vec_push(&out, &first); // Existing contents are kept
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_find_all_vec(&v, is_even_int, NULL, &out));
+    TEST_ASSERT_EQUAL_size_t(4, mu_vec_count(&out));
+    TEST_ASSERT_EQUAL_size_t(7, index_store[0]);
+    TEST_ASSERT_EQUAL_size_t(1, index_store[1]);
+    TEST_ASSERT_EQUAL_size_t(3, index_store[2]);
+    TEST_ASSERT_EQUAL_size_t(5, index_store[3]);
+    // Full: nothing appended
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_pvec_find_all_vec(&v, is_even_int, NULL, &out));
+    TEST_ASSERT_EQUAL_size_t(4, mu_vec_count(&out));
+    // Partly full: the indices that fit are appended
+    mu_vec_clear(&out);
+    mu_vec_push(&out, &first);
+    mu_vec_push(&out, &first);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_pvec_find_all_vec(&v, is_even_int, NULL, &out));
+    TEST_ASSERT_EQUAL_size_t(4, mu_vec_count(&out));
+    TEST_ASSERT_EQUAL_size_t(3, index_store[3]);
+
+    // A vector over the searched pointers is rejected, untouched
+    mu_vec_t alias;
+    mu_vec_init(&alias, store, 6, sizeof(size_t));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_find_all_vec(&v, is_even_int, NULL, &alias));
+    TEST_ASSERT_EQUAL_size_t(0, mu_vec_count(&alias));
+    TEST_ASSERT_EQUAL_PTR(&vals[0], store[0]);
+    mu_vec_init(&out, index_store, 4, sizeof(int));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_find_all_vec(&v, is_even_int, NULL, &out));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_find_all_vec(&v, is_even_int, NULL, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_find_all_vec(NULL, is_even_int, NULL, &out));
+}
+
+//----------------------------------------------------------------------------//
+// mu_pvec_find_ptr: exact pointer search
+
+void test_mu_pvec_find_ptr(void) {
+    int vals[CAP];
+    void *store[CAP];
+    mu_pvec_t v;
+    mu_pvec_init(&v, store, CAP);
+    for (size_t i = 0; i < CAP; ++i) {
+        mu_pvec_push(&v, &vals[i % 7]);
+    }
+
+    size_t idx;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_find_ptr(&v, &vals[2], &idx));
+    TEST_ASSERT_EQUAL_size_t(2, idx);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_find_ptr(&v, &vals[6], &idx));
+    TEST_ASSERT_EQUAL_size_t(6, idx);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND,
+                      mu_pvec_find_ptr(&v, &vals[7], &idx));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND, mu_pvec_find_ptr(&v, NULL, &idx));
+    mu_pvec_replace(&v, 9, NULL);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_find_ptr(&v, NULL, &idx));
+    TEST_ASSERT_EQUAL_size_t(9, idx);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_find_ptr(NULL, &vals[0], &idx));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_find_ptr(&v, &vals[0], NULL));
+}
+
+//----------------------------------------------------------------------------//
+// mu_pvec_retain: keeps survivors in order
+
+void test_mu_pvec_retain(void) {
+    int vals[] = {2, 3, 4, 5, 7, 8};
+    void *store[6];
+    mu_pvec_t v;
+    mu_pvec_init(&v, store, 6);
+    for (size_t i = 0; i < 6; ++i) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_push(&v, &vals[i]));
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_retain(&v, is_even_int, NULL));
+    TEST_ASSERT_EQUAL_size_t(3, mu_pvec_count(&v));
+    TEST_ASSERT_EQUAL_PTR(&vals[0], store[0]);
+    TEST_ASSERT_EQUAL_PTR(&vals[2], store[1]);
+    TEST_ASSERT_EQUAL_PTR(&vals[5], store[2]);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_retain(&v, always_false, NULL));
+    TEST_ASSERT_TRUE(mu_pvec_is_empty(&v));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_retain(NULL, is_even_int, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_pvec_retain(&v, NULL, NULL));
+}
+
 //----------------------------------------------------------------------------//
 // mu_pvec_sort: NULL params, short arrays (<2)
 
@@ -657,6 +935,166 @@ void test_mu_pvec_sort_param_and_short(void) {
     TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_sort(&v, cmp_item));
 }
 
+//----------------------------------------------------------------------------//
+// mu_pvec_stable_sort: equal items keep their order
+
+void test_mu_pvec_stable_sort(void) {
+    void *store[CAP];
+    void *scratch[CAP / 2];
+    mu_pvec_t v;
+    mu_pvec_init(&v, store, CAP);
+
+    item_t in[] = {{3, 0}, {1, 1}, {3, 2}, {2, 3}, {1, 4},
+                   {3, 5}, {2, 6}, {1, 7}, {2, 8}, {3, 9}};
+    const int expected[] = {1, 4, 7, 3, 6, 8, 0, 2, 5, 9};
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_stable_sort(NULL, cmp_item, NULL, 0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_stable_sort(&v, NULL, NULL, 0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_stable_sort(&v, cmp_item, NULL, 0));
+
+    for (int pass = 0; pass < 2; ++pass) {
+        mu_pvec_clear(&v);
+        for (int i = 0; i < CAP; ++i) {
+            mu_pvec_push(&v, &in[i]);
+        }
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_pvec_stable_sort(&v, cmp_item,
+                                              pass ? scratch : NULL,
+                                              pass ? CAP / 2 : 0));
+        for (int i = 0; i < CAP; ++i) {
+            item_t *out;
+            mu_pvec_ref(&v, i, (void **)&out);
+            TEST_ASSERT_EQUAL_INT(expected[i], out->id);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------//
+// mu_pvec_sort_by_key
+
+static uint64_t item_key(const void *item) {
+    return (uint64_t)((const item_t *)item)->value;
+}
+
+void test_mu_pvec_sort_by_key(void) {
+    void *store[CAP];
+    mu_store_key_pair_t pairs[CAP * 2];
+    mu_pvec_t v;
+    mu_pvec_init(&v, store, CAP);
+
+    item_t in[] = {{3, 0}, {1, 1}, {3, 2}, {2, 3}, {1, 4},
+                   {3, 5}, {2, 6}, {1, 7}, {2, 8}, {3, 9}};
+    const int expected[] = {1, 4, 7, 3, 6, 8, 0, 2, 5, 9};
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_sort_by_key(NULL, item_key, pairs, CAP * 2));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_sort_by_key(&v, NULL, pairs, CAP * 2));
+    // The scratch is required whatever the count, even for an empty vector
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_sort_by_key(&v, item_key, NULL, 0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_sort_by_key(&v, item_key, pairs, 0));
+
+    // Radix (stable) with 2 * count pairs, pdqsort with count pairs
+    for (int pass = 0; pass < 2; ++pass) {
+        mu_pvec_clear(&v);
+        for (int i = 0; i < CAP; ++i) {
+            mu_pvec_push(&v, &in[i]);
+        }
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_pvec_sort_by_key(&v, item_key, pairs,
+                                              pass ? CAP : CAP * 2));
+        for (int i = 0; i < CAP; ++i) {
+            item_t *out;
+            mu_pvec_ref(&v, i, (void **)&out);
+            if (pass) {
+                TEST_ASSERT_EQUAL_INT(in[expected[i]].value, out->value);
+            } else {
+                TEST_ASSERT_EQUAL_INT(expected[i], out->id);
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_sort_by_key(&v, item_key, pairs, CAP - 1));
+}
+
+//----------------------------------------------------------------------------//
+// mu_pvec_select / mu_pvec_partial_sort / mu_pvec_topk
+
+void test_mu_pvec_select_partial_sort_topk(void) {
+    void *store[CAP];
+    void *top[4];
+    size_t n_out = 0;
+    mu_pvec_t v;
+    mu_pvec_init(&v, store, CAP);
+
+    item_t in[] = {{5, 0}, {2, 1}, {8, 2}, {1, 3}, {6, 4},
+                   {3, 5}, {7, 6}, {4, 7}, {9, 8}, {0, 9}};
+    for (int i = 0; i < CAP; ++i) {
+        mu_pvec_push(&v, &in[i]);
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_pvec_select(NULL, 0, cmp_item));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_pvec_select(&v, CAP, cmp_item));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_pvec_partial_sort(&v, 2, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_topk(&v, 2, NULL, top, &n_out));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_topk(&v, 4, cmp_item, top, &n_out));
+    TEST_ASSERT_EQUAL(4, n_out);
+    for (int i = 0; i < 4; ++i) {
+        TEST_ASSERT_EQUAL_INT(i, ((item_t *)top[i])->value);
+    }
+    TEST_ASSERT_EQUAL_PTR(&in[0], store[0]); // vector untouched
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_pvec_select(&v, 7, cmp_item));
+    TEST_ASSERT_EQUAL_INT(7, ((item_t *)store[7])->value);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_partial_sort(&v, 5, cmp_item));
+    for (int i = 0; i < 5; ++i) {
+        TEST_ASSERT_EQUAL_INT(i, ((item_t *)store[i])->value);
+    }
+}
+
+//----------------------------------------------------------------------------//
+// mu_pvec_argsort / mu_pvec_apply_permutation
+
+void test_mu_pvec_argsort_apply_permutation(void) {
+    void *store[CAP];
+    size_t perm[CAP];
+    mu_pvec_t v;
+    mu_pvec_init(&v, store, CAP);
+
+    item_t in[] = {{3, 0}, {1, 1}, {3, 2}, {2, 3}, {1, 4},
+                   {3, 5}, {2, 6}, {1, 7}, {2, 8}, {3, 9}};
+    const int expected[] = {1, 4, 7, 3, 6, 8, 0, 2, 5, 9};
+    for (int i = 0; i < CAP; ++i) {
+        mu_pvec_push(&v, &in[i]);
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_argsort(NULL, cmp_item, perm, sizeof(size_t)));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_apply_permutation(&v, NULL, sizeof(size_t)));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_argsort(&v, cmp_item, perm, sizeof(size_t)));
+    for (int i = 0; i < CAP; ++i) {
+        TEST_ASSERT_EQUAL(expected[i], perm[i]);
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_apply_permutation(&v, perm, sizeof(size_t)));
+    for (int i = 0; i < CAP; ++i) {
+        TEST_ASSERT_EQUAL_PTR(&in[expected[i]], store[i]);
+    }
+}
+
 //----------------------------------------------------------------------------//
 // mu_pvec_reverse: NULL and short
 
@@ -851,6 +1289,42 @@ void test_mu_pvec_sorted_insert_duplicate_full_on_match(void)
     TEST_ASSERT_EQUAL_INT(20, out->id);
 }
 
+void test_mu_pvec_sorted_insert_update_last_and_all(void)
+{
+    void *storage[CAP];
+    mu_pvec_t v;
+    mu_pvec_init(&v, storage, CAP);
+
+    // v = [1(10), 2(20), 2(21), 2(22), 3(30)]
+    item_t in[] = {{1, 10}, {2, 20}, {2, 21}, {2, 22}, {3, 30}};
+    for (size_t i = 0; i < sizeof(in) / sizeof(in[0]); ++i) {
+        mu_pvec_sorted_insert(&v, &in[i], cmp_item, MU_STORE_INSERT_ANY);
+    }
+
+    item_t *out;
+    item_t L = {.value = 2, .id = 99};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_sorted_insert(&v, &L, cmp_item,
+                                            MU_STORE_UPDATE_LAST));
+    mu_pvec_ref(&v, 3, (void **)&out);
+    TEST_ASSERT_EQUAL_PTR(&L, out);
+    mu_pvec_ref(&v, 2, (void **)&out);
+    TEST_ASSERT_EQUAL_PTR(&in[2], out);
+
+    item_t A = {.value = 2, .id = 77};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_sorted_insert(&v, &A, cmp_item,
+                                            MU_STORE_UPDATE_ALL));
+    for (size_t i = 1; i <= 3; ++i) {
+        mu_pvec_ref(&v, i, (void **)&out);
+        TEST_ASSERT_EQUAL_PTR(&A, out);
+    }
+    mu_pvec_ref(&v, 0, (void **)&out);
+    TEST_ASSERT_EQUAL_PTR(&in[0], out);
+    mu_pvec_ref(&v, 4, (void **)&out);
+    TEST_ASSERT_EQUAL_PTR(&in[4], out);
+}
+
 // *****************************************************************************
 // main driver.
 
@@ -861,6 +1335,7 @@ int main(void) {
     RUN_TEST(test_mu_pvec_push_pop_ref_clear);
     RUN_TEST(test_mu_pvec_insert_delete);
     RUN_TEST(test_mu_pvec_replace_swap);
+    RUN_TEST(test_mu_pvec_range_operations);
     RUN_TEST(test_mu_pvec_peek_and_find);
     RUN_TEST(test_mu_pvec_sort_and_reverse);
 
@@ -869,6 +1344,7 @@ int main(void) {
     RUN_TEST(test_mu_pvec_insert_unique_and_duplicate);
     RUN_TEST(test_mu_pvec_update_first_last_all);
     RUN_TEST(test_mu_pvec_upsert_first_and_last);
+    RUN_TEST(test_mu_pvec_sorted_insert_hint);
 
     RUN_TEST(test_mu_pvec_init_null_v);
     RUN_TEST(test_mu_pvec_init_null_store);
@@ -883,12 +1359,20 @@ int main(void) {
     RUN_TEST(test_mu_pvec_delete_null);
     RUN_TEST(test_mu_pvec_delete_index_too_large);
     RUN_TEST(test_mu_pvec_delete_with_null_outptr);
+    RUN_TEST(test_mu_pvec_swap_remove);
     RUN_TEST(test_mu_pvec_push_null);
     RUN_TEST(test_mu_pvec_push_full);
     RUN_TEST(test_mu_pvec_pop_null_args);
     RUN_TEST(test_mu_pvec_pop_empty);
     RUN_TEST(test_mu_pvec_rfind_param_and_notfound);
+    RUN_TEST(test_mu_pvec_find_from_and_find_all);
+    RUN_TEST(test_mu_pvec_find_ptr);
+    RUN_TEST(test_mu_pvec_retain);
     RUN_TEST(test_mu_pvec_sort_param_and_short);
+    RUN_TEST(test_mu_pvec_stable_sort);
+    RUN_TEST(test_mu_pvec_sort_by_key);
+    RUN_TEST(test_mu_pvec_select_partial_sort_topk);
+    RUN_TEST(test_mu_pvec_argsort_apply_permutation);
     RUN_TEST(test_mu_pvec_reverse_param_and_short);
     RUN_TEST(test_mu_pvec_sorted_insert_param);
 
@@ -902,6 +1386,7 @@ int main(void) {
     RUN_TEST(test_mu_pvec_sorted_insert_last_no_match);
     RUN_TEST(test_mu_pvec_sorted_insert_full);
     RUN_TEST(test_mu_pvec_sorted_insert_duplicate_full_on_match);
+    RUN_TEST(test_mu_pvec_sorted_insert_update_last_and_all);
 
     return UNITY_END();
 }
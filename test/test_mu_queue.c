@@ -280,6 +280,60 @@ void test_mu_queue_put(void) {
 
 }
 
+void test_mu_queue_put_overwrite(void) {
+    test_item_t item = q_item_fill, evicted_item, retrieved;
+    bool evicted = true;
+
+    // Below capacity it behaves like mu_queue_put
+    evicted_item = q_item1;
+    for (int i = 0; i < TEST_QUEUE_CAPACITY; ++i) {
+        item.value = i;
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_queue_put_overwrite(&test_queue, &item,
+                                                 &evicted_item, &evicted));
+        TEST_ASSERT_FALSE(evicted);
+    }
+    TEST_ASSERT_EQUAL(q_item1.value, evicted_item.value); // Unchanged
+    TEST_ASSERT_TRUE(mu_queue_is_full(&test_queue));
+
+    // Once full, each put evicts the oldest item
+    for (int i = TEST_QUEUE_CAPACITY; i < 3 * TEST_QUEUE_CAPACITY + 2; ++i) {
+        item.value = i;
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_queue_put_overwrite(&test_queue, &item,
+                                                 &evicted_item, &evicted));
+        TEST_ASSERT_TRUE(evicted);
+        TEST_ASSERT_EQUAL(i - TEST_QUEUE_CAPACITY, evicted_item.value);
+        TEST_ASSERT_EQUAL(TEST_QUEUE_CAPACITY, mu_queue_count(&test_queue));
+    }
+    // The queue holds the newest items, oldest first
+    for (int i = 2 * TEST_QUEUE_CAPACITY + 2; i < 3 * TEST_QUEUE_CAPACITY + 2;
+         ++i) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_queue_get(&test_queue, &retrieved));
+        TEST_ASSERT_EQUAL(i, retrieved.value);
+    }
+
+    // Masked mode, with the optional outputs omitted
+    mu_queue_t q;
+    int store[4], value;
+    mu_queue_init(&q, store, 4, sizeof(int));
+    for (int i = 0; i < 10; ++i) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_queue_put_overwrite(&q, &i, NULL, NULL));
+    }
+    TEST_ASSERT_EQUAL(4, mu_queue_count(&q));
+    for (int i = 6; i < 10; ++i) {
+        mu_queue_get(&q, &value);
+        TEST_ASSERT_EQUAL(i, value);
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_queue_put_overwrite(NULL, &item, NULL, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_queue_put_overwrite(&q, NULL, NULL, NULL));
+}
+
 /**
  * @brief Test mu_queue_get function.
  */
@@ -395,6 +449,260 @@ void test_mu_queue_peek(void) {
 
 }
 
+/**
+ * @brief A power-of-two capacity runs head and tail freely, masked to a slot.
+ */
+void test_mu_queue_masked_mode(void) {
+    mu_queue_t q;
+    int store[8];
+    int value;
+
+    TEST_ASSERT_NOT_NULL(mu_queue_init(&q, store, 8, sizeof(int)));
+    TEST_ASSERT_EQUAL(7, q.mask);
+    TEST_ASSERT_EQUAL(0, test_queue.mask); // Capacity 5 is not masked
+
+    // FIFO order through many wraps; indices are not reduced
+    int next_in = 0, next_out = 0;
+    for (int round = 0; round < 10; ++round) {
+        while (!mu_queue_is_full(&q)) {
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_put(&q, &next_in));
+            next_in++;
+        }
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_queue_put(&q, &next_in));
+        for (int i = 0; i < 5; ++i) {
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_get(&q, &value));
+            TEST_ASSERT_EQUAL(next_out++, value);
+        }
+        TEST_ASSERT_EQUAL(3, mu_queue_count(&q));
+    }
+    TEST_ASSERT_EQUAL(next_in, q.tail);
+    TEST_ASSERT_EQUAL(next_out, q.head);
+
+    // Across the overflow of the free-running counters
+    mu_queue_clear(&q);
+    q.head = q.tail = SIZE_MAX - 2;
+    for (int i = 0; i < 8; ++i) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_put(&q, &i));
+    }
+    TEST_ASSERT_TRUE(mu_queue_is_full(&q));
+    for (int i = 0; i < 8; ++i) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_peek(&q, &value));
+        TEST_ASSERT_EQUAL(i, value);
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_get(&q, &value));
+        TEST_ASSERT_EQUAL(i, value);
+        TEST_ASSERT_EQUAL(7 - i, mu_queue_count(&q));
+    }
+    TEST_ASSERT_TRUE(mu_queue_is_empty(&q));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY, mu_queue_get(&q, &value));
+}
+
+/**
+ * @brief Other capacities wrap head and tail back into [0..capacity).
+ */
+void test_mu_queue_wrap_non_power_of_two(void) {
+    test_item_t item = q_item1, retrieved;
+    int expected = 0;
+    for (int i = 0; i < 40; ++i) {
+        item.value = i;
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_put(&test_queue, &item));
+        if (i % 3 != 0) {
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_queue_get(&test_queue, &retrieved));
+            TEST_ASSERT_EQUAL(expected++, retrieved.value);
+        }
+        if (mu_queue_is_full(&test_queue)) {
+            while (!mu_queue_is_empty(&test_queue)) {
+                mu_queue_get(&test_queue, &retrieved);
+                TEST_ASSERT_EQUAL(expected++, retrieved.value);
+            }
+        }
+        TEST_ASSERT_TRUE(test_queue.head < TEST_QUEUE_CAPACITY);
+        TEST_ASSERT_TRUE(test_queue.tail < TEST_QUEUE_CAPACITY);
+        TEST_ASSERT_EQUAL(i + 1 - expected, mu_queue_count(&test_queue));
+    }
+}
+
+void test_mu_queue_put_get_peek_n(void) {
+    mu_queue_t masked, wrapped;
+    int masked_store[8], wrapped_store[5];
+    int in[10], out[10];
+    for (int i = 0; i < 10; ++i) in[i] = i;
+
+    // Masked (8) and non-masked (5) capacities, starting at every offset so
+    // that each batch is split by the wrap at some point.
+    mu_queue_init(&masked, masked_store, 8, sizeof(int));
+    mu_queue_init(&wrapped, wrapped_store, 5, sizeof(int));
+    mu_queue_t *queues[] = {&masked, &wrapped};
+
+    for (int k = 0; k < 2; ++k) {
+        mu_queue_t *q = queues[k];
+        size_t cap = mu_queue_capacity(q);
+        for (size_t offset = 0; offset < cap; ++offset) {
+            mu_queue_clear(q);
+            TEST_ASSERT_EQUAL(offset, mu_queue_put_n(q, in, offset));
+            TEST_ASSERT_EQUAL(offset, mu_queue_get_n(q, NULL, offset));
+
+            // Only `cap` of the 10 items fit
+            TEST_ASSERT_EQUAL(cap, mu_queue_put_n(q, in, 10));
+            TEST_ASSERT_TRUE(mu_queue_is_full(q));
+            TEST_ASSERT_EQUAL(0, mu_queue_put_n(q, in, 1));
+
+            memset(out, 0xff, sizeof(out));
+            TEST_ASSERT_EQUAL(3, mu_queue_peek_n(q, out, 3));
+            TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 3);
+            TEST_ASSERT_EQUAL(cap, mu_queue_count(q));
+
+            TEST_ASSERT_EQUAL(cap, mu_queue_peek_n(q, out, 10));
+            TEST_ASSERT_EQUAL_INT_ARRAY(in, out, cap);
+
+            // Drain in two batches, the second one short
+            TEST_ASSERT_EQUAL(2, mu_queue_get_n(q, out, 2));
+            TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 2);
+            TEST_ASSERT_EQUAL(cap - 2, mu_queue_get_n(q, out, 10));
+            TEST_ASSERT_EQUAL_INT_ARRAY(&in[2], out, cap - 2);
+            TEST_ASSERT_TRUE(mu_queue_is_empty(q));
+            TEST_ASSERT_EQUAL(0, mu_queue_get_n(q, out, 1));
+        }
+    }
+
+    // Batches interleave with single-item operations
+    mu_queue_clear(&wrapped);
+    int value = 42;
+    mu_queue_put(&wrapped, &value);
+    TEST_ASSERT_EQUAL(4, mu_queue_put_n(&wrapped, in, 4));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_get(&wrapped, &value));
+    TEST_ASSERT_EQUAL(42, value);
+    TEST_ASSERT_EQUAL(4, mu_queue_get_n(&wrapped, out, 4));
+    TEST_ASSERT_EQUAL_INT_ARRAY(in, out, 4);
+
+    // Invalid parameters transfer nothing
+    TEST_ASSERT_EQUAL(0, mu_queue_put_n(NULL, in, 1));
+    TEST_ASSERT_EQUAL(0, mu_queue_put_n(&masked, NULL, 1));
+    TEST_ASSERT_EQUAL(0, mu_queue_get_n(NULL, out, 1));
+    TEST_ASSERT_EQUAL(0, mu_queue_peek_n(NULL, out, 1));
+    TEST_ASSERT_EQUAL(0, mu_queue_peek_n(&masked, NULL, 1));
+}
+
+void test_mu_queue_reserve_commit(void) {
+    test_item_t *slot, retrieved;
+    size_t n;
+
+    // Build an item in place and publish it
+    slot = mu_queue_reserve(&test_queue);
+    TEST_ASSERT_EQUAL_PTR(queue_storage, slot);
+    *slot = q_item1;
+    TEST_ASSERT_TRUE(mu_queue_is_empty(&test_queue)); // Not yet committed
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_commit(&test_queue, 1));
+    TEST_ASSERT_EQUAL(1, mu_queue_count(&test_queue));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_get(&test_queue, &retrieved));
+    TEST_ASSERT_EQUAL_MEMORY(&q_item1, &retrieved, sizeof(test_item_t));
+
+    // Head and tail are now at slot 1: a span stops at the end of the store
+    slot = mu_queue_reserve_span(&test_queue, 10, &n);
+    TEST_ASSERT_EQUAL_PTR(queue_storage + sizeof(test_item_t), slot);
+    TEST_ASSERT_EQUAL(TEST_QUEUE_CAPACITY - 1, n);
+    for (size_t i = 0; i < n; ++i) {
+        slot[i] = q_item_fill;
+        slot[i].value = (int)i;
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_commit(&test_queue, n));
+
+    // ...and the rest is at the start
+    slot = mu_queue_reserve_span(&test_queue, 10, &n);
+    TEST_ASSERT_EQUAL_PTR(queue_storage, slot);
+    TEST_ASSERT_EQUAL(1, n);
+    slot->value = 4;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_commit(&test_queue, 1));
+    TEST_ASSERT_TRUE(mu_queue_is_full(&test_queue));
+    for (int i = 0; i < TEST_QUEUE_CAPACITY; ++i) {
+        mu_queue_get(&test_queue, &retrieved);
+        TEST_ASSERT_EQUAL(i, retrieved.value);
+    }
+
+    // Full queue: nothing to reserve, and commit is rejected
+    populate_queue(&test_queue, TEST_QUEUE_CAPACITY);
+    TEST_ASSERT_NULL(mu_queue_reserve(&test_queue));
+    TEST_ASSERT_NULL(mu_queue_reserve_span(&test_queue, 1, &n));
+    TEST_ASSERT_EQUAL(0, n);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_queue_commit(&test_queue, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_commit(&test_queue, 0));
+    TEST_ASSERT_EQUAL(TEST_QUEUE_CAPACITY, mu_queue_count(&test_queue));
+
+    // Masked mode
+    mu_queue_t q;
+    int store[4];
+    mu_queue_init(&q, store, 4, sizeof(int));
+    q.head = q.tail = SIZE_MAX - 1; // Slot 2, counters about to overflow
+    int *span = mu_queue_reserve_span(&q, 4, &n);
+    TEST_ASSERT_EQUAL_PTR(&store[2], span);
+    TEST_ASSERT_EQUAL(2, n);
+    span[0] = 10;
+    span[1] = 11;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_commit(&q, 2));
+    span = mu_queue_reserve_span(&q, 4, &n);
+    TEST_ASSERT_EQUAL_PTR(&store[0], span);
+    TEST_ASSERT_EQUAL(2, n);
+    span[0] = 12;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_commit(&q, 1));
+    int out[3];
+    TEST_ASSERT_EQUAL(3, mu_queue_get_n(&q, out, 4));
+    TEST_ASSERT_EQUAL(10, out[0]);
+    TEST_ASSERT_EQUAL(11, out[1]);
+    TEST_ASSERT_EQUAL(12, out[2]);
+
+    // Invalid parameters
+    TEST_ASSERT_NULL(mu_queue_reserve(NULL));
+    TEST_ASSERT_NULL(mu_queue_reserve_span(NULL, 1, &n));
+    TEST_ASSERT_EQUAL(0, n);
+    TEST_ASSERT_NULL(mu_queue_reserve_span(&q, 1, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_queue_commit(NULL, 1));
+}
+
+void test_mu_queue_front_read_span_release(void) {
+    test_item_t item = q_item_fill;
+    const test_item_t *front;
+    size_t n;
+
+    TEST_ASSERT_NULL(mu_queue_front(&test_queue));
+    TEST_ASSERT_NULL(mu_queue_read_span(&test_queue, 1, &n));
+    TEST_ASSERT_EQUAL(0, n);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY, mu_queue_release(&test_queue, 1));
+
+    // Start at slot 3 so the items wrap
+    populate_queue(&test_queue, 3);
+    TEST_ASSERT_EQUAL(3, mu_queue_get_n(&test_queue, NULL, 3));
+    for (int i = 0; i < 4; ++i) {
+        item.value = i;
+        mu_queue_put(&test_queue, &item);
+    }
+
+    front = mu_queue_front(&test_queue);
+    TEST_ASSERT_EQUAL_PTR(queue_storage + 3 * sizeof(test_item_t), front);
+    TEST_ASSERT_EQUAL(0, front->value);
+    TEST_ASSERT_EQUAL(4, mu_queue_count(&test_queue)); // Not removed
+
+    front = mu_queue_read_span(&test_queue, 10, &n);
+    TEST_ASSERT_EQUAL(2, n); // Slots 3 and 4
+    TEST_ASSERT_EQUAL(0, front[0].value);
+    TEST_ASSERT_EQUAL(1, front[1].value);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_release(&test_queue, n));
+
+    front = mu_queue_read_span(&test_queue, 1, &n);
+    TEST_ASSERT_EQUAL_PTR(queue_storage, front);
+    TEST_ASSERT_EQUAL(1, n);
+    TEST_ASSERT_EQUAL(2, front->value);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY, mu_queue_release(&test_queue, 3));
+    TEST_ASSERT_EQUAL(2, mu_queue_count(&test_queue));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_queue_release(&test_queue, 2));
+    TEST_ASSERT_TRUE(mu_queue_is_empty(&test_queue));
+
+    TEST_ASSERT_NULL(mu_queue_front(NULL));
+    TEST_ASSERT_NULL(mu_queue_read_span(NULL, 1, &n));
+    TEST_ASSERT_NULL(mu_queue_read_span(&test_queue, 1, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_queue_release(NULL, 1));
+}
+
 // *****************************************************************************
 // Main Test Runner
 
@@ -410,8 +718,14 @@ int main(void) {
     RUN_TEST(test_mu_queue_is_full);
     RUN_TEST(test_mu_queue_clear);
     RUN_TEST(test_mu_queue_put);
+    RUN_TEST(test_mu_queue_put_overwrite);
     RUN_TEST(test_mu_queue_get);
     RUN_TEST(test_mu_queue_peek);
+    RUN_TEST(test_mu_queue_masked_mode);
+    RUN_TEST(test_mu_queue_wrap_non_power_of_two);
+    RUN_TEST(test_mu_queue_put_get_peek_n);
+    RUN_TEST(test_mu_queue_reserve_commit);
+    RUN_TEST(test_mu_queue_front_read_span_release);
 
     return UNITY_END();
 }
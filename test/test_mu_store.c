@@ -33,7 +33,9 @@
 #include "fff.h" // Included for completeness, though no fakes are strictly needed for these tests
 #include "mu_store.h"
 #include "unity.h"
+#include <stdbool.h>
 #include <stddef.h> // For size_t
+#include <stdint.h> // For uint32_t
 #include <string.h> // For memcpy, memcmp
 
 DEFINE_FFF_GLOBALS
@@ -66,6 +68,32 @@ static test_item_t working_items[MAX_TEST_ITEMS];
 static test_item_t *working_ptrs[MAX_TEST_ITEMS];
 static size_t current_item_count = 0;
 
+// Larger buffers for exercising the sort engine beyond insertion-sort sizes
+#define LARGE_TEST_ITEMS 2000
+static test_item_t large_items[LARGE_TEST_ITEMS];
+static test_item_t *large_ptrs[LARGE_TEST_ITEMS];
+
+// Items carrying their original position, for checking sort stability
+typedef struct {
+    int key;
+    int seq;
+} seq_item_t;
+static seq_item_t seq_items[LARGE_TEST_ITEMS];
+static seq_item_t *seq_ptrs[LARGE_TEST_ITEMS];
+static seq_item_t seq_scratch[LARGE_TEST_ITEMS];
+
+// Input patterns used to exercise the sort engine
+typedef enum {
+    PATTERN_RANDOM,
+    PATTERN_SORTED,
+    PATTERN_REVERSED,
+    PATTERN_ALL_EQUAL,
+    PATTERN_FEW_UNIQUE,
+    PATTERN_ORGAN_PIPE,
+    PATTERN_SAWTOOTH,
+    PATTERN_COUNT,
+} test_pattern_t;
+
 // *****************************************************************************
 // Private static inline function and function declarations
 
@@ -148,6 +176,98 @@ static _Bool is_pointers_sorted(test_item_t *const *arr, size_t count,
     return 1; // Is sorted
 }
 
+/**
+ * @brief Fill large_items (and large_ptrs) with `count` items in `pattern`.
+ *
+ * Each item's `id` holds a running tag so callers can verify that the result
+ * is a permutation of the input.
+ */
+static void fill_pattern(test_pattern_t pattern, size_t count) {
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < count; ++i) {
+        int value;
+        seed = seed * 1103515245u + 12345u;
+        switch (pattern) {
+        case PATTERN_RANDOM:
+            value = (int)((seed >> 8) % 100000);
+            break;
+        case PATTERN_SORTED:
+            value = (int)i;
+            break;
+        case PATTERN_REVERSED:
+            value = (int)(count - i);
+            break;
+        case PATTERN_ALL_EQUAL:
+            value = 7;
+            break;
+        case PATTERN_FEW_UNIQUE:
+            value = (int)((seed >> 8) % 4);
+            break;
+        case PATTERN_ORGAN_PIPE:
+            value = (int)(i < count / 2 ? i : count - i);
+            break;
+        case PATTERN_SAWTOOTH:
+        default:
+            value = (int)(i % 37);
+            break;
+        }
+        large_items[i] = mk_item(value, (char)(i & 0x7f));
+        large_ptrs[i] = &large_items[i];
+    }
+}
+
+static int compare_seq_by_key(const void *a, const void *b) {
+    const seq_item_t *sa = (const seq_item_t *)a;
+    const seq_item_t *sb = (const seq_item_t *)b;
+    return (sa->key > sb->key) - (sa->key < sb->key);
+}
+
+static int compare_seq_pointers_by_key(const void *a, const void *b) {
+    return compare_seq_by_key(*(const seq_item_t *const *)a,
+                              *(const seq_item_t *const *)b);
+}
+
+/**
+ * @brief Fill seq_items with `count` items whose keys follow `pattern`
+ * (reusing fill_pattern()) and whose `seq` is their original index.
+ */
+static void fill_seq_pattern(test_pattern_t pattern, size_t count) {
+    fill_pattern(pattern, count);
+    for (size_t i = 0; i < count; ++i) {
+        seq_items[i].key = large_items[i].value;
+        seq_items[i].seq = (int)i;
+        seq_ptrs[i] = &seq_items[i];
+    }
+}
+
+/**
+ * @brief Return true if `arr` is sorted by key and equal keys keep ascending
+ * `seq` values.
+ */
+static bool is_seq_stable(seq_item_t *const *arr, size_t count) {
+    for (size_t i = 1; i < count; ++i) {
+        if (arr[i - 1]->key > arr[i]->key) {
+            return false;
+        }
+        if (arr[i - 1]->key == arr[i]->key &&
+            arr[i - 1]->seq >= arr[i]->seq) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Sum of values and ids, used as a cheap permutation check.
+ */
+static long items_checksum(const test_item_t *arr, size_t count) {
+    long sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        sum += arr[i].value * 131L + arr[i].id;
+    }
+    return sum;
+}
+
 // *****************************************************************************
 // Unity Test Setup and Teardown
 
@@ -236,6 +356,29 @@ void test_mu_store_swap_items(void) {
     mu_store_swap_items(NULL, NULL, 0);  // Should not crash
 }
 
+/**
+ * @brief Test mu_store_swap_items across every swap kernel, including odd
+ * sizes and unaligned addresses.
+ */
+void test_mu_store_swap_items_all_sizes(void) {
+    uint8_t buf1[81], buf2[81], expect1[81], expect2[81];
+    for (size_t size = 1; size <= 80; ++size) {
+        for (size_t i = 0; i < sizeof(buf1); ++i) {
+            buf1[i] = (uint8_t)i;
+            buf2[i] = (uint8_t)(0x80 + i);
+        }
+        memcpy(expect1, buf1, sizeof(buf1));
+        memcpy(expect2, buf2, sizeof(buf2));
+        memcpy(expect1 + 1, buf2 + 1, size);
+        memcpy(expect2 + 1, buf1 + 1, size);
+
+        // Offset by one byte so the fixed-size kernels see unaligned data
+        mu_store_swap_items(buf1 + 1, buf2 + 1, size);
+        TEST_ASSERT_EQUAL_MEMORY(expect1, buf1, sizeof(buf1));
+        TEST_ASSERT_EQUAL_MEMORY(expect2, buf2, sizeof(buf2));
+    }
+}
+
 /**
  * @brief Test mu_store_swap_pointers function.
  */
@@ -366,6 +509,36 @@ void test_mu_store_search_duplicates(void) {
                            compare_items_by_value, &(test_item_t){ .value = 20, .id = 'x'}));
 }
 
+void test_mu_store_search_upper(void) {
+    // Array with duplicates [10,20,20,30]
+    working_items[0] = mk_item(10, 'A');
+    working_items[1] = mk_item(20, 'B');
+    working_items[2] = mk_item(20, 'C');
+    working_items[3] = mk_item(30, 'D');
+    current_item_count = 4;
+
+    // Empty array → 0
+    TEST_ASSERT_EQUAL_size_t(
+        0, mu_store_search_upper(working_items, 0, sizeof(test_item_t),
+                                 compare_items_by_value, &(test_item_t){ .value = 20, .id = 'x'}));
+    // Less than first → 0
+    TEST_ASSERT_EQUAL_size_t(
+        0, mu_store_search_upper(working_items, 4, sizeof(test_item_t),
+                                 compare_items_by_value, &(test_item_t){ .value = 5, .id = 'x'}));
+    // Upper bound of 10 → 1
+    TEST_ASSERT_EQUAL_size_t(
+        1, mu_store_search_upper(working_items, 4, sizeof(test_item_t),
+                                 compare_items_by_value, &(test_item_t){ .value = 10, .id = 'x'}));
+    // Upper bound of 20 → just past the last 20 at index 3
+    TEST_ASSERT_EQUAL_size_t(
+        3, mu_store_search_upper(working_items, 4, sizeof(test_item_t),
+                                 compare_items_by_value, &(test_item_t){ .value = 20, .id = 'x'}));
+    // Equal to last → 4
+    TEST_ASSERT_EQUAL_size_t(
+        4, mu_store_search_upper(working_items, 4, sizeof(test_item_t),
+                                 compare_items_by_value, &(test_item_t){ .value = 30, .id = 'x'}));
+}
+
 // *****************************************************************************
 // tests for mu_store_psearch (binary lower‐bound search on pointer arrays)
 
@@ -452,6 +625,34 @@ void test_mu_store_psearch_duplicates(void) {
                             compare_items_by_value, &(test_item_t){ .value = 20, .id = 'x'}));
 }
 
+void test_mu_store_psearch_upper(void) {
+    // Test with duplicates: [10,20,20,30]
+    working_items[0] = mk_item(10, 'A');
+    working_items[1] = mk_item(20, 'B');
+    working_items[2] = mk_item(20, 'C');
+    working_items[3] = mk_item(30, 'D');
+    for (size_t i = 0; i < 4; ++i) {
+        working_ptrs[i] = &working_items[i];
+    }
+    current_item_count = 4;
+
+    TEST_ASSERT_EQUAL_size_t(
+        0, mu_store_psearch_upper((const void *const *)working_ptrs, 0,
+                                  compare_items_by_value, &(test_item_t){ .value = 20, .id = 'x'}));
+    TEST_ASSERT_EQUAL_size_t(
+        0, mu_store_psearch_upper((const void *const *)working_ptrs, 4,
+                                  compare_items_by_value, &(test_item_t){ .value = 5, .id = 'x'}));
+    TEST_ASSERT_EQUAL_size_t(
+        3, mu_store_psearch_upper((const void *const *)working_ptrs, 4,
+                                  compare_items_by_value, &(test_item_t){ .value = 20, .id = 'x'}));
+    TEST_ASSERT_EQUAL_size_t(
+        3, mu_store_psearch_upper((const void *const *)working_ptrs, 4,
+                                  compare_items_by_value, &(test_item_t){ .value = 25, .id = 'x'}));
+    TEST_ASSERT_EQUAL_size_t(
+        4, mu_store_psearch_upper((const void *const *)working_ptrs, 4,
+                                  compare_items_by_value, &(test_item_t){ .value = 30, .id = 'x'}));
+}
+
 // *****************************************************************************
 // mu_store_sort
 
@@ -870,6 +1071,1101 @@ void test_mu_store_psort_invalid_params(void) {
     TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, err);
 }
 
+/**
+ * @brief Test mu_store_sort on large inputs with adversarial patterns.
+ */
+void test_mu_store_sort_large_patterns(void) {
+    static const size_t sizes[] = {23, 24, 25, 129, 500, LARGE_TEST_ITEMS};
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            size_t n = sizes[s];
+            fill_pattern((test_pattern_t)p, n);
+            long before = items_checksum(large_items, n);
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_sort(large_items, n, sizeof(test_item_t),
+                                            compare_items_by_value));
+            TEST_ASSERT_TRUE(
+                is_items_sorted(large_items, n, compare_items_by_value));
+            TEST_ASSERT_EQUAL_INT64(before, items_checksum(large_items, n));
+        }
+    }
+}
+
+/**
+ * @brief Test mu_store_psort on large inputs with adversarial patterns.
+ */
+void test_mu_store_psort_large_patterns(void) {
+    static const size_t sizes[] = {23, 24, 25, 129, 500, LARGE_TEST_ITEMS};
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            size_t n = sizes[s];
+            fill_pattern((test_pattern_t)p, n);
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_psort((void **)large_ptrs, n,
+                                             compare_pointers_by_value));
+            TEST_ASSERT_TRUE(
+                is_pointers_sorted(large_ptrs, n, compare_pointers_by_value));
+            // Every item must still be referenced exactly once
+            for (size_t i = 0; i < n; ++i) {
+                large_ptrs[i]->id = (char)0x80;
+            }
+            for (size_t i = 0; i < n; ++i) {
+                TEST_ASSERT_EQUAL_HEX8(0x80, (uint8_t)large_items[i].id);
+            }
+        }
+    }
+}
+
+// *****************************************************************************
+// mu_store_stable_sort / mu_store_stable_psort
+
+/**
+ * @brief Test that mu_store_stable_sort keeps equal items in input order,
+ * with no scratch, a little scratch, and enough scratch for every merge.
+ */
+void test_mu_store_stable_sort_patterns(void) {
+    static const size_t sizes[] = {1, 31, 64, 500, LARGE_TEST_ITEMS};
+    static const size_t scratch_counts[] = {0, 7, LARGE_TEST_ITEMS / 2};
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            for (size_t k = 0; k < 3; ++k) {
+                size_t n = sizes[s];
+                fill_seq_pattern((test_pattern_t)p, n);
+                TEST_ASSERT_EQUAL(
+                    MU_STORE_ERR_NONE,
+                    mu_store_stable_sort(seq_items, n, sizeof(seq_item_t),
+                                         compare_seq_by_key, seq_scratch,
+                                         scratch_counts[k]));
+                for (size_t i = 0; i < n; ++i) {
+                    seq_ptrs[i] = &seq_items[i];
+                }
+                TEST_ASSERT_TRUE(is_seq_stable(seq_ptrs, n));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Test that mu_store_stable_psort keeps equal items in input order.
+ */
+void test_mu_store_stable_psort_patterns(void) {
+    static void *ptr_scratch[LARGE_TEST_ITEMS / 2];
+    static const size_t scratch_counts[] = {0, 7, LARGE_TEST_ITEMS / 2};
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        for (size_t k = 0; k < 3; ++k) {
+            fill_seq_pattern((test_pattern_t)p, LARGE_TEST_ITEMS);
+            TEST_ASSERT_EQUAL(
+                MU_STORE_ERR_NONE,
+                mu_store_stable_psort((void **)seq_ptrs, LARGE_TEST_ITEMS,
+                                      compare_seq_pointers_by_key,
+                                      ptr_scratch, scratch_counts[k]));
+            TEST_ASSERT_TRUE(is_seq_stable(seq_ptrs, LARGE_TEST_ITEMS));
+        }
+    }
+}
+
+// Order-preserving unsigned key of a seq_item_t's signed key
+static uint64_t seq_key(const void *item) {
+    int64_t key = ((const seq_item_t *)item)->key;
+    return (uint64_t)key ^ (UINT64_C(1) << 63);
+}
+
+/**
+ * @brief Test mu_store_psort_by_key on every pattern with both the radix
+ * (stable) and pdqsort scratch sizes.
+ */
+void test_mu_store_psort_by_key_patterns(void) {
+    static mu_store_key_pair_t pairs[LARGE_TEST_ITEMS * 2];
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        fill_seq_pattern((test_pattern_t)p, LARGE_TEST_ITEMS);
+        seq_items[0].key = -5; // exercise the signed key mapping
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_store_psort_by_key((void **)seq_ptrs,
+                                                LARGE_TEST_ITEMS, seq_key,
+                                                pairs, LARGE_TEST_ITEMS * 2));
+        TEST_ASSERT_TRUE(is_seq_stable(seq_ptrs, LARGE_TEST_ITEMS));
+        TEST_ASSERT_EQUAL_INT(-5, seq_ptrs[0]->key);
+
+        fill_seq_pattern((test_pattern_t)p, LARGE_TEST_ITEMS);
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_store_psort_by_key((void **)seq_ptrs,
+                                                LARGE_TEST_ITEMS, seq_key,
+                                                pairs, LARGE_TEST_ITEMS));
+        int64_t tag_sum = 0;
+        for (size_t i = 0; i < LARGE_TEST_ITEMS; ++i) {
+            TEST_ASSERT_TRUE(i == 0 || seq_ptrs[i - 1]->key <= seq_ptrs[i]->key);
+            tag_sum += seq_ptrs[i]->seq;
+        }
+        TEST_ASSERT_EQUAL_INT64((int64_t)LARGE_TEST_ITEMS *
+                                    (LARGE_TEST_ITEMS - 1) / 2,
+                                tag_sum);
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_psort_by_key(NULL, 1, seq_key, pairs, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_psort_by_key((void **)seq_ptrs, 1, NULL, pairs,
+                                            1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_psort_by_key((void **)seq_ptrs, 1, seq_key,
+                                            NULL, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_psort_by_key((void **)seq_ptrs, 3, seq_key,
+                                            pairs, 2));
+}
+
+/**
+ * @brief Test mu_store_stable_sort with invalid parameters.
+ */
+void test_mu_store_stable_sort_invalid_params(void) {
+    load_test_data(test_data_3_unsorted, 3);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_stable_sort(NULL, 3, sizeof(test_item_t),
+                                           compare_items_by_value, NULL, 0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_stable_sort(working_items, 3,
+                                           sizeof(test_item_t), NULL, NULL,
+                                           0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_stable_sort(working_items, 3, 0,
+                                           compare_items_by_value, NULL, 0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_stable_psort(NULL, 3, compare_pointers_by_value,
+                                            NULL, 0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_stable_psort((void **)working_ptrs, 3, NULL,
+                                            NULL, 0));
+}
+
+// mu_store_radix_sort
+
+/**
+ * @brief Test that mu_store_radix_sort sorts signed keys stably across input
+ * patterns and sizes on both sides of the insertion sort cutoff.
+ */
+void test_mu_store_radix_sort_patterns(void) {
+    static const size_t sizes[] = {1, 31, 64, 500, LARGE_TEST_ITEMS};
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            size_t n = sizes[s];
+            fill_seq_pattern((test_pattern_t)p, n);
+            // Shift half the keys negative to exercise the sign handling.
+            for (size_t i = 0; i < n; ++i) {
+                seq_items[i].key -= (int)(i % 2) * 50000;
+            }
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_radix_sort(
+                                  seq_items, n, sizeof(seq_item_t),
+                                  offsetof(seq_item_t, key), sizeof(int),
+                                  MU_STORE_RADIX_SIGNED, seq_scratch));
+            TEST_ASSERT_TRUE(is_seq_stable(seq_ptrs, n));
+        }
+    }
+}
+
+/**
+ * @brief Test mu_store_radix_sort on unsigned, float and double keys, and in
+ * descending order.
+ */
+void test_mu_store_radix_sort_key_types(void) {
+    uint8_t bytes[] = {200, 3, 255, 0, 17, 3};
+    uint8_t bytes_sorted[] = {0, 3, 3, 17, 200, 255};
+    uint8_t bytes_scratch[6];
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_radix_sort(bytes, 6, 1, 0, 1,
+                                          MU_STORE_RADIX_UNSIGNED,
+                                          bytes_scratch));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes_sorted, bytes, 6);
+
+    float floats[] = {2.5f, -0.0f, -1e30f, 0.0f, -3.25f, 1e-30f, 7.0f};
+    float floats_sorted[] = {-1e30f, -3.25f, -0.0f, 0.0f, 1e-30f, 2.5f, 7.0f};
+    float floats_scratch[7];
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_radix_sort(floats, 7, sizeof(float), 0,
+                                          sizeof(float), MU_STORE_RADIX_FLOAT,
+                                          floats_scratch));
+    TEST_ASSERT_EQUAL_MEMORY(floats_sorted, floats, sizeof(floats));
+
+    // Enough doubles to take the radix path rather than insertion sort.
+    static double doubles[100];
+    static double doubles_scratch[100];
+    for (int i = 0; i < 100; ++i) {
+        doubles[i] = (double)((i * 37) % 100 - 50) / 4.0;
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_radix_sort(doubles, 100, sizeof(double), 0,
+                                          sizeof(double),
+                                          MU_STORE_RADIX_FLOAT |
+                                              MU_STORE_RADIX_DESCENDING,
+                                          doubles_scratch));
+    for (int i = 0; i < 100; ++i) {
+        TEST_ASSERT_TRUE(doubles[i] == (double)(49 - i) / 4.0);
+    }
+
+    static uint64_t wide[100];
+    static uint64_t wide_scratch[100];
+    for (int i = 0; i < 100; ++i) {
+        wide[i] = ((uint64_t)(i % 10) << 56) | (uint64_t)(99 - i);
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_radix_sort(wide, 100, sizeof(uint64_t), 0,
+                                          sizeof(uint64_t),
+                                          MU_STORE_RADIX_UNSIGNED,
+                                          wide_scratch));
+    for (int i = 1; i < 100; ++i) {
+        TEST_ASSERT_TRUE(wide[i - 1] < wide[i]);
+    }
+}
+
+/**
+ * @brief Test mu_store_radix_sort with invalid parameters.
+ */
+void test_mu_store_radix_sort_invalid_params(void) {
+    size_t size = sizeof(seq_item_t);
+    size_t off = offsetof(seq_item_t, key);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_radix_sort(NULL, 3, size, off, 4,
+                                          MU_STORE_RADIX_SIGNED, seq_scratch));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_radix_sort(seq_items, 3, size, off, 4,
+                                          MU_STORE_RADIX_SIGNED, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_radix_sort(seq_items, 3, 0, 0, 4,
+                                          MU_STORE_RADIX_SIGNED, seq_scratch));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_radix_sort(seq_items, 3, size, off, 3,
+                                          MU_STORE_RADIX_SIGNED, seq_scratch));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_radix_sort(seq_items, 3, size, size - 2, 4,
+                                          MU_STORE_RADIX_SIGNED, seq_scratch));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_radix_sort(seq_items, 3, size, off, 2,
+                                          MU_STORE_RADIX_FLOAT, seq_scratch));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_radix_sort(seq_items, 3, size, off, 4,
+                                          (mu_store_radix_flags_t)0x03,
+                                          seq_scratch));
+}
+
+// mu_store_search_many / mu_store_psearch_many
+
+// Large enough (over 256KB) that unsorted batches take the interleaved path.
+#define MANY_TABLE_ITEMS 70000
+#define MANY_QUERY_ITEMS 500
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t ua = *(const uint32_t *)a;
+    uint32_t ub = *(const uint32_t *)b;
+    return (ua > ub) - (ua < ub);
+}
+
+/**
+ * @brief Test that mu_store_search_many and mu_store_psearch_many agree with
+ * per-key searches for sorted, partly sorted and random query batches.
+ */
+void test_mu_store_search_many(void) {
+    static uint32_t table[MANY_TABLE_ITEMS];
+    static const void *table_ptrs[MANY_TABLE_ITEMS];
+    static uint32_t queries[MANY_QUERY_ITEMS];
+    static const void *query_ptrs[MANY_QUERY_ITEMS];
+    static size_t results[MANY_QUERY_ITEMS];
+    static size_t presults[MANY_QUERY_ITEMS];
+    static const size_t sizes[] = {0, 1, 5, 300, MANY_TABLE_ITEMS};
+
+    for (size_t i = 0; i < MANY_TABLE_ITEMS; ++i) {
+        table[i] = (uint32_t)(i / 2) * 3; // pairs of duplicates
+        table_ptrs[i] = &table[i];
+    }
+    for (size_t t = 0; t < sizeof(sizes) / sizeof(sizes[0]); ++t) {
+        size_t n = sizes[t];
+        for (int order = 0; order < 3; ++order) {
+            uint32_t seed = 777;
+            for (size_t i = 0; i < MANY_QUERY_ITEMS; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                queries[i] = order == 2 ? (seed >> 8) % (uint32_t)(n * 2 + 4)
+                                        : (uint32_t)(i * n * 2 / 400);
+                query_ptrs[i] = &queries[i];
+            }
+            if (order == 1) {
+                queries[MANY_QUERY_ITEMS / 2] = 0; // sorted, then not
+            }
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_search_many(table, n, sizeof(uint32_t),
+                                                   compare_u32, queries,
+                                                   MANY_QUERY_ITEMS, results));
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_psearch_many(
+                                  table_ptrs, n, compare_u32, query_ptrs,
+                                  MANY_QUERY_ITEMS, presults));
+            for (size_t i = 0; i < MANY_QUERY_ITEMS; ++i) {
+                size_t expected = mu_store_search(
+                    table, n, sizeof(uint32_t), compare_u32, &queries[i]);
+                TEST_ASSERT_EQUAL_size_t(expected, results[i]);
+                TEST_ASSERT_EQUAL_size_t(expected, presults[i]);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Test mu_store_search_many and mu_store_psearch_many with invalid
+ * parameters.
+ */
+void test_mu_store_search_many_invalid_params(void) {
+    uint32_t table[2] = {1, 2};
+    const void *ptrs[2] = {&table[0], &table[1]};
+    size_t results[2];
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_search_many(NULL, 2, sizeof(uint32_t),
+                                           compare_u32, table, 2, results));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_search_many(table, 2, 0, compare_u32, table, 2,
+                                           results));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_search_many(table, 2, sizeof(uint32_t), NULL,
+                                           table, 2, results));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_search_many(table, 2, sizeof(uint32_t),
+                                           compare_u32, table, 2, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_search_many(table, 2, sizeof(uint32_t),
+                                           compare_u32, NULL, 0, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_psearch_many(ptrs, 2, compare_u32, NULL, 2,
+                                            results));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_psearch_many(ptrs, 2, NULL, ptrs, 2, results));
+}
+
+// *****************************************************************************
+// mu_store_search_from / mu_store_psearch_from / mu_store_interp_search
+
+// Calls made by the counting comparison below
+static size_t compare_calls;
+
+static int compare_u32_counted(const void *a, const void *b) {
+    compare_calls++;
+    return compare_u32(a, b);
+}
+
+/**
+ * @brief Test that the hinted searches agree with mu_store_search for every
+ * hint, and that a hint at the answer costs O(1) comparisons.
+ */
+void test_mu_store_search_from(void) {
+    static uint32_t table[300];
+    static const void *table_ptrs[300];
+    static const size_t sizes[] = {0, 1, 2, 7, 300};
+
+    for (size_t i = 0; i < 300; ++i) {
+        table[i] = (uint32_t)(i / 3) * 2; // triples of even numbers
+        table_ptrs[i] = &table[i];
+    }
+    for (size_t t = 0; t < sizeof(sizes) / sizeof(sizes[0]); ++t) {
+        size_t n = sizes[t];
+        for (uint32_t key = 0; key <= n + 1; ++key) {
+            size_t expected =
+                mu_store_search(table, n, sizeof(uint32_t), compare_u32, &key);
+            for (size_t hint = 0; hint <= n + 2; ++hint) {
+                TEST_ASSERT_EQUAL_size_t(
+                    expected,
+                    mu_store_search_from(table, n, sizeof(uint32_t),
+                                         compare_u32, &key, hint));
+                TEST_ASSERT_EQUAL_size_t(
+                    expected, mu_store_psearch_from(table_ptrs, n,
+                                                    compare_u32, &key, hint));
+            }
+        }
+    }
+
+    // Appending past the end with the previous result as the hint.
+    uint32_t key = 1000;
+    compare_calls = 0;
+    TEST_ASSERT_EQUAL_size_t(300, mu_store_search_from(table, 300,
+                                                       sizeof(uint32_t),
+                                                       compare_u32_counted,
+                                                       &key, 300));
+    TEST_ASSERT_EQUAL_size_t(1, compare_calls);
+}
+
+/**
+ * @brief Test mu_store_interp_search against mu_store_search for uniform,
+ * skewed and duplicated keys of several types.
+ */
+void test_mu_store_interp_search(void) {
+    size_t n = LARGE_TEST_ITEMS;
+    size_t index;
+
+    // Uniform, then skewed (quadratic), then heavily duplicated keys.
+    for (int shape = 0; shape < 3; ++shape) {
+        for (size_t i = 0; i < n; ++i) {
+            int v = shape == 0   ? (int)i * 7 - 5000
+                    : shape == 1 ? (int)(i * i / 50)
+                                 : (int)(i / 500);
+            seq_items[i].key = v;
+            seq_items[i].seq = (int)i;
+        }
+        for (int key = -6000; key < 81000; key += 37) {
+            size_t expected = mu_store_search(seq_items, n, sizeof(seq_item_t),
+                                              compare_seq_by_key,
+                                              &(seq_item_t){.key = key});
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_interp_search(
+                                  seq_items, n, sizeof(seq_item_t),
+                                  offsetof(seq_item_t, key), sizeof(int),
+                                  MU_STORE_RADIX_SIGNED, &key, &index));
+            TEST_ASSERT_EQUAL_size_t(expected, index);
+        }
+    }
+
+    // Descending doubles.
+    static double doubles[100];
+    for (size_t i = 0; i < 100; ++i) {
+        doubles[i] = 25.0 - (double)i * 0.5;
+    }
+    double key = 0.25; // between 0.5 (index 49) and 0.0 (index 50)
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_interp_search(
+                          doubles, 100, sizeof(double), 0, sizeof(double),
+                          MU_STORE_RADIX_FLOAT | MU_STORE_RADIX_DESCENDING,
+                          &key, &index));
+    TEST_ASSERT_EQUAL_size_t(50, index);
+    key = -100.0;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_interp_search(
+                          doubles, 100, sizeof(double), 0, sizeof(double),
+                          MU_STORE_RADIX_FLOAT | MU_STORE_RADIX_DESCENDING,
+                          &key, &index));
+    TEST_ASSERT_EQUAL_size_t(100, index);
+
+    // Empty array and invalid parameters.
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_interp_search(NULL, 0, sizeof(double), 0,
+                                             sizeof(double),
+                                             MU_STORE_RADIX_FLOAT, &key,
+                                             &index));
+    TEST_ASSERT_EQUAL_size_t(0, index);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_interp_search(doubles, 100, sizeof(double), 4,
+                                             sizeof(double),
+                                             MU_STORE_RADIX_FLOAT, &key,
+                                             &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_interp_search(doubles, 100, sizeof(double), 0,
+                                             3, MU_STORE_RADIX_UNSIGNED, &key,
+                                             &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_interp_search(doubles, 100, sizeof(double), 0,
+                                             sizeof(double),
+                                             MU_STORE_RADIX_FLOAT, NULL,
+                                             &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_interp_search(doubles, 100, sizeof(double), 0,
+                                             sizeof(double),
+                                             MU_STORE_RADIX_FLOAT, &key,
+                                             NULL));
+}
+
+// *****************************************************************************
+// mu_store_find_eq / mu_store_count_eq / mu_store_find_range
+
+// Fields of every scanned width, at unaligned strides.
+typedef struct {
+    uint8_t u8;
+    int16_t i16;
+    uint32_t u32;
+    int64_t i64;
+    float f32;
+    double f64;
+} scan_item_t;
+
+static scan_item_t scan_items[LARGE_TEST_ITEMS];
+
+static void fill_scan_items(size_t count) {
+    uint32_t seed = 99;
+    for (size_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        int v = (int)((seed >> 8) % 64) - 32;
+        scan_items[i].u8 = (uint8_t)v;
+        scan_items[i].i16 = (int16_t)(v * 500);
+        scan_items[i].u32 = (uint32_t)v;
+        scan_items[i].i64 = (int64_t)v * ((int64_t)1 << 40);
+        scan_items[i].f32 = (float)v * 0.5f;
+        scan_items[i].f64 = (double)v * 0.25;
+    }
+}
+
+/**
+ * @brief Compare find_eq and count_eq on the field at `offset` against a
+ * memcmp reference, for each value found in the first 40 items.
+ */
+static void check_eq_scan(size_t n, size_t item_size, size_t offset,
+                          size_t width) {
+    const uint8_t *base = (const uint8_t *)scan_items;
+    for (size_t probe = 0; probe < 40 && probe < n; ++probe) {
+        const uint8_t *value = base + probe * item_size + offset;
+        size_t first = n, count = 0;
+        for (size_t i = 0; i < n; ++i) {
+            if (memcmp(base + i * item_size + offset, value, width) == 0) {
+                first = first < i ? first : i;
+                count++;
+            }
+        }
+        size_t index, found;
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_store_find_eq(base, n, item_size, offset, width,
+                                           value, &index));
+        TEST_ASSERT_EQUAL_size_t(first, index);
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_store_count_eq(base, n, item_size, offset, width,
+                                            value, &found));
+        TEST_ASSERT_EQUAL_size_t(count, found);
+    }
+}
+
+void test_mu_store_find_eq_and_count_eq(void) {
+    // Sizes around the vector block lengths exercise the scalar tails.
+    static const size_t sizes[] = {1, 3, 4, 7, 8, 9, 17, 100,
+                                   LARGE_TEST_ITEMS};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        size_t n = sizes[s];
+        size_t size = sizeof(scan_item_t);
+        fill_scan_items(n);
+        check_eq_scan(n, size, offsetof(scan_item_t, u8), 1);
+        check_eq_scan(n, size, offsetof(scan_item_t, i16), 2);
+        check_eq_scan(n, size, offsetof(scan_item_t, u32), 4);
+        check_eq_scan(n, size, offsetof(scan_item_t, i64), 8);
+        check_eq_scan(n, size, offsetof(scan_item_t, f64), 8);
+        // Packed arrays of 4- and 8-byte values.
+        check_eq_scan(n * size / 4, 4, 0, 4);
+        check_eq_scan(n * size / 8, 8, 0, 8);
+    }
+
+    size_t index, count;
+    uint32_t absent = 1000;
+    fill_scan_items(100);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND,
+                      mu_store_find_eq(scan_items, 100, sizeof(scan_item_t),
+                                       offsetof(scan_item_t, u32), 4, &absent,
+                                       &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_count_eq(scan_items, 100, sizeof(scan_item_t),
+                                        offsetof(scan_item_t, u32), 4, &absent,
+                                        &count));
+    TEST_ASSERT_EQUAL_size_t(0, count);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND,
+                      mu_store_find_eq(NULL, 0, sizeof(scan_item_t), 0, 4,
+                                       &absent, &index));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_find_eq(NULL, 1, sizeof(scan_item_t), 0, 4,
+                                       &absent, &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_find_eq(scan_items, 1, sizeof(scan_item_t), 0,
+                                       3, &absent, &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_find_eq(scan_items, 1, sizeof(scan_item_t),
+                                       sizeof(scan_item_t) - 2, 4, &absent,
+                                       &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_find_eq(scan_items, 1, sizeof(scan_item_t), 0,
+                                       4, NULL, &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_count_eq(scan_items, 1, sizeof(scan_item_t), 0,
+                                        4, &absent, NULL));
+}
+
+void test_mu_store_find_range(void) {
+    size_t n = LARGE_TEST_ITEMS;
+    size_t size = sizeof(scan_item_t);
+    size_t index;
+    fill_scan_items(n);
+
+    for (int lo = -34; lo <= 34; lo += 3) {
+        for (int width = 0; width <= 5; ++width) {
+            int hi = lo + width;
+            size_t first = n;
+            for (size_t i = 0; i < n && first == n; ++i) {
+                int v = (int)(scan_items[i].f64 * 4.0);
+                if (v >= lo && v <= hi) {
+                    first = i;
+                }
+            }
+            mu_store_err_t expected =
+                first < n ? MU_STORE_ERR_NONE : MU_STORE_ERR_NOTFOUND;
+
+            int16_t lo16 = (int16_t)(lo * 500), hi16 = (int16_t)(hi * 500);
+            int64_t lo64 = lo * ((int64_t)1 << 40), hi64 = hi * ((int64_t)1 << 40);
+            float lof = (float)lo * 0.5f, hif = (float)hi * 0.5f;
+            double lod = lo * 0.25, hid = hi * 0.25;
+            index = n;
+            TEST_ASSERT_EQUAL(expected,
+                              mu_store_find_range(
+                                  scan_items, n, size,
+                                  offsetof(scan_item_t, i16), 2,
+                                  MU_STORE_RADIX_SIGNED, &lo16, &hi16, &index));
+            TEST_ASSERT_EQUAL_size_t(first, index);
+            index = n;
+            TEST_ASSERT_EQUAL(expected,
+                              mu_store_find_range(
+                                  scan_items, n, size,
+                                  offsetof(scan_item_t, i64), 8,
+                                  MU_STORE_RADIX_SIGNED, &lo64, &hi64, &index));
+            TEST_ASSERT_EQUAL_size_t(first, index);
+            index = n;
+            TEST_ASSERT_EQUAL(expected,
+                              mu_store_find_range(
+                                  scan_items, n, size,
+                                  offsetof(scan_item_t, f32), 4,
+                                  MU_STORE_RADIX_FLOAT, &lof, &hif, &index));
+            TEST_ASSERT_EQUAL_size_t(first, index);
+            index = n;
+            TEST_ASSERT_EQUAL(expected,
+                              mu_store_find_range(
+                                  scan_items, n, size,
+                                  offsetof(scan_item_t, f64), 8,
+                                  MU_STORE_RADIX_FLOAT |
+                                      MU_STORE_RADIX_DESCENDING,
+                                  &lod, &hid, &index));
+            TEST_ASSERT_EQUAL_size_t(first, index);
+        }
+    }
+
+    // Unsigned: negative values are large, and reversed bounds match nothing.
+    uint32_t lo32 = 0, hi32 = 31;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_find_range(scan_items, n, size,
+                                          offsetof(scan_item_t, u32), 4,
+                                          MU_STORE_RADIX_UNSIGNED, &lo32,
+                                          &hi32, &index));
+    TEST_ASSERT_TRUE(scan_items[index].u32 <= 31);
+    for (size_t i = 0; i < index; ++i) {
+        TEST_ASSERT_TRUE(scan_items[i].u32 > 31);
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND,
+                      mu_store_find_range(scan_items, n, size,
+                                          offsetof(scan_item_t, u32), 4,
+                                          MU_STORE_RADIX_UNSIGNED, &hi32,
+                                          &lo32, &index));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_find_range(scan_items, n, size,
+                                          offsetof(scan_item_t, i16), 2,
+                                          MU_STORE_RADIX_FLOAT, &lo32, &hi32,
+                                          &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_find_range(scan_items, n, size, 0, 4,
+                                          MU_STORE_RADIX_UNSIGNED, NULL,
+                                          &hi32, &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_find_range(scan_items, n, size, 0, 4,
+                                          MU_STORE_RADIX_UNSIGNED, &lo32,
+                                          &hi32, NULL));
+}
+
+// *****************************************************************************
+// mu_store_select / mu_store_partial_sort / mu_store_topk
+
+// Sorted copy of large_items, and an output buffer for the top-k tests
+static test_item_t sorted_items[LARGE_TEST_ITEMS];
+static test_item_t topk_items[LARGE_TEST_ITEMS];
+static test_item_t *topk_ptrs[LARGE_TEST_ITEMS];
+
+/**
+ * @brief Fill large_items with `pattern` and keep a sorted copy of it in
+ * sorted_items.
+ */
+static void fill_pattern_with_reference(test_pattern_t pattern, size_t count) {
+    fill_pattern(pattern, count);
+    memcpy(sorted_items, large_items, count * sizeof(test_item_t));
+    mu_store_sort(sorted_items, count, sizeof(test_item_t),
+                  compare_items_by_value);
+}
+
+/**
+ * @brief Test that mu_store_select places the nth item and partitions the
+ * rest around it, for several patterns, sizes and positions.
+ */
+void test_mu_store_select_patterns(void) {
+    static const size_t sizes[] = {1, 23, 24, 129, 500, LARGE_TEST_ITEMS};
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            size_t n = sizes[s];
+            size_t positions[] = {0, n / 3, n / 2, n - 1};
+            for (size_t k = 0; k < 4; ++k) {
+                size_t nth = positions[k];
+                fill_pattern_with_reference((test_pattern_t)p, n);
+                long before = items_checksum(large_items, n);
+                TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                                  mu_store_select(large_items, n,
+                                                  sizeof(test_item_t), nth,
+                                                  compare_items_by_value));
+                int pivot = large_items[nth].value;
+                TEST_ASSERT_EQUAL_INT(sorted_items[nth].value, pivot);
+                for (size_t i = 0; i < n; ++i) {
+                    if (i < nth) {
+                        TEST_ASSERT_TRUE(large_items[i].value <= pivot);
+                    } else {
+                        TEST_ASSERT_TRUE(large_items[i].value >= pivot);
+                    }
+                }
+                TEST_ASSERT_EQUAL_INT64(before, items_checksum(large_items, n));
+            }
+        }
+    }
+}
+
+/**
+ * @brief Test mu_store_partial_sort and mu_store_topk against a full sort.
+ */
+void test_mu_store_partial_sort_and_topk(void) {
+    static const size_t ks[] = {0, 1, 10, 100, LARGE_TEST_ITEMS - 1,
+                                LARGE_TEST_ITEMS + 5};
+    size_t n = LARGE_TEST_ITEMS;
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        for (size_t j = 0; j < sizeof(ks) / sizeof(ks[0]); ++j) {
+            size_t k = ks[j];
+            size_t m = k < n ? k : n;
+
+            // topk leaves the input alone and copies out the first m items.
+            fill_pattern_with_reference((test_pattern_t)p, n);
+            long before = items_checksum(large_items, n);
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_topk(large_items, n,
+                                            sizeof(test_item_t), k,
+                                            compare_items_by_value,
+                                            topk_items));
+            TEST_ASSERT_EQUAL_INT64(before, items_checksum(large_items, n));
+            for (size_t i = 0; i < m; ++i) {
+                TEST_ASSERT_EQUAL_INT(sorted_items[i].value,
+                                      topk_items[i].value);
+            }
+
+            // partial_sort sorts the first m items in place.
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_partial_sort(large_items, n,
+                                                    sizeof(test_item_t), k,
+                                                    compare_items_by_value));
+            TEST_ASSERT_EQUAL_INT64(before, items_checksum(large_items, n));
+            for (size_t i = 0; i < m; ++i) {
+                TEST_ASSERT_EQUAL_INT(sorted_items[i].value,
+                                      large_items[i].value);
+            }
+            for (size_t i = m; i < n; ++i) {
+                TEST_ASSERT_TRUE(m == 0 || large_items[i].value >=
+                                               large_items[m - 1].value);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Test the pointer variants of select, partial sort and top-k.
+ */
+void test_mu_store_pselect_partial_psort_ptopk(void) {
+    size_t n = 500;
+    fill_pattern_with_reference(PATTERN_RANDOM, n);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_ptopk((void *const *)large_ptrs, n, 20,
+                                     compare_pointers_by_value,
+                                     (void **)topk_ptrs));
+    for (size_t i = 0; i < 20; ++i) {
+        TEST_ASSERT_EQUAL_INT(sorted_items[i].value, topk_ptrs[i]->value);
+        TEST_ASSERT_EQUAL_PTR(&large_items[i], large_ptrs[i]); // untouched
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_pselect((void **)large_ptrs, n, n / 2,
+                                       compare_pointers_by_value));
+    TEST_ASSERT_EQUAL_INT(sorted_items[n / 2].value, large_ptrs[n / 2]->value);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_partial_psort((void **)large_ptrs, n, 30,
+                                             compare_pointers_by_value));
+    for (size_t i = 0; i < 30; ++i) {
+        TEST_ASSERT_EQUAL_INT(sorted_items[i].value, large_ptrs[i]->value);
+    }
+}
+
+void test_mu_store_select_invalid_params(void) {
+    load_test_data(test_data_3_unsorted, 3);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_select(NULL, 3, sizeof(test_item_t), 0,
+                                      compare_items_by_value));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_select(working_items, 3, sizeof(test_item_t), 3,
+                                      compare_items_by_value));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_select(working_items, 0, sizeof(test_item_t), 0,
+                                      compare_items_by_value));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_pselect((void **)working_ptrs, 3, 0, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_partial_sort(working_items, 3, 0, 1,
+                                            compare_items_by_value));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_partial_psort(NULL, 3, 1,
+                                             compare_pointers_by_value));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_topk(working_items, 3, sizeof(test_item_t), 1,
+                                    compare_items_by_value, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_ptopk((void *const *)working_ptrs, 3, 1, NULL,
+                                     (void **)topk_ptrs));
+    // k == 0 needs no output buffer
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_topk(working_items, 3, sizeof(test_item_t), 0,
+                                    compare_items_by_value, NULL));
+}
+
+// *****************************************************************************
+// mu_store_argsort / mu_store_apply_permutation
+
+// A record wider than the permutation's stack buffer
+typedef struct {
+    int key;
+    uint8_t payload[300];
+} wide_item_t;
+
+static wide_item_t wide_items[LARGE_TEST_ITEMS];
+static size_t perm_indices[LARGE_TEST_ITEMS];
+static uint32_t perm_indices32[LARGE_TEST_ITEMS];
+
+static int compare_wide_by_key(const void *a, const void *b) {
+    int ka = ((const wide_item_t *)a)->key;
+    int kb = ((const wide_item_t *)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+/**
+ * @brief Test that argsort yields a stable sorting permutation and that
+ * applying it sorts the array, for both index widths.
+ */
+void test_mu_store_argsort_and_apply_permutation(void) {
+    static const size_t sizes[] = {0, 1, 23, 500, LARGE_TEST_ITEMS};
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            size_t n = sizes[s];
+            fill_seq_pattern((test_pattern_t)p, n);
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_argsort(seq_items, n,
+                                               sizeof(seq_item_t),
+                                               compare_seq_by_key,
+                                               perm_indices, sizeof(size_t)));
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_argsort(seq_items, n,
+                                               sizeof(seq_item_t),
+                                               compare_seq_by_key,
+                                               perm_indices32,
+                                               sizeof(uint32_t)));
+            for (size_t i = 0; i < n; ++i) {
+                TEST_ASSERT_EQUAL_UINT32(perm_indices[i], perm_indices32[i]);
+                seq_ptrs[i] = &seq_items[perm_indices[i]];
+            }
+            TEST_ASSERT_TRUE(is_seq_stable(seq_ptrs, n));
+
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_apply_permutation(
+                                  seq_items, n, sizeof(seq_item_t),
+                                  perm_indices32, sizeof(uint32_t)));
+            for (size_t i = 0; i < n; ++i) {
+                TEST_ASSERT_EQUAL_INT((int)perm_indices32[i],
+                                      seq_items[i].seq);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Test applying one permutation to a wide array and a parallel array.
+ */
+void test_mu_store_apply_permutation_wide_items(void) {
+    size_t n = LARGE_TEST_ITEMS;
+    fill_pattern(PATTERN_FEW_UNIQUE, n);
+    for (size_t i = 0; i < n; ++i) {
+        wide_items[i].key = large_items[i].value;
+        memset(wide_items[i].payload, (int)(i & 0xff),
+               sizeof(wide_items[i].payload));
+        wide_items[i].payload[299] = (uint8_t)(i >> 8);
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_argsort(wide_items, n, sizeof(wide_item_t),
+                                       compare_wide_by_key, perm_indices,
+                                       sizeof(size_t)));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_apply_permutation(wide_items, n,
+                                                 sizeof(wide_item_t),
+                                                 perm_indices, sizeof(size_t)));
+    // The same permutation reorders the parallel array of test_item_t.
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_apply_permutation(large_items, n,
+                                                 sizeof(test_item_t),
+                                                 perm_indices, sizeof(size_t)));
+    for (size_t i = 0; i < n; ++i) {
+        size_t from = perm_indices[i];
+        TEST_ASSERT_EQUAL_INT(large_items[i].value, wide_items[i].key);
+        TEST_ASSERT_EQUAL_UINT8(from & 0xff, wide_items[i].payload[0]);
+        TEST_ASSERT_EQUAL_UINT8(from & 0xff, wide_items[i].payload[298]);
+        TEST_ASSERT_EQUAL_UINT8(from >> 8, wide_items[i].payload[299]);
+        if (i > 0) {
+            TEST_ASSERT_TRUE(wide_items[i - 1].key <= wide_items[i].key);
+        }
+    }
+}
+
+void test_mu_store_argsort_invalid_params(void) {
+    size_t perm[3] = {0, 2, 1};
+    load_test_data(test_data_3_unsorted, 3);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_argsort(NULL, 3, sizeof(test_item_t),
+                                       compare_items_by_value, perm,
+                                       sizeof(size_t)));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_argsort(working_items, 3, sizeof(test_item_t),
+                                       NULL, perm, sizeof(size_t)));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_argsort(working_items, 3, sizeof(test_item_t),
+                                       compare_items_by_value, perm, 2));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_apply_permutation(working_items, 3, 0, perm,
+                                                 sizeof(size_t)));
+
+    // Not a permutation: nothing moves and `perm` is restored.
+    perm[1] = 0;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_apply_permutation(working_items, 3,
+                                                 sizeof(test_item_t), perm,
+                                                 sizeof(size_t)));
+    perm[1] = 3;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_apply_permutation(working_items, 3,
+                                                 sizeof(test_item_t), perm,
+                                                 sizeof(size_t)));
+    TEST_ASSERT_EQUAL(0, perm[0]);
+    TEST_ASSERT_EQUAL(3, perm[1]);
+    TEST_ASSERT_EQUAL(1, perm[2]);
+
+    // An entry with the top bit set is rejected without touching `perm`:
+    // 0x80000001 would pass as index 1 if the mark bit were stripped.
+    uint32_t perm32[3] = {2, 0x80000001u, 0};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_apply_permutation(working_items, 3,
+                                                 sizeof(test_item_t), perm32,
+                                                 sizeof(uint32_t)));
+    TEST_ASSERT_EQUAL_HEX32(2, perm32[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x80000001u, perm32[1]);
+    TEST_ASSERT_EQUAL_HEX32(0, perm32[2]);
+    TEST_ASSERT_EQUAL_INT(30, working_items[0].value);
+    TEST_ASSERT_EQUAL_INT(10, working_items[1].value);
+    TEST_ASSERT_EQUAL_INT(20, working_items[2].value);
+}
+
+static bool seq_key_is_even(const void *item, const void *arg) {
+    (void)arg;
+    return (((const seq_item_t *)item)->key & 1) == 0;
+}
+
+// Predicate call counter; tests pass a non-const instance as `arg`.
+typedef struct {
+    size_t calls;
+} pred_counter_t;
+
+// As seq_key_is_even, also counting the calls in a pred_counter_t.
+static bool seq_key_is_even_counted(const void *item, const void *arg) {
+    ((pred_counter_t *)arg)->calls++;
+    return seq_key_is_even(item, NULL);
+}
+
+/**
+ * @brief Check that seq_items[0..count) holds `expected_split` even-keyed
+ * items followed by odd-keyed ones and is a permutation of 0..count-1; if
+ * `stable`, also that `seq` ascends within each group.
+ */
+static void assert_seq_partitioned(size_t count, size_t split,
+                                   size_t expected_split, bool stable) {
+    static bool seen[LARGE_TEST_ITEMS];
+    memset(seen, 0, sizeof(seen));
+    TEST_ASSERT_EQUAL_size_t(expected_split, split);
+    for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT_EQUAL(i < split, seq_key_is_even(&seq_items[i], NULL));
+        TEST_ASSERT_FALSE(seen[seq_items[i].seq]);
+        seen[seq_items[i].seq] = true;
+        if (stable && i > 0 && i != split) {
+            TEST_ASSERT_TRUE(seq_items[i - 1].seq < seq_items[i].seq);
+        }
+    }
+}
+
+void test_mu_store_partition_patterns(void) {
+    static const size_t sizes[] = {0, 1, 2, 17, LARGE_TEST_ITEMS};
+    // Buffered single pass, recursion with rotations through scratch, and
+    // recursion with in-place rotations only.
+    static const size_t scratch_counts[] = {LARGE_TEST_ITEMS, 100, 0};
+    for (int p = 0; p < PATTERN_COUNT; ++p) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+            size_t n = sizes[s];
+            size_t evens = 0;
+            size_t split = 0;
+            pred_counter_t counter = {0};
+            fill_seq_pattern((test_pattern_t)p, n);
+            for (size_t i = 0; i < n; ++i) {
+                evens += seq_key_is_even(&seq_items[i], NULL);
+            }
+            TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                              mu_store_partition(seq_items, n,
+                                                 sizeof(seq_item_t),
+                                                 seq_key_is_even_counted,
+                                                 &counter, &split));
+            assert_seq_partitioned(n, split, evens, false);
+            TEST_ASSERT_EQUAL_size_t(n, counter.calls); // Each item tested once
+
+            for (size_t c = 0; c < 3; ++c) {
+                fill_seq_pattern((test_pattern_t)p, n);
+                counter.calls = 0;
+                TEST_ASSERT_EQUAL(
+                    MU_STORE_ERR_NONE,
+                    mu_store_stable_partition(
+                        seq_items, n, sizeof(seq_item_t),
+                        seq_key_is_even_counted, &counter,
+                        c == 2 ? NULL : seq_scratch, scratch_counts[c],
+                        &split));
+                assert_seq_partitioned(n, split, evens, true);
+                TEST_ASSERT_EQUAL_size_t(n, counter.calls);
+            }
+        }
+    }
+}
+
+void test_mu_store_partition_invalid_params(void) {
+    size_t split;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_partition(NULL, 3, sizeof(seq_item_t),
+                                         seq_key_is_even, NULL, &split));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_partition(seq_items, 3, 0, seq_key_is_even,
+                                         NULL, &split));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_partition(seq_items, 3, sizeof(seq_item_t),
+                                         NULL, NULL, &split));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_partition(seq_items, 3, sizeof(seq_item_t),
+                                         seq_key_is_even, NULL, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_stable_partition(NULL, 3, sizeof(seq_item_t),
+                                                seq_key_is_even, NULL, NULL,
+                                                0, &split));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_stable_partition(seq_items, 3,
+                                                sizeof(seq_item_t), NULL,
+                                                NULL, NULL, 0, &split));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_stable_partition(seq_items, 3,
+                                                sizeof(seq_item_t),
+                                                seq_key_is_even, NULL, NULL,
+                                                0, NULL));
+}
+
 // *****************************************************************************
 // Main Test Runner
 
@@ -878,17 +2174,26 @@ int main(void) {
 
     // Tests for mu_store_swap_items and mu_store_swap_pointers
     RUN_TEST(test_mu_store_swap_items);
+    RUN_TEST(test_mu_store_swap_items_all_sizes);
     RUN_TEST(test_mu_store_swap_pointers);
 
     RUN_TEST(test_mu_store_search_empty);
     RUN_TEST(test_mu_store_search_single);
     RUN_TEST(test_mu_store_search_multiple);
     RUN_TEST(test_mu_store_search_duplicates);
+    RUN_TEST(test_mu_store_search_upper);
 
     RUN_TEST(test_mu_store_psearch_empty);
     RUN_TEST(test_mu_store_psearch_single);
     RUN_TEST(test_mu_store_psearch_multiple);
     RUN_TEST(test_mu_store_psearch_duplicates);
+    RUN_TEST(test_mu_store_psearch_upper);
+    RUN_TEST(test_mu_store_search_many);
+    RUN_TEST(test_mu_store_search_many_invalid_params);
+    RUN_TEST(test_mu_store_search_from);
+    RUN_TEST(test_mu_store_interp_search);
+    RUN_TEST(test_mu_store_find_eq_and_count_eq);
+    RUN_TEST(test_mu_store_find_range);
 
     // Tests for mu_store_sort (sorts arrays of items)
     RUN_TEST(test_mu_store_sort_small_unsorted_value);
@@ -900,6 +2205,7 @@ int main(void) {
     RUN_TEST(test_mu_store_sort_zero_items);
     RUN_TEST(test_mu_store_sort_one_item);
     RUN_TEST(test_mu_store_sort_invalid_params);
+    RUN_TEST(test_mu_store_sort_large_patterns);
 
     // Tests for mu_store_psort (sorts arrays of pointers to items)
     RUN_TEST(test_mu_store_psort_small_unsorted_value);
@@ -911,6 +2217,32 @@ int main(void) {
     RUN_TEST(test_mu_store_psort_zero_items);
     RUN_TEST(test_mu_store_psort_one_item);
     RUN_TEST(test_mu_store_psort_invalid_params);
+    RUN_TEST(test_mu_store_psort_large_patterns);
+
+    // Tests for mu_store_stable_sort and mu_store_stable_psort
+    RUN_TEST(test_mu_store_stable_sort_patterns);
+    RUN_TEST(test_mu_store_stable_psort_patterns);
+    RUN_TEST(test_mu_store_stable_sort_invalid_params);
+    RUN_TEST(test_mu_store_psort_by_key_patterns);
+
+    // Tests for mu_store_radix_sort
+    RUN_TEST(test_mu_store_radix_sort_patterns);
+    RUN_TEST(test_mu_store_radix_sort_key_types);
+    RUN_TEST(test_mu_store_radix_sort_invalid_params);
+
+    // Tests for selection, partial sort and top-k
+    RUN_TEST(test_mu_store_select_patterns);
+    RUN_TEST(test_mu_store_partial_sort_and_topk);
+    RUN_TEST(test_mu_store_pselect_partial_psort_ptopk);
+    RUN_TEST(test_mu_store_select_invalid_params);
+
+    // Tests for argsort and permutations
+    RUN_TEST(test_mu_store_argsort_and_apply_permutation);
+    RUN_TEST(test_mu_store_apply_permutation_wide_items);
+    RUN_TEST(test_mu_store_argsort_invalid_params);
+
+    RUN_TEST(test_mu_store_partition_patterns);
+    RUN_TEST(test_mu_store_partition_invalid_params);
 
     return UNITY_END();
 }
@@ -0,0 +1,206 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_store_parallel.c
+ * @brief Unit tests for the multithreaded sorts.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_pvec.h"
+#include "mu_store.h"
+#include "mu_store_parallel.h"
+#include "mu_vec.h"
+#include "unity.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+// Enough items for several threads at MU_STORE_PARALLEL_MIN_CHUNK each.
+#define ITEM_COUNT (MU_STORE_PARALLEL_MIN_CHUNK * 5 + 123)
+
+typedef struct {
+    uint32_t key;
+    uint32_t tag;
+} test_item_t;
+
+// *****************************************************************************
+// storage
+
+static test_item_t items[ITEM_COUNT];
+static test_item_t scratch[ITEM_COUNT];
+static void *ptrs[ITEM_COUNT];
+static void *ptr_scratch[ITEM_COUNT];
+
+// *****************************************************************************
+// helper functions
+
+static int compare_items(const void *a, const void *b) {
+    uint32_t ka = ((const test_item_t *)a)->key;
+    uint32_t kb = ((const test_item_t *)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+static int compare_item_slots(const void *a, const void *b) {
+    return compare_items(*(void *const *)a, *(void *const *)b);
+}
+
+/**
+ * @brief Fill `items` with `count` keys drawn from [0, range), tagging each
+ * with its index so a permutation can be verified by the tag sum.
+ */
+static void fill_items(size_t count, uint32_t range) {
+    uint32_t seed = 2024;
+    for (size_t i = 0; i < count; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        items[i].key = (seed >> 4) % range;
+        items[i].tag = (uint32_t)i;
+        ptrs[i] = &items[i];
+    }
+}
+
+static bool items_sorted_permutation(size_t count) {
+    uint64_t tag_sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (i > 0 && items[i - 1].key > items[i].key) {
+            return false;
+        }
+        tag_sum += items[i].tag;
+    }
+    return count == 0 || tag_sum == (uint64_t)count * (count - 1) / 2;
+}
+
+static bool ptrs_sorted(size_t count) {
+    for (size_t i = 1; i < count; ++i) {
+        if (compare_item_slots(&ptrs[i - 1], &ptrs[i]) > 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// *****************************************************************************
+// Unity Test Setup and Teardown
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// *****************************************************************************
+// Test Cases
+
+void test_mu_store_parallel_sort_thread_counts(void) {
+    static const size_t threads[] = {0, 1, 2, 3, 4, 7, 1000};
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); ++t) {
+        fill_items(ITEM_COUNT, 1u << 30);
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_store_parallel_sort(items, ITEM_COUNT,
+                                                 sizeof(test_item_t),
+                                                 compare_items, scratch,
+                                                 threads[t]));
+        TEST_ASSERT_TRUE(items_sorted_permutation(ITEM_COUNT));
+    }
+}
+
+void test_mu_store_parallel_sort_duplicates_and_small(void) {
+    static const size_t sizes[] = {0, 1, 100, MU_STORE_PARALLEL_MIN_CHUNK * 2,
+                                   ITEM_COUNT};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        fill_items(sizes[s], 5);
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_store_parallel_sort(items, sizes[s],
+                                                 sizeof(test_item_t),
+                                                 compare_items, scratch, 4));
+        TEST_ASSERT_TRUE(items_sorted_permutation(sizes[s]));
+    }
+}
+
+void test_mu_store_parallel_psort(void) {
+    fill_items(ITEM_COUNT, 1000);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_parallel_psort(ptrs, ITEM_COUNT,
+                                              compare_item_slots, ptr_scratch,
+                                              3));
+    TEST_ASSERT_TRUE(ptrs_sorted(ITEM_COUNT));
+}
+
+void test_mu_vec_and_pvec_parallel_sort(void) {
+    mu_vec_t v;
+    mu_pvec_t pv;
+
+    fill_items(ITEM_COUNT, 1u << 20);
+    mu_vec_init(&v, items, ITEM_COUNT, sizeof(test_item_t));
+    v.count = ITEM_COUNT;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_parallel_sort(&v, compare_items, scratch, 4));
+    TEST_ASSERT_TRUE(items_sorted_permutation(ITEM_COUNT));
+
+    fill_items(ITEM_COUNT, 1u << 20);
+    mu_pvec_init(&pv, ptrs, ITEM_COUNT);
+    pv.count = ITEM_COUNT;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_parallel_sort(&pv, compare_item_slots,
+                                            ptr_scratch, 4));
+    TEST_ASSERT_TRUE(ptrs_sorted(ITEM_COUNT));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_parallel_sort(NULL, compare_items, scratch, 4));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_pvec_parallel_sort(&pv, NULL, ptr_scratch, 4));
+}
+
+void test_mu_store_parallel_sort_invalid_params(void) {
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_parallel_sort(NULL, 10, sizeof(test_item_t),
+                                             compare_items, scratch, 2));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_parallel_sort(items, 10, 0, compare_items,
+                                             scratch, 2));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_parallel_sort(items, 10, sizeof(test_item_t),
+                                             NULL, scratch, 2));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_parallel_sort(items, 10, sizeof(test_item_t),
+                                             compare_items, NULL, 2));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_parallel_psort(ptrs, 10, compare_item_slots,
+                                              NULL, 2));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_mu_store_parallel_sort_thread_counts);
+    RUN_TEST(test_mu_store_parallel_sort_duplicates_and_small);
+    RUN_TEST(test_mu_store_parallel_psort);
+    RUN_TEST(test_mu_vec_and_pvec_parallel_sort);
+    RUN_TEST(test_mu_store_parallel_sort_invalid_params);
+    return UNITY_END();
+}
+
+// *****************************************************************************
+// End of file
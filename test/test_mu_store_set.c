@@ -0,0 +1,428 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_store_set.c
+ * @brief Unit tests for merge and set algebra over sorted arrays.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_pvec.h"
+#include "mu_store.h"
+#include "mu_store_set.h"
+#include "mu_vec.h"
+#include "unity.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+typedef struct {
+    int key;
+    char tag;
+} test_item_t;
+
+#define LONG_COUNT 1000
+
+// *****************************************************************************
+// storage
+
+// Multisets: a = {1, 2, 2, 2, 5, 7}, b = {2, 2, 3, 7, 7, 9}
+static const test_item_t a_items[] = {{1, 'a'}, {2, 'b'}, {2, 'c'},
+                                      {2, 'd'}, {5, 'e'}, {7, 'f'}};
+static const test_item_t b_items[] = {{2, 'B'}, {2, 'C'}, {3, 'D'},
+                                      {7, 'E'}, {7, 'F'}, {9, 'G'}};
+#define A_COUNT (sizeof(a_items) / sizeof(a_items[0]))
+#define B_COUNT (sizeof(b_items) / sizeof(b_items[0]))
+
+static test_item_t out_items[A_COUNT + B_COUNT];
+
+static uint32_t long_u32[LONG_COUNT];
+static uint32_t short_u32[8];
+static uint32_t out_u32[LONG_COUNT];
+static uint64_t long_u64[LONG_COUNT];
+static uint64_t short_u64[8];
+static uint64_t out_u64[LONG_COUNT];
+
+// *****************************************************************************
+// helper functions
+
+static int compare_items(const void *a, const void *b) {
+    int ka = ((const test_item_t *)a)->key;
+    int kb = ((const test_item_t *)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
+static int compare_item_slots(const void *a, const void *b) {
+    return compare_items(*(void *const *)a, *(void *const *)b);
+}
+
+static int compare_u32(const void *a, const void *b) {
+    uint32_t ua = *(const uint32_t *)a;
+    uint32_t ub = *(const uint32_t *)b;
+    return (ua > ub) - (ua < ub);
+}
+
+/**
+ * @brief Assert that the first `count` items of out_items carry `tags`.
+ */
+static void assert_tags(const char *tags, size_t count) {
+    TEST_ASSERT_EQUAL(strlen(tags), count);
+    for (size_t i = 0; i < count; ++i) {
+        TEST_ASSERT_EQUAL_CHAR(tags[i], out_items[i].tag);
+    }
+}
+
+// *****************************************************************************
+// Unity Test Setup and Teardown
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// *****************************************************************************
+// Test Cases
+
+void test_mu_store_merge_is_stable(void) {
+    size_t n = 0;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_merge(a_items, A_COUNT, b_items, B_COUNT,
+                                     sizeof(test_item_t), compare_items,
+                                     out_items, A_COUNT + B_COUNT, &n));
+    assert_tags("abcdBCDefEFG", n);
+}
+
+void test_mu_store_set_operations_on_multisets(void) {
+    size_t n = 0;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_set_union(a_items, A_COUNT, b_items, B_COUNT,
+                                         sizeof(test_item_t), compare_items,
+                                         out_items, A_COUNT + B_COUNT, &n));
+    assert_tags("abcdDefFG", n);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_set_intersection(a_items, A_COUNT, b_items,
+                                                B_COUNT, sizeof(test_item_t),
+                                                compare_items, out_items,
+                                                A_COUNT + B_COUNT, &n));
+    assert_tags("bcf", n);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_set_difference(a_items, A_COUNT, b_items,
+                                              B_COUNT, sizeof(test_item_t),
+                                              compare_items, out_items,
+                                              A_COUNT + B_COUNT, &n));
+    assert_tags("ade", n);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_set_difference(b_items, B_COUNT, a_items,
+                                              A_COUNT, sizeof(test_item_t),
+                                              compare_items, out_items,
+                                              A_COUNT + B_COUNT, &n));
+    assert_tags("DFG", n);
+
+    // Empty inputs need no buffers.
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_set_union(NULL, 0, NULL, 0,
+                                         sizeof(test_item_t), compare_items,
+                                         NULL, 0, &n));
+    TEST_ASSERT_EQUAL(0, n);
+}
+
+void test_mu_store_set_truncated_output(void) {
+    size_t n = 0;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_store_merge(a_items, A_COUNT, b_items, B_COUNT,
+                                     sizeof(test_item_t), compare_items,
+                                     out_items, 5, &n));
+    assert_tags("abcdB", n);
+
+    // A result that exactly fits is not truncated.
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_set_intersection(a_items, A_COUNT, b_items,
+                                                B_COUNT, sizeof(test_item_t),
+                                                compare_items, out_items, 3,
+                                                &n));
+    TEST_ASSERT_EQUAL(3, n);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_store_set_intersection(a_items, A_COUNT, b_items,
+                                                B_COUNT, sizeof(test_item_t),
+                                                compare_items, out_items, 2,
+                                                &n));
+    TEST_ASSERT_EQUAL(2, n);
+}
+
+void test_mu_store_set_skewed_inputs(void) {
+    // A long array of even numbers against a few scattered values: the
+    // galloping generic loop and the integer fast paths must agree.
+    static const uint32_t few[] = {0, 3, 500, 501, 998, 1998, 1999, 5000};
+    size_t n_generic = 0, n_fast = 0;
+    for (size_t i = 0; i < LONG_COUNT; ++i) {
+        long_u32[i] = (uint32_t)(2 * i);
+        long_u64[i] = (uint64_t)(2 * i) << 32;
+    }
+    for (size_t i = 0; i < 8; ++i) {
+        short_u32[i] = few[i];
+        short_u64[i] = (uint64_t)few[i] << 32;
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_set_intersection(long_u32, LONG_COUNT,
+                                                short_u32, 8, sizeof(uint32_t),
+                                                compare_u32, out_u32,
+                                                LONG_COUNT, &n_generic));
+    TEST_ASSERT_EQUAL(4, n_generic);
+    TEST_ASSERT_EQUAL_UINT32(0, out_u32[0]);
+    TEST_ASSERT_EQUAL_UINT32(500, out_u32[1]);
+    TEST_ASSERT_EQUAL_UINT32(998, out_u32[2]);
+    TEST_ASSERT_EQUAL_UINT32(1998, out_u32[3]);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_set_intersection_u64(short_u64, 8, long_u64,
+                                                    LONG_COUNT, out_u64,
+                                                    LONG_COUNT, &n_fast));
+    TEST_ASSERT_EQUAL(4, n_fast);
+    TEST_ASSERT_TRUE(out_u64[3] == (uint64_t)1998 << 32);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_set_difference_u32(long_u32, LONG_COUNT,
+                                                  short_u32, 8, out_u32,
+                                                  LONG_COUNT, &n_fast));
+    TEST_ASSERT_EQUAL(LONG_COUNT - 4, n_fast);
+    TEST_ASSERT_EQUAL_UINT32(2, out_u32[0]);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_store_set_union_u32(long_u32, LONG_COUNT, short_u32,
+                                             8, out_u32, LONG_COUNT, &n_fast));
+    TEST_ASSERT_EQUAL(LONG_COUNT, n_fast);
+}
+
+void test_mu_store_set_u32_matches_generic(void) {
+    uint32_t seed = 99;
+    size_t na = LONG_COUNT / 2, nb = LONG_COUNT / 2 - 7;
+    static uint32_t a[LONG_COUNT / 2], b[LONG_COUNT / 2], expect[LONG_COUNT];
+    for (size_t i = 0; i < na; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        a[i] = (seed >> 8) % 300;
+        seed = seed * 1103515245u + 12345u;
+        b[i] = (seed >> 8) % 300;
+    }
+    mu_store_sort(a, na, sizeof(uint32_t), compare_u32);
+    mu_store_sort(b, nb, sizeof(uint32_t), compare_u32);
+
+    typedef mu_store_err_t (*generic_fn)(const void *, size_t, const void *,
+                                         size_t, size_t, mu_store_compare_fn,
+                                         void *, size_t, size_t *);
+    typedef mu_store_err_t (*u32_fn)(const uint32_t *, size_t,
+                                     const uint32_t *, size_t, uint32_t *,
+                                     size_t, size_t *);
+    static const generic_fn generic[] = {
+        mu_store_merge, mu_store_set_union, mu_store_set_intersection,
+        mu_store_set_difference};
+    static const u32_fn fast[] = {
+        mu_store_merge_u32, mu_store_set_union_u32,
+        mu_store_set_intersection_u32, mu_store_set_difference_u32};
+
+    for (size_t op = 0; op < 4; ++op) {
+        size_t n_expect = 0, n_out = 0;
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          generic[op](a, na, b, nb, sizeof(uint32_t),
+                                      compare_u32, expect, LONG_COUNT,
+                                      &n_expect));
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          fast[op](a, na, b, nb, out_u32, LONG_COUNT, &n_out));
+        TEST_ASSERT_EQUAL(n_expect, n_out);
+        TEST_ASSERT_EQUAL_UINT32_ARRAY(expect, out_u32, n_out);
+    }
+}
+
+void test_mu_store_unique(void) {
+    test_item_t items[A_COUNT + B_COUNT];
+    size_t n = 0;
+    mu_store_merge(a_items, A_COUNT, b_items, B_COUNT, sizeof(test_item_t),
+                   compare_items, items, A_COUNT + B_COUNT, &n);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_unique(items, n, sizeof(test_item_t),
+                                      compare_items, &n));
+    TEST_ASSERT_EQUAL(6, n);
+    const char tags[] = "abDefG";
+    for (size_t i = 0; i < n; ++i) {
+        TEST_ASSERT_EQUAL_CHAR(tags[i], items[i].tag);
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_unique(NULL, 0, sizeof(test_item_t),
+                                      compare_items, &n));
+    TEST_ASSERT_EQUAL(0, n);
+}
+
+void test_mu_store_pointer_set_operations(void) {
+    void *a[A_COUNT], *b[B_COUNT], *out[A_COUNT + B_COUNT];
+    size_t n = 0;
+    for (size_t i = 0; i < A_COUNT; ++i) {
+        a[i] = (void *)&a_items[i];
+    }
+    for (size_t i = 0; i < B_COUNT; ++i) {
+        b[i] = (void *)&b_items[i];
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_pset_intersection(a, A_COUNT, b, B_COUNT,
+                                                 compare_item_slots, out,
+                                                 A_COUNT + B_COUNT, &n));
+    TEST_ASSERT_EQUAL(3, n);
+    TEST_ASSERT_EQUAL_PTR(&a_items[1], out[0]);
+    TEST_ASSERT_EQUAL_PTR(&a_items[5], out[2]);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_pmerge(a, A_COUNT, b, B_COUNT,
+                                      compare_item_slots, out,
+                                      A_COUNT + B_COUNT, &n));
+    TEST_ASSERT_EQUAL(A_COUNT + B_COUNT, n);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_punique(out, n, compare_item_slots, &n));
+    TEST_ASSERT_EQUAL(6, n);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_pset_union(a, A_COUNT, b, B_COUNT,
+                                          compare_item_slots, out,
+                                          A_COUNT + B_COUNT, &n));
+    TEST_ASSERT_EQUAL(9, n);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_store_pset_difference(a, A_COUNT, b, B_COUNT,
+                                               compare_item_slots, out,
+                                               A_COUNT + B_COUNT, &n));
+    TEST_ASSERT_EQUAL(3, n);
+}
+
+void test_mu_vec_and_pvec_set_operations(void) {
+    test_item_t a_store[A_COUNT], b_store[B_COUNT], out_store[A_COUNT + B_COUNT];
+    mu_vec_t a, b, out;
+    mu_vec_init(&a, a_store, A_COUNT, sizeof(test_item_t));
+    mu_vec_init(&b, b_store, B_COUNT, sizeof(test_item_t));
+    mu_vec_init(&out, out_store, A_COUNT + B_COUNT, sizeof(test_item_t));
+    for (size_t i = 0; i < A_COUNT; ++i) {
+        mu_vec_push(&a, &a_items[i]);
+    }
+    for (size_t i = 0; i < B_COUNT; ++i) {
+        mu_vec_push(&b, &b_items[i]);
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_set_union(&a, &b, compare_items, &out));
+    TEST_ASSERT_EQUAL(9, mu_vec_count(&out));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_set_intersection(&a, &b, compare_items, &out));
+    TEST_ASSERT_EQUAL(3, mu_vec_count(&out));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_set_difference(&a, &b, compare_items, &out));
+    TEST_ASSERT_EQUAL(3, mu_vec_count(&out));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_merge(&a, &b, compare_items, &out));
+    TEST_ASSERT_EQUAL(A_COUNT + B_COUNT, mu_vec_count(&out));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_unique(&out, compare_items));
+    TEST_ASSERT_EQUAL(6, mu_vec_count(&out));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_merge(&a, &b, compare_items, &a));
+
+    void *pa_store[A_COUNT], *pb_store[B_COUNT], *pout_store[A_COUNT];
+    mu_pvec_t pa, pb, pout;
+    mu_pvec_init(&pa, pa_store, A_COUNT);
+    mu_pvec_init(&pb, pb_store, B_COUNT);
+    mu_pvec_init(&pout, pout_store, A_COUNT);
+    for (size_t i = 0; i < A_COUNT; ++i) {
+        mu_pvec_push(&pa, (void *)&a_items[i]);
+    }
+    for (size_t i = 0; i < B_COUNT; ++i) {
+        mu_pvec_push(&pb, (void *)&b_items[i]);
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_set_intersection(&pa, &pb, compare_item_slots,
+                                               &pout));
+    TEST_ASSERT_EQUAL(3, mu_pvec_count(&pout));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_set_difference(&pa, &pb, compare_item_slots,
+                                             &pout));
+    TEST_ASSERT_EQUAL(3, mu_pvec_count(&pout));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_pvec_set_union(&pa, &pb, compare_item_slots, &pout));
+    TEST_ASSERT_EQUAL(A_COUNT, mu_pvec_count(&pout));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_pvec_merge(&pa, &pb, compare_item_slots, &pout));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_pvec_unique(&pout, compare_item_slots));
+    TEST_ASSERT_EQUAL(2, mu_pvec_count(&pout));
+}
+
+void test_mu_store_set_invalid_params(void) {
+    size_t n = 0;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_merge(NULL, 1, b_items, B_COUNT,
+                                     sizeof(test_item_t), compare_items,
+                                     out_items, 1, &n));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_set_union(a_items, A_COUNT, b_items, B_COUNT,
+                                         0, compare_items, out_items, 1, &n));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_set_intersection(a_items, A_COUNT, b_items,
+                                                B_COUNT, sizeof(test_item_t),
+                                                NULL, out_items, 1, &n));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_set_difference(a_items, A_COUNT, b_items,
+                                              B_COUNT, sizeof(test_item_t),
+                                              compare_items, NULL, 1, &n));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_set_difference(a_items, A_COUNT, b_items,
+                                              B_COUNT, sizeof(test_item_t),
+                                              compare_items, out_items, 1,
+                                              NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_merge_u32(NULL, 1, short_u32, 1, out_u32, 1,
+                                         &n));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_store_unique(out_items, 1, sizeof(test_item_t),
+                                      NULL, &n));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_vec_unique(NULL, compare_items));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_mu_store_merge_is_stable);
+    RUN_TEST(test_mu_store_set_operations_on_multisets);
+    RUN_TEST(test_mu_store_set_truncated_output);
+    RUN_TEST(test_mu_store_set_skewed_inputs);
+    RUN_TEST(test_mu_store_set_u32_matches_generic);
+    RUN_TEST(test_mu_store_unique);
+    RUN_TEST(test_mu_store_pointer_set_operations);
+    RUN_TEST(test_mu_vec_and_pvec_set_operations);
+    RUN_TEST(test_mu_store_set_invalid_params);
+    return UNITY_END();
+}
+
+// *****************************************************************************
+// End of file
@@ -154,6 +154,171 @@ void test_mu_vec_push_pop_peek_ref(void) {
     TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY, mu_vec_pop(&v, &out));
 }
 
+void test_mu_vec_at_and_data(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    TEST_ASSERT_EQUAL_PTR(backing_store, mu_vec_data(&v));
+    TEST_ASSERT_NULL(mu_vec_data(NULL));
+    TEST_ASSERT_NULL(mu_vec_at(&v, 0));
+    TEST_ASSERT_NULL(mu_vec_at(NULL, 0));
+
+    test_item_t in[] = {{10, 'a'}, {20, 'b'}, {30, 'c'}};
+    for (int i = 0; i < 3; ++i) {
+        mu_vec_push(&v, &in[i]);
+    }
+    TEST_ASSERT_EQUAL_PTR(&backing_store[1], mu_vec_at(&v, 1));
+    TEST_ASSERT_EQUAL_PTR(&backing_store[2], mu_vec_at_unchecked(&v, 2));
+    TEST_ASSERT_NULL(mu_vec_at(&v, 3));
+
+    // modify in place
+    test_item_t *p = mu_vec_at(&v, 1);
+    p->value = 25;
+    test_item_t out;
+    mu_vec_ref(&v, 1, &out);
+    TEST_ASSERT_EQUAL_INT(25, out.value);
+}
+
+void test_mu_vec_emplace(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    TEST_ASSERT_NULL(mu_vec_emplace_back(NULL));
+    TEST_ASSERT_NULL(mu_vec_emplace_at(NULL, 0));
+    TEST_ASSERT_NULL(mu_vec_emplace_at(&v, 1)); // index > count
+
+    // [10a, 30c] built in place, then 20b opened between them
+    test_item_t *p = mu_vec_emplace_back(&v);
+    TEST_ASSERT_EQUAL_PTR(&backing_store[0], p);
+    *p = (test_item_t){10, 'a'};
+    p = mu_vec_emplace_back(&v);
+    *p = (test_item_t){30, 'c'};
+    p = mu_vec_emplace_at(&v, 1);
+    TEST_ASSERT_EQUAL_PTR(&backing_store[1], p);
+    *p = (test_item_t){20, 'b'};
+    p = mu_vec_emplace_at(&v, 3); // at the end, like emplace_back
+    *p = (test_item_t){40, 'd'};
+    TEST_ASSERT_EQUAL_size_t(4, mu_vec_count(&v));
+    const char ids[] = "abcd";
+    for (size_t i = 0; i < 4; ++i) {
+        test_item_t *item = mu_vec_at(&v, i);
+        TEST_ASSERT_EQUAL_INT((int)(i + 1) * 10, item->value);
+        TEST_ASSERT_EQUAL_CHAR(ids[i], item->id);
+    }
+
+    // full
+    while (mu_vec_count(&v) < CAP) {
+        TEST_ASSERT_NOT_NULL(mu_vec_emplace_at(&v, 0));
+    }
+    TEST_ASSERT_NULL(mu_vec_emplace_back(&v));
+    TEST_ASSERT_NULL(mu_vec_emplace_at(&v, 0));
+    TEST_ASSERT_EQUAL_size_t(CAP, mu_vec_count(&v));
+}
+
+/** Assert that the vector holds items whose ids spell `ids` */
+static void assert_ids(const char *ids) {
+    TEST_ASSERT_EQUAL_size_t(strlen(ids), mu_vec_count(&v));
+    for (size_t i = 0; i < mu_vec_count(&v); ++i) {
+        test_item_t *item = mu_vec_at(&v, i);
+        TEST_ASSERT_EQUAL_CHAR(ids[i], item->id);
+    }
+}
+
+void test_mu_vec_range_operations(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    test_item_t abc[] = {{1, 'a'}, {2, 'b'}, {3, 'c'}};
+    test_item_t xyz[] = {{7, 'x'}, {8, 'y'}, {9, 'z'}};
+    test_item_t out[CAP];
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_push_n(&v, abc, 3));
+    assert_ids("abc");
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_insert_range(&v, 1, xyz, 3));
+    assert_ids("axyzbc");
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_vec_push_n(&v, abc, 3));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, mu_vec_insert_range(&v, 0, abc, 3));
+    assert_ids("axyzbc"); // unchanged
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_copy_out_range(&v, 2, 3, out));
+    TEST_ASSERT_EQUAL_CHAR('y', out[0].id);
+    TEST_ASSERT_EQUAL_CHAR('b', out[2].id);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_delete_range(&v, 1, 2, out));
+    assert_ids("azbc");
+    TEST_ASSERT_EQUAL_CHAR('x', out[0].id);
+    TEST_ASSERT_EQUAL_CHAR('y', out[1].id);
+
+    // grow, shrink and same-size replacement
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_replace_range(&v, 1, 1, abc, 3));
+    assert_ids("aabcbc");
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_replace_range(&v, 0, 4, xyz, 1));
+    assert_ids("xbc");
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_replace_range(&v, 1, 2, xyz + 1, 2));
+    assert_ids("xyz");
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_vec_replace_range(&v, 0, 0, out, CAP));
+
+    // empty ranges and bounds
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_insert_range(&v, 3, NULL, 0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_delete_range(&v, 3, 0, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX, mu_vec_insert_range(&v, 4, abc, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX, mu_vec_delete_range(&v, 2, 2, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX,
+                      mu_vec_copy_out_range(&v, 1, 3, out));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX,
+                      mu_vec_replace_range(&v, 3, 1, abc, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_vec_push_n(NULL, abc, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_vec_push_n(&v, NULL, 1));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_copy_out_range(&v, 0, 1, NULL));
+    assert_ids("xyz");
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_delete_range(&v, 0, 3, NULL));
+    TEST_ASSERT_TRUE(mu_vec_is_empty(&v));
+}
+
+void test_mu_vec_swap_remove(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    test_item_t data[] = {{1, 'a'}, {2, 'b'}, {3, 'c'}, {4, 'd'},
+                          {5, 'e'}, {6, 'f'}, {7, 'g'}, {8, 'h'}};
+    test_item_t out[CAP];
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_push_n(&v, data, 8));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_swap_remove(&v, 1, out));
+    TEST_ASSERT_EQUAL_CHAR('b', out[0].id);
+    assert_ids("ahcdefg");
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_swap_remove(&v, 6, NULL));
+    assert_ids("ahcdef");
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX, mu_vec_swap_remove(&v, 6, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_vec_swap_remove(NULL, 0, NULL));
+
+    // Batched: the tail items removed are not moved into earlier holes.
+    const size_t indices[] = {0, 2, 4, 5};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_swap_remove_indices(&v, indices, 4, out));
+    assert_ids("dh");
+    TEST_ASSERT_EQUAL_CHAR('a', out[0].id);
+    TEST_ASSERT_EQUAL_CHAR('c', out[1].id);
+    TEST_ASSERT_EQUAL_CHAR('e', out[2].id);
+    TEST_ASSERT_EQUAL_CHAR('f', out[3].id);
+
+    const size_t unsorted[] = {1, 0};
+    const size_t too_big[] = {0, 2};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX,
+                      mu_vec_swap_remove_indices(&v, unsorted, 2, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX,
+                      mu_vec_swap_remove_indices(&v, too_big, 2, NULL));
+    assert_ids("dh"); // unchanged
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_swap_remove_indices(&v, NULL, 0, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_swap_remove_indices(&v, NULL, 1, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_swap_remove_indices(&v, indices, 1, NULL));
+    assert_ids("h");
+}
+
 void test_mu_vec_insert_delete_replace_swap(void) {
     TEST_ASSERT_NOT_NULL(
         mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
@@ -238,6 +403,251 @@ void test_mu_vec_find_rfind(void) {
                       mu_vec_find(&v, find_by_value, &data[0].value, NULL));
 }
 
+void test_mu_vec_find_from_and_find_all(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    test_item_t data[] = {
+        {10, 'A'}, {20, 'B'}, {20, 'C'}, {30, 'D'}, {20, 'E'}};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_push_n(&v, data, 5));
+    size_t idx, n_found;
+    size_t indices[CAP];
+    int key = 20;
+
+    // Resume after each match
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_from(&v, 2, find_by_value, &key, &idx));
+    TEST_ASSERT_EQUAL_size_t(2, idx);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_from(&v, idx + 1, find_by_value, &key,
+                                       &idx));
+    TEST_ASSERT_EQUAL_size_t(4, idx);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND,
+                      mu_vec_find_from(&v, idx + 1, find_by_value, &key,
+                                       &idx));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX,
+                      mu_vec_find_from(&v, 6, find_by_value, &key, &idx));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_all(&v, find_by_value, &key, indices, CAP,
+                                      &n_found));
+    TEST_ASSERT_EQUAL_size_t(3, n_found);
+    TEST_ASSERT_EQUAL_size_t(1, indices[0]);
+    TEST_ASSERT_EQUAL_size_t(2, indices[1]);
+    TEST_ASSERT_EQUAL_size_t(4, indices[2]);
+
+    // Too small a buffer: FULL, then resume with find_all_from
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_vec_find_all(&v, find_by_value, &key, indices, 2,
+                                      &n_found));
+    TEST_ASSERT_EQUAL_size_t(2, n_found);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_all_from(&v, indices[1] + 1, find_by_value,
+                                           &key, indices, 2, &n_found));
+    TEST_ASSERT_EQUAL_size_t(1, n_found);
+    TEST_ASSERT_EQUAL_size_t(4, indices[0]);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_all_from(&v, 5, find_by_value, &key,
+                                           indices, 2, &n_found));
+    TEST_ASSERT_EQUAL_size_t(0, n_found);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX,
+                      mu_vec_find_all_from(&v, 6, find_by_value, &key,
+                                           indices, 2, &n_found));
+    key = 30;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_all(&v, find_by_value, &key, indices, 1,
+                                      &n_found));
+    TEST_ASSERT_EQUAL_size_t(1, n_found);
+    key = 99;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_all(&v, find_by_value, &key, NULL, 0,
+                                      &n_found));
+    TEST_ASSERT_EQUAL_size_t(0, n_found);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_find_from(&v, 0, NULL, &key, &idx));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_find_all(&v, find_by_value, &key, NULL, 1,
+                                      &n_found));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_find_all(NULL, find_by_value, &key, indices, CAP,
+                                      &n_found));
+
+    // No room at all but a match: FULL with nothing written, resume from 0
+    key = 20;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_vec_find_all(&v, find_by_value, &key, NULL, 0,
+                                      &n_found));
+    TEST_ASSERT_EQUAL_size_t(0, n_found);
+
+    // Appending into a mu_vec of size_t
+    size_t index_store[4];
+    mu_vec_t out;
+    mu_vec_init(&out, index_store, 4, sizeof(size_t));
+    size_t first = 7;
+    mu_vec_push(&out, &first); // Existing contents are kept
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_all_vec(&v, find_by_value, &key, &out));
+    TEST_ASSERT_EQUAL_size_t(4, mu_vec_count(&out));
+    TEST_ASSERT_EQUAL_size_t(7, index_store[0]);
+    TEST_ASSERT_EQUAL_size_t(1, index_store[1]);
+    TEST_ASSERT_EQUAL_size_t(2, index_store[2]);
+    TEST_ASSERT_EQUAL_size_t(4, index_store[3]);
+    // Full: nothing appended
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_vec_find_all_vec(&v, find_by_value, &key, &out));
+    TEST_ASSERT_EQUAL_size_t(4, mu_vec_count(&out));
+    // Partly full: the indices that fit are appended
+    mu_vec_clear(&out);
+    mu_vec_push(&out, &first);
+    mu_vec_push(&out, &first);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_vec_find_all_vec(&v, find_by_value, &key, &out));
+    TEST_ASSERT_EQUAL_size_t(4, mu_vec_count(&out));
+    TEST_ASSERT_EQUAL_size_t(2, index_store[3]);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_find_all_vec(&v, find_by_value, &key, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_find_all_vec(&v, find_by_value, &key, &v));
+    // A second vector over the searched items is rejected, untouched
+    mu_vec_t alias;
+    mu_vec_init(&alias, backing_store, CAP, sizeof(size_t));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_find_all_vec(&v, find_by_value, &key, &alias));
+    TEST_ASSERT_EQUAL_size_t(0, mu_vec_count(&alias));
+    assert_ids("ABCDE");
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_find_all_vec(NULL, find_by_value, &key, &out));
+}
+
+static bool value_below(const void *item, const void *arg) {
+    return ((const test_item_t *)item)->value < *(const int *)arg;
+}
+
+// Predicate call counter; tests pass a non-const instance as `arg`.
+typedef struct {
+    size_t calls;
+} pred_counter_t;
+
+// Keeps even values, counting the calls in a pred_counter_t.
+static bool value_is_even_counted(const void *item, const void *arg) {
+    ((pred_counter_t *)arg)->calls++;
+    return (((const test_item_t *)item)->value & 1) == 0;
+}
+
+void test_mu_vec_retain_and_partition(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    test_item_t data[] = {{5, 'a'}, {1, 'b'}, {7, 'c'}, {2, 'd'},
+                          {3, 'e'}, {9, 'f'}, {8, 'g'}, {0, 'h'}};
+    test_item_t scratch[CAP];
+    size_t split;
+    int limit = 4;
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_push_n(&v, data, 8));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_stable_partition(&v, value_below, &limit, NULL,
+                                              0, &split));
+    TEST_ASSERT_EQUAL_size_t(4, split);
+    assert_ids("bdehacfg");
+
+    mu_vec_clear(&v);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_push_n(&v, data, 8));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_stable_partition(&v, value_below, &limit,
+                                              scratch, CAP, &split));
+    TEST_ASSERT_EQUAL_size_t(4, split);
+    assert_ids("bdehacfg");
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_partition(&v, value_below, &limit, &split));
+    TEST_ASSERT_EQUAL_size_t(4, split);
+    for (size_t i = 0; i < 8; ++i) {
+        TEST_ASSERT_EQUAL(i < split, value_below(mu_vec_at(&v, i), &limit));
+    }
+
+    // retain keeps the order of the survivors
+    mu_vec_clear(&v);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_push_n(&v, data, 8));
+    limit = 8;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_retain(&v, value_below, &limit));
+    assert_ids("abcdeh");
+    limit = 0;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_retain(&v, value_below, &limit));
+    assert_ids("");
+
+    // keep_fn is called exactly once per element, including the rejected
+    // elements that end a run of kept ones.
+    test_item_t runs[] = {{0, 'a'}, {2, 'b'}, {3, 'c'}, {4, 'd'},
+                          {5, 'e'}, {6, 'f'}};
+    pred_counter_t counter = {0};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_push_n(&v, runs, 6));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_retain(&v, value_is_even_counted, &counter));
+    TEST_ASSERT_EQUAL_size_t(6, counter.calls); // Each element tested once
+    assert_ids("abdf");
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_retain(NULL, value_below, &limit));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_vec_retain(&v, NULL, &limit));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_partition(NULL, value_below, &limit, &split));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_stable_partition(&v, value_below, &limit, NULL,
+                                              0, NULL));
+}
+
+void test_mu_vec_find_eq_count_eq_find_range(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    test_item_t data[] = {{10, 'A'}, {20, 'B'}, {20, 'C'}, {30, 'D'},
+                          {20, 'E'}, {-5, 'F'}};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_push_n(&v, data, 6));
+    size_t idx, count;
+    int key = 20;
+    char id = 'D';
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_eq(&v, offsetof(test_item_t, value),
+                                     sizeof(int), &key, &idx));
+    TEST_ASSERT_EQUAL_size_t(1, idx);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_eq(&v, offsetof(test_item_t, id), 1, &id,
+                                     &idx));
+    TEST_ASSERT_EQUAL_size_t(3, idx);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_count_eq(&v, offsetof(test_item_t, value),
+                                      sizeof(int), &key, &count));
+    TEST_ASSERT_EQUAL_size_t(3, count);
+
+    int lo = -10, hi = 0;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_find_range(&v, offsetof(test_item_t, value),
+                                        sizeof(int), MU_STORE_RADIX_SIGNED,
+                                        &lo, &hi, &idx));
+    TEST_ASSERT_EQUAL_size_t(5, idx);
+    lo = 21, hi = 29;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND,
+                      mu_vec_find_range(&v, offsetof(test_item_t, value),
+                                        sizeof(int), MU_STORE_RADIX_SIGNED,
+                                        &lo, &hi, &idx));
+    key = 99;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND,
+                      mu_vec_find_eq(&v, offsetof(test_item_t, value),
+                                     sizeof(int), &key, &idx));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_find_eq(NULL, 0, sizeof(int), &key, &idx));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_count_eq(&v, 0, 3, &key, &count));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_find_range(&v, 0, sizeof(int),
+                                        MU_STORE_RADIX_SIGNED, &lo, &hi,
+                                        NULL));
+}
+
 void test_mu_vec_sort_and_reverse(void) {
     TEST_ASSERT_NOT_NULL(
         mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
@@ -612,6 +1022,255 @@ void test_mu_vec_sorted_insert_duplicate_full_on_match(void) {
     TEST_ASSERT_EQUAL_size_t(CAP, mu_vec_count(&v));
 }
 
+/** INSERT_FIRST with a match on a full vector must not overrun the store */
+void test_mu_vec_sorted_insert_first_full_on_match(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    for (int i = 0; i < CAP; ++i) {
+        test_item_t tmp = {.value = i, .id = (char)('0' + i)};
+        mu_vec_sorted_insert(&v, &tmp, cmp_by_value, MU_STORE_INSERT_ANY);
+    }
+    test_item_t X = {.value = 3, .id = 'X'};
+    TEST_ASSERT_EQUAL(
+        MU_STORE_ERR_FULL,
+        mu_vec_sorted_insert(&v, &X, cmp_by_value, MU_STORE_INSERT_FIRST));
+    TEST_ASSERT_EQUAL(
+        MU_STORE_ERR_FULL,
+        mu_vec_sorted_insert(&v, &X, cmp_by_value, MU_STORE_INSERT_LAST));
+    TEST_ASSERT_EQUAL_size_t(CAP, mu_vec_count(&v));
+}
+
+/** UPDATE_LAST / UPDATE_ALL locate the end of a run of equal items */
+void test_mu_vec_sorted_insert_run_bounds(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    /* v = [1a, 2b, 2c, 2d, 3e] */
+    test_item_t in[] = {{1, 'a'}, {2, 'b'}, {2, 'c'}, {2, 'd'}, {3, 'e'}};
+    for (size_t i = 0; i < sizeof(in) / sizeof(in[0]); ++i) {
+        mu_vec_sorted_insert(&v, &in[i], cmp_by_value, MU_STORE_INSERT_ANY);
+    }
+    test_item_t out;
+    test_item_t L = {.value = 2, .id = 'L'};
+    TEST_ASSERT_EQUAL(
+        MU_STORE_ERR_NONE,
+        mu_vec_sorted_insert(&v, &L, cmp_by_value, MU_STORE_UPDATE_LAST));
+    mu_vec_ref(&v, 3, &out);
+    TEST_ASSERT_EQUAL_CHAR('L', out.id);
+    mu_vec_ref(&v, 2, &out);
+    TEST_ASSERT_EQUAL_CHAR('c', out.id);
+
+    test_item_t A = {.value = 2, .id = 'Z'};
+    TEST_ASSERT_EQUAL(
+        MU_STORE_ERR_NONE,
+        mu_vec_sorted_insert(&v, &A, cmp_by_value, MU_STORE_UPDATE_ALL));
+    for (size_t i = 1; i <= 3; ++i) {
+        mu_vec_ref(&v, i, &out);
+        TEST_ASSERT_EQUAL_CHAR('Z', out.id);
+    }
+    mu_vec_ref(&v, 0, &out);
+    TEST_ASSERT_EQUAL_CHAR('a', out.id);
+    mu_vec_ref(&v, 4, &out);
+    TEST_ASSERT_EQUAL_CHAR('e', out.id);
+}
+
+/** mu_vec_sorted_insert_hint matches mu_vec_sorted_insert and tracks the
+ * lower bound in the hint */
+void test_mu_vec_sorted_insert_hint(void) {
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    size_t hint = 0;
+    /* Mostly ascending, with a late arrival and a duplicate */
+    test_item_t in[] = {{10, 'a'}, {20, 'b'}, {30, 'c'}, {25, 'd'},
+                        {40, 'e'}, {40, 'f'}, {5, 'g'}};
+    const size_t lower[] = {0, 1, 2, 2, 4, 4, 0};
+    const char expected[] = "gabdcef";
+    for (size_t i = 0; i < sizeof(in) / sizeof(in[0]); ++i) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_vec_sorted_insert_hint(&v, &in[i], cmp_by_value,
+                                                    MU_STORE_INSERT_ANY,
+                                                    &hint));
+        TEST_ASSERT_EQUAL_size_t(lower[i], hint);
+    }
+    for (size_t i = 0; i < mu_vec_count(&v); ++i) {
+        test_item_t out;
+        mu_vec_ref(&v, i, &out);
+        TEST_ASSERT_EQUAL_CHAR(expected[i], out.id);
+    }
+
+    /* Policies behave as without a hint, whatever the hint */
+    test_item_t X = {.value = 40, .id = 'X'};
+    hint = 1000;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_sorted_insert_hint(&v, &X, cmp_by_value,
+                                                MU_STORE_UPDATE_LAST, &hint));
+    TEST_ASSERT_EQUAL_size_t(5, hint);
+    test_item_t out;
+    mu_vec_ref(&v, 6, &out);
+    TEST_ASSERT_EQUAL_CHAR('X', out.id);
+    test_item_t Y = {.value = 7, .id = 'Y'};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND,
+                      mu_vec_sorted_insert_hint(&v, &Y, cmp_by_value,
+                                                MU_STORE_UPDATE_FIRST, &hint));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_sorted_insert_hint(&v, &Y, cmp_by_value,
+                                                MU_STORE_INSERT_ANY, &hint));
+    TEST_ASSERT_EQUAL_size_t(CAP, mu_vec_count(&v));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      mu_vec_sorted_insert_hint(&v, &Y, cmp_by_value,
+                                                MU_STORE_INSERT_ANY, &hint));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_sorted_insert_hint(&v, &Y, cmp_by_value,
+                                                MU_STORE_INSERT_ANY, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_sorted_insert_hint(NULL, &Y, cmp_by_value,
+                                                MU_STORE_INSERT_ANY, &hint));
+}
+
+/** mu_vec_stable_sort keeps equal items in insertion order */
+void test_mu_vec_stable_sort(void) {
+    test_item_t scratch[CAP / 2];
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    test_item_t in[] = {{3, 'a'}, {1, 'b'}, {3, 'c'}, {2, 'd'},
+                        {1, 'e'}, {3, 'f'}, {2, 'g'}, {1, 'h'}};
+    const char expected[] = "behdgacf";
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_stable_sort(NULL, cmp_by_value, NULL, 0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_vec_stable_sort(&v, NULL, NULL, 0));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_stable_sort(&v, cmp_by_value, NULL, 0));
+
+    // with and without scratch
+    for (int pass = 0; pass < 2; ++pass) {
+        mu_vec_clear(&v);
+        for (int i = 0; i < CAP; ++i) {
+            mu_vec_push(&v, &in[i]);
+        }
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                          mu_vec_stable_sort(&v, cmp_by_value,
+                                             pass ? scratch : NULL,
+                                             pass ? CAP / 2 : 0));
+        for (int i = 0; i < CAP; ++i) {
+            test_item_t out;
+            mu_vec_ref(&v, i, &out);
+            TEST_ASSERT_EQUAL_CHAR(expected[i], out.id);
+        }
+    }
+}
+
+void test_mu_vec_select_partial_sort_topk(void) {
+    test_item_t top[3];
+    size_t n_out = 0;
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    test_item_t in[] = {{50, 'a'}, {20, 'b'}, {80, 'c'}, {10, 'd'},
+                        {60, 'e'}, {30, 'f'}, {70, 'g'}, {40, 'h'}};
+    for (int i = 0; i < CAP; ++i) {
+        mu_vec_push(&v, &in[i]);
+    }
+    test_item_t out;
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_vec_select(NULL, 0, cmp_by_value));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, mu_vec_select(&v, CAP, cmp_by_value));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_partial_sort(&v, 2, NULL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_topk(NULL, 2, cmp_by_value, top, &n_out));
+
+    // topk copies out the three smallest and leaves the vector alone
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_topk(&v, 3, cmp_by_value, top, &n_out));
+    TEST_ASSERT_EQUAL(3, n_out);
+    TEST_ASSERT_EQUAL_CHAR('d', top[0].id);
+    TEST_ASSERT_EQUAL_CHAR('b', top[1].id);
+    TEST_ASSERT_EQUAL_CHAR('f', top[2].id);
+    mu_vec_ref(&v, 0, &out);
+    TEST_ASSERT_EQUAL_CHAR('a', out.id);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_select(&v, 4, cmp_by_value));
+    mu_vec_ref(&v, 4, &out);
+    TEST_ASSERT_EQUAL(50, out.value);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_partial_sort(&v, 3, cmp_by_value));
+    for (int i = 0; i < 3; ++i) {
+        mu_vec_ref(&v, i, &out);
+        TEST_ASSERT_EQUAL_CHAR("dbf"[i], out.id);
+    }
+}
+
+void test_mu_vec_argsort_lockstep(void) {
+    uint32_t perm[CAP];
+    int tags_store[CAP];
+    mu_vec_t tags;
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    TEST_ASSERT_NOT_NULL(mu_vec_init(&tags, tags_store, CAP, sizeof(int)));
+    test_item_t in[] = {{3, 'a'}, {1, 'b'}, {3, 'c'}, {2, 'd'},
+                        {1, 'e'}, {3, 'f'}, {2, 'g'}, {1, 'h'}};
+    const char expected[] = "behdgacf";
+    for (int i = 0; i < CAP; ++i) {
+        mu_vec_push(&v, &in[i]);
+        mu_vec_push(&tags, &i);
+    }
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_argsort(NULL, cmp_by_value, perm,
+                                     sizeof(uint32_t)));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_apply_permutation(NULL, perm, sizeof(uint32_t)));
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_argsort(&v, cmp_by_value, perm,
+                                     sizeof(uint32_t)));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_apply_permutation(&v, perm, sizeof(uint32_t)));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_apply_permutation(&tags, perm, sizeof(uint32_t)));
+    for (int i = 0; i < CAP; ++i) {
+        test_item_t out;
+        int tag;
+        mu_vec_ref(&v, i, &out);
+        mu_vec_ref(&tags, i, &tag);
+        TEST_ASSERT_EQUAL_CHAR(expected[i], out.id);
+        TEST_ASSERT_EQUAL_INT(expected[i] - 'a', tag);
+    }
+}
+
+void test_mu_vec_radix_sort(void) {
+    test_item_t scratch[CAP];
+    TEST_ASSERT_NOT_NULL(
+        mu_vec_init(&v, backing_store, CAP, sizeof(test_item_t)));
+    test_item_t in[] = {{3, 'a'}, {-1, 'b'}, {3, 'c'}, {2, 'd'},
+                        {-1, 'e'}, {3, 'f'}, {2, 'g'}, {-1, 'h'}};
+    const char expected[] = "behdgacf";
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_radix_sort(NULL, offsetof(test_item_t, value),
+                                        sizeof(int), MU_STORE_RADIX_SIGNED,
+                                        scratch));
+    // The scratch is required whatever the count, even for an empty vector
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      mu_vec_radix_sort(&v, offsetof(test_item_t, value),
+                                        sizeof(int), MU_STORE_RADIX_SIGNED,
+                                        NULL));
+
+    for (int i = 0; i < CAP; ++i) {
+        mu_vec_push(&v, &in[i]);
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      mu_vec_radix_sort(&v, offsetof(test_item_t, value),
+                                        sizeof(int), MU_STORE_RADIX_SIGNED,
+                                        scratch));
+    for (int i = 0; i < CAP; ++i) {
+        test_item_t out;
+        mu_vec_ref(&v, i, &out);
+        TEST_ASSERT_EQUAL_CHAR(expected[i], out.id);
+    }
+}
+
 // *****************************************************************************
 // Test Cases
 
@@ -619,9 +1278,20 @@ int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_mu_vec_init_and_basic_properties);
     RUN_TEST(test_mu_vec_push_pop_peek_ref);
+    RUN_TEST(test_mu_vec_at_and_data);
+    RUN_TEST(test_mu_vec_emplace);
+    RUN_TEST(test_mu_vec_range_operations);
     RUN_TEST(test_mu_vec_insert_delete_replace_swap);
+    RUN_TEST(test_mu_vec_swap_remove);
     RUN_TEST(test_mu_vec_find_rfind);
+    RUN_TEST(test_mu_vec_find_from_and_find_all);
+    RUN_TEST(test_mu_vec_retain_and_partition);
+    RUN_TEST(test_mu_vec_find_eq_count_eq_find_range);
     RUN_TEST(test_mu_vec_sort_and_reverse);
+    RUN_TEST(test_mu_vec_stable_sort);
+    RUN_TEST(test_mu_vec_radix_sort);
+    RUN_TEST(test_mu_vec_argsort_lockstep);
+    RUN_TEST(test_mu_vec_select_partial_sort_topk);
     RUN_TEST(test_mu_vec_sorted_insert);
 
     RUN_TEST(test_mu_vec_insert_any_keeps_sorted);
@@ -641,6 +1311,9 @@ int main(void) {
     RUN_TEST(test_mu_vec_sorted_insert_last_no_match);
     RUN_TEST(test_mu_vec_sorted_insert_full);
     RUN_TEST(test_mu_vec_sorted_insert_duplicate_full_on_match);
+    RUN_TEST(test_mu_vec_sorted_insert_first_full_on_match);
+    RUN_TEST(test_mu_vec_sorted_insert_run_bounds);
+    RUN_TEST(test_mu_vec_sorted_insert_hint);
 
     return UNITY_END();
 }
@@ -0,0 +1,265 @@
+/**
+ * MIT License
+ *
+ * Copyright (c) 2025 R. D. Poor & Assoc <rdpoor @ gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/**
+ * @file test_mu_vec_typed.c
+ * @brief Unit tests for the MU_VEC_DEFINE typed vector generator.
+ */
+
+// *****************************************************************************
+// Includes
+
+#include "mu_store.h"
+#include "mu_vec.h"
+#include "mu_vec_typed.h"
+#include "unity.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// *****************************************************************************
+// Private types and definitions
+
+#define CAP 8
+#define LARGE_CAP 1000
+
+typedef struct {
+    int value; /**< Sort key */
+    char id;   /**< Distinct tag for updates */
+} test_item_t;
+
+static inline bool item_less(const test_item_t *a, const test_item_t *b) {
+    return a->value < b->value;
+}
+
+#define U32_LESS(a, b) (*(a) < *(b))
+
+MU_VEC_DEFINE(item_vec, test_item_t, item_less)
+MU_VEC_DEFINE(u32_vec, uint32_t, U32_LESS)
+
+// *****************************************************************************
+// storage
+
+static test_item_t backing_store[CAP];
+static test_item_t other_store[CAP];
+static uint32_t large_store[LARGE_CAP];
+static uint32_t large_expected[LARGE_CAP];
+
+static mu_vec_t v;
+static mu_vec_t w;
+
+// *****************************************************************************
+// helper functions
+
+static int cmp_by_value(const void *a, const void *b) {
+    const test_item_t *ia = (const test_item_t *)a;
+    const test_item_t *ib = (const test_item_t *)b;
+    return ia->value - ib->value;
+}
+
+static int cmp_u32(const void *a, const void *b) {
+    uint32_t ua = *(const uint32_t *)a;
+    uint32_t ub = *(const uint32_t *)b;
+    return (ua > ub) - (ua < ub);
+}
+
+// *****************************************************************************
+// Unity Test Setup and Teardown
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// *****************************************************************************
+// Test Cases
+
+void test_mu_vec_typed_push_pop_insert_delete(void) {
+    TEST_ASSERT_EQUAL_PTR(&v, item_vec_init(&v, backing_store, CAP));
+    TEST_ASSERT_EQUAL_size_t(sizeof(test_item_t), v.item_size);
+
+    test_item_t in, out;
+    for (int i = 0; i < CAP; ++i) {
+        in = (test_item_t){i * 10, 'A' + i};
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, item_vec_push(&v, &in));
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, item_vec_push(&v, &in));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL, item_vec_insert(&v, 0, &in));
+
+    // Untyped API sees the same items.
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_peek(&v, &out));
+    TEST_ASSERT_EQUAL_CHAR('H', out.id);
+
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, item_vec_pop(&v, &out));
+    TEST_ASSERT_EQUAL_CHAR('H', out.id);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, item_vec_delete(&v, 0, &out));
+    TEST_ASSERT_EQUAL_CHAR('A', out.id);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX, item_vec_delete(&v, 6, &out));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_INDEX, item_vec_insert(&v, 7, &in));
+
+    in = (test_item_t){5, 'z'};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, item_vec_insert(&v, 0, &in));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_ref(&v, 0, &out));
+    TEST_ASSERT_EQUAL_CHAR('z', out.id);
+    TEST_ASSERT_EQUAL_CHAR('B', item_vec_data(&v)[1].id);
+
+    // Inserting an item that lives in the store itself.
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      item_vec_insert(&v, 1, &item_vec_data(&v)[3]));
+    TEST_ASSERT_EQUAL_CHAR('D', item_vec_data(&v)[1].id);
+    TEST_ASSERT_EQUAL_CHAR('D', item_vec_data(&v)[4].id);
+
+    while (v.count > 0) {
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, item_vec_pop(&v, NULL));
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_EMPTY, item_vec_pop(&v, &out));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, item_vec_push(NULL, &in));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, item_vec_push(&v, NULL));
+}
+
+void test_mu_vec_typed_find_and_search(void) {
+    item_vec_init(&v, backing_store, CAP);
+    int values[] = {10, 20, 20, 20, 30, 40};
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i) {
+        test_item_t in = {values[i], 'a' + (char)i};
+        item_vec_push(&v, &in);
+    }
+
+    size_t index;
+    test_item_t key = {20, 0};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, item_vec_find(&v, &key, &index));
+    TEST_ASSERT_EQUAL_size_t(1, index);
+    key.value = 25;
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NOTFOUND, item_vec_find(&v, &key, &index));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, item_vec_find(&v, &key, NULL));
+
+    // Lower and upper bounds agree with the generic searches.
+    for (int k = 5; k <= 45; k += 5) {
+        key.value = k;
+        TEST_ASSERT_EQUAL_size_t(mu_store_search(v.item_store, v.count,
+                                                 v.item_size, cmp_by_value,
+                                                 &key),
+                                 item_vec_search(&v, &key));
+        TEST_ASSERT_EQUAL_size_t(
+            mu_store_search_upper(v.item_store, v.count, v.item_size,
+                                  cmp_by_value, &key),
+            item_vec_search_upper(&v, &key));
+    }
+}
+
+void test_mu_vec_typed_sort(void) {
+    mu_vec_t lv, ev;
+    u32_vec_init(&lv, large_store, LARGE_CAP);
+    mu_vec_init(&ev, large_expected, LARGE_CAP, sizeof(uint32_t));
+
+    // Random, sorted, reversed and few-unique inputs.
+    for (int pattern = 0; pattern < 4; ++pattern) {
+        srand(pattern + 1);
+        mu_vec_clear(&lv);
+        mu_vec_clear(&ev);
+        for (uint32_t i = 0; i < LARGE_CAP; ++i) {
+            uint32_t x = pattern == 0   ? (uint32_t)rand()
+                         : pattern == 1 ? i
+                         : pattern == 2 ? LARGE_CAP - i
+                                        : (uint32_t)rand() % 4;
+            u32_vec_push(&lv, &x);
+            mu_vec_push(&ev, &x);
+        }
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, u32_vec_sort(&lv));
+        TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, mu_vec_sort(&ev, cmp_u32));
+        TEST_ASSERT_EQUAL_UINT32_ARRAY(large_expected, large_store,
+                                       LARGE_CAP);
+    }
+
+    // Short vectors take the insertion sort path only.
+    item_vec_init(&v, backing_store, CAP);
+    int values[] = {3, 1, 2};
+    for (int i = 0; i < 3; ++i) {
+        test_item_t in = {values[i], 'a' + i};
+        item_vec_push(&v, &in);
+    }
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE, item_vec_sort(&v));
+    TEST_ASSERT_EQUAL_CHAR('b', item_vec_data(&v)[0].id);
+    TEST_ASSERT_EQUAL_CHAR('c', item_vec_data(&v)[1].id);
+    TEST_ASSERT_EQUAL_CHAR('a', item_vec_data(&v)[2].id);
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM, item_vec_sort(NULL));
+}
+
+void test_mu_vec_typed_sorted_insert_matches_generic(void) {
+    static const mu_vec_insert_policy_t policies[] = {
+        MU_STORE_INSERT_ANY,    MU_STORE_INSERT_FIRST,
+        MU_STORE_INSERT_LAST,   MU_STORE_UPDATE_FIRST,
+        MU_STORE_UPDATE_LAST,   MU_STORE_UPDATE_ALL,
+        MU_STORE_UPSERT_FIRST,  MU_STORE_UPSERT_LAST,
+        MU_STORE_INSERT_UNIQUE, MU_STORE_INSERT_DUPLICATE,
+    };
+    int values[] = {10, 20, 20, 30};
+    int keys[] = {5, 10, 20, 25, 30, 35};
+
+    for (size_t p = 0; p < sizeof(policies) / sizeof(policies[0]); ++p) {
+        for (size_t k = 0; k < sizeof(keys) / sizeof(keys[0]); ++k) {
+            item_vec_init(&v, backing_store, CAP);
+            mu_vec_init(&w, other_store, CAP, sizeof(test_item_t));
+            for (int i = 0; i < 4; ++i) {
+                test_item_t in = {values[i], 'a' + i};
+                item_vec_push(&v, &in);
+                mu_vec_push(&w, &in);
+            }
+            test_item_t item = {keys[k], 'X'};
+            mu_vec_err_t typed = item_vec_sorted_insert(&v, &item, policies[p]);
+            mu_vec_err_t generic =
+                mu_vec_sorted_insert(&w, &item, cmp_by_value, policies[p]);
+            TEST_ASSERT_EQUAL(generic, typed);
+            TEST_ASSERT_EQUAL_size_t(w.count, v.count);
+            TEST_ASSERT_EQUAL_MEMORY(other_store, backing_store,
+                                     v.count * sizeof(test_item_t));
+        }
+    }
+
+    // A full vector reports FULL for inserting policies.
+    item_vec_init(&v, backing_store, CAP);
+    for (int i = 0; i < CAP; ++i) {
+        test_item_t in = {i, 'a' + i};
+        item_vec_push(&v, &in);
+    }
+    test_item_t item = {3, 'X'};
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_FULL,
+                      item_vec_sorted_insert(&v, &item, MU_STORE_INSERT_ANY));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_NONE,
+                      item_vec_sorted_insert(&v, &item, MU_STORE_UPDATE_ALL));
+    TEST_ASSERT_EQUAL(MU_STORE_ERR_PARAM,
+                      item_vec_sorted_insert(&v, NULL, MU_STORE_INSERT_ANY));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_mu_vec_typed_push_pop_insert_delete);
+    RUN_TEST(test_mu_vec_typed_find_and_search);
+    RUN_TEST(test_mu_vec_typed_sort);
+    RUN_TEST(test_mu_vec_typed_sorted_insert_matches_generic);
+    return UNITY_END();
+}
+
+// *****************************************************************************
+// End of file